@@ -0,0 +1,56 @@
+#pragma once
+
+#ifndef GLUINO_BENCH_H
+#define GLUINO_BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace Gluino::Bench {
+
+struct Case {
+	const char* Name;
+	void (*Run)();
+};
+
+inline std::vector<Case>& GetCases() {
+	static std::vector<Case> cases;
+	return cases;
+}
+
+struct Registrar {
+	Registrar(const char* name, void (*run)()) { GetCases().push_back({ name, run }); }
+};
+
+constexpr int Rounds = 15;
+
+// Times run(state) on a fresh state from setup() each round, and prints the best and the median
+// time per operation. Setup is not timed.
+template <typename Setup, typename Run>
+void Measure(const char* name, const size_t operations, Setup setup, Run run) {
+	using Clock = std::chrono::steady_clock;
+
+	std::vector<double> times;
+	for (auto round = 0; round < Rounds; ++round) {
+		auto state = setup();
+		const auto start = Clock::now();
+		run(state);
+		const auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+		times.push_back(elapsed / (double)operations);
+	}
+
+	std::sort(times.begin(), times.end());
+	std::printf("%-40s %10.1f ns/op best %10.1f ns/op median (%zu ops)\n",
+		name, times.front(), times[times.size() / 2], operations);
+}
+
+}
+
+#define BENCHMARK(name) \
+	static void name(); \
+	static const Gluino::Bench::Registrar name##Registrar(#name, name); \
+	static void name()
+
+#endif // !GLUINO_BENCH_H
@@ -0,0 +1,117 @@
+#include "bench.h"
+#include "app.h"
+#include "vfs.h"
+
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+using namespace Gluino;
+
+namespace {
+
+constexpr auto MessageCount = 10000;
+constexpr auto FetchCount = 10000;
+
+size_t delivered = 0;
+
+void OnEvents(const EventRecord*, const int count) {
+	delivered += count;
+}
+
+void OnResourceRequested(const WebResourceRequest, WebResourceResponse* response) {
+	static constexpr char Content[] = "{\"ok\":true}";
+	response->Content = malloc(sizeof(Content) - 1);
+	memcpy(response->Content, Content, sizeof(Content) - 1);
+	response->ContentLength = (int)sizeof(Content) - 1;
+	response->ContentTypeA = (char*)"application/json";
+	response->StatusCode = 200;
+}
+
+// A headless app with one started window, driven from the benchmark's thread as its loop.
+struct Session {
+	Gluino::App App{ (char*)"headless-bench" };
+	Gluino::Vfs Vfs;
+	Gluino::Window* Window = nullptr;
+	Gluino::WebView* WebView = nullptr;
+
+	Gluino::WindowOptions WindowOptions{};
+	Gluino::WindowEvents WindowEvents{};
+	Gluino::WebViewOptions WebViewOptions{};
+	Gluino::WebViewEvents WebViewEvents{};
+
+	Session() {
+		WindowOptions.TitleA = (char*)"";
+		WindowOptions.Size = { 800, 600 };
+		WindowOptions.MaximumSize = { INT_MAX, INT_MAX };
+		WindowOptions.BrowserSuspendDelay = -1;
+		WindowEvents.OnEvents = (EventBatchDelegate*)OnEvents;
+		WindowEvents.Subscriptions = 1u << (int)EventType::MessageReceived;
+		WebViewOptions.SuspendDelay = -1;
+		WebViewEvents.OnResourceRequested = (WebResourceDelegate*)OnResourceRequested;
+
+		WindowBase* window = nullptr;
+		WebViewBase* webView = nullptr;
+		App.SpawnWindow(&WindowOptions, &WindowEvents, &WebViewOptions, &WebViewEvents, nullptr, &window, &webView);
+		Window = (Gluino::Window*)window;
+		WebView = (Gluino::WebView*)webView;
+		App.RunOnce(0);
+
+		const auto overlay = (OverlayLayer*)Vfs.AddLayer(std::make_unique<OverlayLayer>(), 0);
+		overlay->Put("data.json", "{\"ok\":true}", 11);
+		WebView->Mount("app://", &Vfs);
+		delivered = 0;
+	}
+
+	~Session() {
+		Window->Close();
+		App.RunOnce(0);
+	}
+};
+
+}
+
+BENCHMARK(HeadlessMessageDelivery) {
+	// Page messages queued within one turn of the loop and handed to the host in batches.
+	Bench::Measure("page message, batched", MessageCount,
+		[] { return std::make_unique<Session>(); },
+		[](const std::unique_ptr<Session>& session) {
+			for (auto i = 0; i < MessageCount; ++i)
+				session->WebView->PagePostMessage("ping");
+			while (delivered < MessageCount)
+				session->App.RunOnce(0);
+		});
+
+	// One message per turn: the full round trip through the wake handle and the loop.
+	Bench::Measure("page message, per loop turn", MessageCount,
+		[] { return std::make_unique<Session>(); },
+		[](const std::unique_ptr<Session>& session) {
+			for (size_t i = 0; i < MessageCount; ++i) {
+				session->WebView->PagePostMessage("ping");
+				while (delivered <= i)
+					session->App.RunOnce(0);
+			}
+		});
+}
+
+BENCHMARK(HeadlessFetch) {
+	Bench::Measure("fetch, mounted vfs", FetchCount,
+		[] { return std::make_unique<Session>(); },
+		[](const std::unique_ptr<Session>& session) {
+			for (auto i = 0; i < FetchCount; ++i) {
+				ResourceResult result;
+				session->WebView->PageFetch({ "app://data.json", "GET", {}, {} }, &result);
+			}
+		});
+
+	Bench::Measure("fetch, host handler", FetchCount,
+		[] { return std::make_unique<Session>(); },
+		[](const std::unique_ptr<Session>& session) {
+			for (auto i = 0; i < FetchCount; ++i) {
+				ResourceResult result;
+				session->WebView->PageFetch({ "https://example.com/data.json", "GET", {}, {} }, &result);
+			}
+		});
+}
@@ -0,0 +1,11 @@
+#include "bench.h"
+
+using namespace Gluino;
+
+int main() {
+	for (const auto& [name, run] : Bench::GetCases()) {
+		std::printf("[%s]\n", name);
+		run();
+	}
+	return 0;
+}
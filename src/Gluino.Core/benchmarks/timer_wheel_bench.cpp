@@ -0,0 +1,77 @@
+#include "bench.h"
+#include "timer_wheel.h"
+
+#include <memory>
+
+using namespace Gluino;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr auto TimerCount = 10000;
+
+// Due times spread over ten seconds, so timers land on every level of the wheel.
+TimerWheel::Clock::duration GetDue(const int i) {
+	return 1ms * (i * 7919 % 10000);
+}
+
+struct Scheduled {
+	std::unique_ptr<TimerWheel> Wheel = std::make_unique<TimerWheel>();
+	std::vector<int> Ids;
+	TimerWheel::Clock::time_point Start = TimerWheel::Clock::now();
+	size_t Fired = 0;
+};
+
+std::unique_ptr<Scheduled> ScheduleAll() {
+	auto state = std::make_unique<Scheduled>();
+	state->Ids.reserve(TimerCount);
+	for (auto i = 0; i < TimerCount; ++i)
+		state->Ids.push_back(state->Wheel->Schedule(GetDue(i), [fired = &state->Fired] { ++*fired; }));
+	return state;
+}
+
+}
+
+BENCHMARK(TimerWheelSchedule) {
+	Bench::Measure("schedule 10k", TimerCount,
+		[] { return std::make_unique<Scheduled>(); },
+		[](const std::unique_ptr<Scheduled>& state) {
+			for (auto i = 0; i < TimerCount; ++i)
+				state->Wheel->Schedule(GetDue(i), [fired = &state->Fired] { ++*fired; });
+		});
+}
+
+BENCHMARK(TimerWheelCancel) {
+	Bench::Measure("cancel 10k", TimerCount, ScheduleAll,
+		[](const std::unique_ptr<Scheduled>& state) {
+			for (const auto id : state->Ids)
+				state->Wheel->Cancel(id);
+		});
+}
+
+BENCHMARK(TimerWheelAdvance) {
+	// One call past every deadline: the cost of cascading and firing the whole wheel.
+	Bench::Measure("advance 10k, one call", TimerCount, ScheduleAll,
+		[](const std::unique_ptr<Scheduled>& state) {
+			state->Wheel->Advance(state->Start + 11s);
+		});
+
+	// A loop waking once per frame until every timer has fired.
+	Bench::Measure("advance 10k, per 16ms frame", TimerCount, ScheduleAll,
+		[](const std::unique_ptr<Scheduled>& state) {
+			for (auto now = state->Start; state->Fired < TimerCount; now += 16ms)
+				state->Wheel->Advance(now);
+		});
+
+	// Advancing with cancelled timers still in their slots, as after a burst of cancellations.
+	Bench::Measure("advance 10k, half cancelled", TimerCount,
+		[] {
+			auto state = ScheduleAll();
+			for (size_t i = 0; i < state->Ids.size(); i += 2)
+				state->Wheel->Cancel(state->Ids[i]);
+			return state;
+		},
+		[](const std::unique_ptr<Scheduled>& state) {
+			state->Wheel->Advance(state->Start + 11s);
+		});
+}
@@ -5,21 +5,304 @@
 
 #include "window_base.h"
 #include "webview_base.h"
+#include "ui_thread_base.h"
+#include "wake_handle.h"
+#include "idle_scheduler.h"
+#include "timer_wheel.h"
+#include "window_pool.h"
+#include "single_instance.h"
+#include "invoke_queue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace Gluino {
 
+typedef void (*SpawnDelegate)(void* context, WindowHandle window, WebViewHandle webView);
+typedef void (*ArgumentsDelegate)(const autostr* args, int count);
+
 class AppBase {
 public:
+	AppBase() {
+		_timerWheel.SetWakeCallback([this] { Wake(); });
+	}
+
 	virtual ~AppBase() = default;
 
-	virtual void SpawnWindow(
+	// Windows spawned on the app's loop take a pre-warmed pair from the window pool when one is
+	// ready; otherwise, or on a UI thread, a new pair is created.
+	void SpawnWindow(
+		WindowOptions* windowOptions, WindowEvents* windowEvents,
+		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+		UiThreadBase* thread, WindowBase** window, WebViewBase** webView) {
+		if (!thread && AcquirePooledWindow(windowOptions, windowEvents, webViewOptions, webViewEvents, window, webView))
+			return;
+		CreateWindowPair(windowOptions, windowEvents, webViewOptions, webViewEvents, thread, window, webView);
+	}
+
+	// Unregisters a destroyed window and its webviews; the app exits with its main window.
+	void DespawnWindow(WindowBase* window) {
+		OnDespawnWindow(window);
+		WindowRegistry.Remove(window->GetRegistryHandle());
+		for (const auto webView : window->GetWebViews().GetAll())
+			WebViewRegistry.Remove(webView->GetRegistryHandle());
+
+		if (window->IsMain())
+			Exit();
+	}
+
+	// Creates the window and webview like SpawnWindow, but reports them through the callback once
+	// the webview is ready and shows the window only after its first navigation has committed.
+	// Webview creation is asynchronous, so several spawns issued together initialise in parallel.
+	void SpawnWindowAsync(
 		WindowOptions* windowOptions, WindowEvents* windowEvents,
-		WebViewOptions* webViewOptions,	WebViewEvents* webViewEvents,
-		WindowBase** window, WebViewBase** webView) = 0;
-	virtual void DespawnWindow(WindowBase* window) = 0;
+		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+		UiThreadBase* thread, const SpawnDelegate callback, void* context) {
+		const auto spawn = [&] {
+			WindowBase* window;
+			WebViewBase* webView;
+			SpawnWindow(windowOptions, windowEvents, webViewOptions, webViewEvents, thread, &window, &webView);
+
+			webView->SetReadyHandler([callback, context, window, webView] {
+				callback(context, window->GetRegistryHandle(), webView->GetRegistryHandle());
+			});
+			webView->SetFirstCommitHandler([window] { window->Show(); });
+		};
+
+		if (thread)
+			thread->Invoke(spawn);
+		else
+			spawn();
+	}
+
+	UiThreadBase* CreateUiThread() {
+		auto thread = NewUiThread();
+		const auto result = thread.get();
+
+		std::lock_guard lock(_uiThreadsMutex);
+		_uiThreads.push_back(std::move(thread));
+		return result;
+	}
+
+	void DestroyUiThread(UiThreadBase* thread) {
+		std::unique_ptr<UiThreadBase> owned;
+		{
+			std::lock_guard lock(_uiThreadsMutex);
+			const auto it = std::find_if(_uiThreads.begin(), _uiThreads.end(),
+				[thread](const auto& t) { return t.get() == thread; });
+			if (it == _uiThreads.end())
+				return;
+			owned = std::move(*it);
+			_uiThreads.erase(it);
+		}
+
+		ReleaseUiThread(std::move(owned));
+	}
 
 	virtual void Run() = 0;
+	virtual bool RunOnce(int timeout) = 0;
 	virtual void Exit() = 0;
+
+	virtual bool HasPendingWork() = 0;
+	[[nodiscard]] intptr_t GetWakeHandle() const { return _wakeHandle.GetNative(); }
+	void Wake() { _wakeHandle.Signal(); }
+
+	void Dispatch(std::function<void()> task) {
+		if (_invokeQueue.Push(std::move(task)))
+			Wake();
+	}
+
+	// Returns false if an instance with the same name is already running; it has received the
+	// arguments and this process can exit. Otherwise arguments forwarded by later launches are
+	// delivered on the app's loop.
+	bool RequestSingleInstance(const std::string& name, const std::vector<std::string>& args, const ArgumentsDelegate callback) {
+		if (_singleInstance)
+			return true;
+
+		_singleInstance = std::make_unique<SingleInstance>(name, [this, callback](std::vector<std::string> forwarded) {
+			Dispatch([callback, forwarded = std::move(forwarded)] {
+				std::vector<decltype(ToAutoStr(std::string()))> strs;
+				std::vector<autostr> ptrs;
+				for (const auto& arg : forwarded)
+					strs.push_back(ToAutoStr(arg));
+				for (auto& str : strs)
+					ptrs.push_back(str.data());
+				callback(ptrs.data(), (int)ptrs.size());
+			});
+		});
+
+		if (_singleInstance->Acquire(args))
+			return true;
+
+		_singleInstance.reset();
+		return false;
+	}
+
+	int PostIdle(IdleScheduler::Task task) {
+		const auto id = _idleScheduler.Post(std::move(task));
+		Wake();
+		return id;
+	}
+	bool CancelIdle(const int id) { return _idleScheduler.Cancel(id); }
+	IdleScheduler* GetIdleScheduler() { return &_idleScheduler; }
+
+	TimerWheel* GetTimerWheel() { return &_timerWheel; }
+
+	// Number of hidden, fully initialised window and webview pairs kept ready on the app's loop.
+	// Pairs are created one per idle period and share the loop's browser environment.
+	void SetWindowPoolSize(const int size) {
+		_windowPool.SetCapacity(size);
+		for (const auto& entry : _windowPool.Trim()) {
+			if (const auto window = WindowRegistry.Get(entry.Window))
+				window->Close();
+		}
+		RefillWindowPool();
+	}
+	[[nodiscard]] int GetWindowPoolSize() const { return _windowPool.GetCapacity(); }
+	WindowPool* GetWindowPool() { return &_windowPool; }
+
+protected:
+	WakeHandle _wakeHandle;
+	IdleScheduler _idleScheduler;
+	TimerWheel _timerWheel;
+	WindowPool _windowPool;
+	InvokeQueue _invokeQueue;
+
+	std::mutex _uiThreadsMutex;
+	std::vector<std::unique_ptr<UiThreadBase>> _uiThreads;
+
+	// Creates a window and its webview on the thread's loop, or the app's without one, and
+	// registers both.
+	void CreateWindowPair(
+		WindowOptions* windowOptions, WindowEvents* windowEvents,
+		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+		UiThreadBase* thread, WindowBase** window, WebViewBase** webView) {
+		if (thread && !thread->IsCurrent()) {
+			thread->Invoke([&] {
+				CreateWindowPair(windowOptions, windowEvents, webViewOptions, webViewEvents, thread, window, webView);
+			});
+			return;
+		}
+
+		WebViewBase* wv;
+		const auto wnd = NewWindowPair(windowOptions, windowEvents, webViewOptions, webViewEvents, thread, &wv);
+		wnd->SetTimerWheel(thread ? thread->GetTimerWheel() : &_timerWheel);
+
+		wnd->SetRegistryHandle(WindowRegistry.Add(wnd));
+		wv->SetRegistryHandle(WebViewRegistry.Add(wv));
+		OnWindowCreated(wnd, thread);
+
+		*window = wnd;
+		*webView = wv;
+	}
+
+	// The platform's window and webview, constructed on the loop they belong to.
+	virtual WindowBase* NewWindowPair(
+		WindowOptions* windowOptions, WindowEvents* windowEvents,
+		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+		UiThreadBase* thread, WebViewBase** webView) = 0;
+	virtual void OnWindowCreated([[maybe_unused]] WindowBase* window, [[maybe_unused]] UiThreadBase* thread) {}
+	virtual void OnDespawnWindow([[maybe_unused]] WindowBase* window) {}
+
+	virtual std::unique_ptr<UiThreadBase> NewUiThread() = 0;
+
+	// A thread cannot join itself, and may be draining the very task that destroys it; it is
+	// stopped and released from the app's loop once that task has returned. Any other thread is
+	// joined here.
+	virtual void ReleaseUiThread(std::unique_ptr<UiThreadBase> thread) {
+		if (!thread->IsCurrent())
+			return;
+
+		thread->Stop();
+		Dispatch([released = thread.release()] { delete released; });
+	}
+
+	void StopUiThreads() {
+		std::lock_guard lock(_uiThreadsMutex);
+		for (const auto& thread : _uiThreads)
+			thread->Stop();
+	}
+
+	// Called first thing by the platform's destructor, while windows destroyed with their threads
+	// can still reach the app.
+	void DestroyUiThreads() {
+		std::lock_guard lock(_uiThreadsMutex);
+		_uiThreads.clear();
+	}
+
+private:
+	std::atomic<std::thread::id> _windowPoolThread;
+	std::atomic<bool> _windowPoolRefilling = false;
+
+	// Declared last so its listener stops before the queue it dispatches to is destroyed.
+	std::unique_ptr<SingleInstance> _singleInstance;
+
+	bool AcquirePooledWindow(
+		WindowOptions* windowOptions, WindowEvents* windowEvents,
+		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+		WindowBase** window, WebViewBase** webView) {
+		// Pooled pairs belong to the loop that warmed them.
+		WindowPool::Entry entry;
+		if (_windowPoolThread.load() != std::this_thread::get_id() || !_windowPool.Acquire(&entry))
+			return false;
+
+		*window = WindowRegistry.Get(entry.Window);
+		*webView = WebViewRegistry.Get(entry.WebView);
+		(*window)->Adopt(windowOptions, windowEvents);
+		(*webView)->Adopt(webViewOptions, webViewEvents);
+
+		RefillWindowPool();
+		return true;
+	}
+
+	void RefillWindowPool() {
+		if (_windowPool.GetDeficit() == 0 || _windowPoolRefilling.exchange(true))
+			return;
+
+		PostIdle([this](IdleScheduler::Clock::time_point) {
+			if (_windowPool.GetDeficit() > 0)
+				WarmPooledWindow();
+			if (_windowPool.GetDeficit() > 0)
+				return true;
+
+			_windowPoolRefilling = false;
+			return _windowPool.GetDeficit() > 0 && !_windowPoolRefilling.exchange(true);
+		});
+	}
+
+	void WarmPooledWindow() {
+		_windowPoolThread = std::this_thread::get_id();
+
+		WindowOptions windowOptions{};
+		windowOptions.TitleW = (wchar_t*)L"";
+		windowOptions.TitleA = (char*)"";
+		windowOptions.Size = { 800, 600 };
+		windowOptions.MaximumSize = { INT_MAX, INT_MAX };
+		windowOptions.MinimizeEnabled = true;
+		windowOptions.MaximizeEnabled = true;
+		windowOptions.BackgroundThrottling = true;
+		windowOptions.BrowserSuspendDelay = -1;
+		WindowEvents windowEvents{};
+		WebViewOptions webViewOptions{};
+		webViewOptions.SuspendDelay = -1;
+		WebViewEvents webViewEvents{};
+
+		WindowBase* window;
+		WebViewBase* webView;
+		CreateWindowPair(&windowOptions, &windowEvents, &webViewOptions, &webViewEvents, nullptr, &window, &webView);
+
+		const auto handle = window->GetRegistryHandle();
+		_windowPool.AddWarming({ handle, webView->GetRegistryHandle() });
+		webView->SetReadyHandler([this, handle, window, webView] {
+			if (!_windowPool.MarkReady(handle, webView->IsCreated()))
+				window->Close();
+		});
+	}
 };
 
 }
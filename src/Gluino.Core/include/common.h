@@ -9,6 +9,8 @@
 #include <cstring>
 #endif
 
+#include "geometry.h"
+
 #include <iosfwd>
 #include <sstream>
 #include <string>
@@ -22,8 +24,9 @@ namespace Gluino {
 
 typedef wchar_t* autostr;
 #else
+#define EXPORT __attribute__((visibility("default")))
+#define __stdcall
 
-#define EXPORT
 typedef char* autostr;
 #endif
 
@@ -65,23 +68,6 @@ enum class WindowTheme {
     Dark
 };
 
-struct Size {
-    int width;
-    int height;
-};
-
-struct Point {
-    int x;
-    int y;
-};
-
-struct Rect {
-    int x;
-    int y;
-    int width;
-    int height;
-};
-
 struct WebResourceRequest {
     wchar_t* UrlW;
     char* UrlA;
@@ -105,9 +91,20 @@ typedef void (*SizeDelegate)(Size);
 typedef void (*PointDelegate)(Point);
 typedef void (*StringDelegate)(autostr);
 typedef void (*IntDelegate)(int);
+typedef void (*PtrDelegate)(void*);
+typedef bool (*IdleDelegate)(void*, int);
 typedef void (*WebResourceDelegate)(WebResourceRequest, WebResourceResponse*);
 typedef void (__stdcall *ExecuteScriptCallback)(bool success, autostr result);
 
+#ifdef _WIN32
+std::string ToUtf8(const wchar_t* str);
+std::wstring ToWide(const std::string& str);
+inline std::wstring ToAutoStr(const std::string& str) { return ToWide(str); }
+#else
+inline std::string ToUtf8(const char* str) { return str ? str : ""; }
+inline std::string ToAutoStr(const std::string& str) { return str; }
+#endif
+
 inline autostr CopyStr(autostr source) {
     autostr result;
 
@@ -127,6 +124,7 @@ inline autostr CopyStr(autostr source) {
     return result;
 }
 
+#ifdef _WIN32
 template<typename T>
 concept wstr_ptr = std::is_same_v<T, wchar_t*> || std::is_same_v<T, const wchar_t*>;
 
@@ -143,6 +141,7 @@ wchar_t* ConcatStr(Args... args) {
 
     return concatenated;
 }
+#endif
 
 }
 
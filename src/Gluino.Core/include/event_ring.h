@@ -0,0 +1,67 @@
+#pragma once
+
+#ifndef GLUINO_EVENT_RING_H
+#define GLUINO_EVENT_RING_H
+
+#include "common.h"
+
+#include <mutex>
+#include <vector>
+
+namespace Gluino {
+
+enum class EventType : int {
+	Shown,
+	Hidden,
+	Resize,
+	ResizeStart,
+	ResizeEnd,
+	LocationChanged,
+	WindowStateChanged,
+	FocusIn,
+	FocusOut,
+	NavigationStart,
+	NavigationEnd,
+	MessageReceived,
+	Closing
+};
+
+// Closing is never queued; its bit only gates the synchronous OnClosing call.
+// X and Y carry a size, a location or a window state depending on the type.
+// Text is owned by the ring and stays valid until the batch has been delivered.
+struct EventRecord {
+	EventType Type;
+	int X;
+	int Y;
+	autostr Text;
+};
+
+typedef void (*EventBatchDelegate)(const EventRecord* records, int count);
+
+// Bounded queue of window and webview events awaiting delivery to the host in one batch.
+// Consecutive resize or move records are merged so a drag produces at most one per batch.
+class EventRing {
+public:
+	explicit EventRing(size_t capacity = DefaultCapacity);
+	~EventRing();
+
+	EventRing(const EventRing&) = delete;
+	EventRing& operator=(const EventRing&) = delete;
+
+	bool Push(EventType type, int x, int y, const autostr text, bool* wasEmpty);
+	size_t Drain(std::vector<EventRecord>* records);
+
+	static void Release(std::vector<EventRecord>* records);
+
+	static constexpr size_t DefaultCapacity = 256;
+
+private:
+	std::mutex _mutex;
+	std::vector<EventRecord> _records;
+	size_t _head = 0;
+	size_t _count = 0;
+};
+
+}
+
+#endif // !GLUINO_EVENT_RING_H
@@ -0,0 +1,39 @@
+#pragma once
+
+#ifndef GLUINO_FILE_TOKENS_H
+#define GLUINO_FILE_TOKENS_H
+
+#include "mapped_file.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace Gluino {
+
+class FileTokens final : public ResourceHandler {
+public:
+	static constexpr auto Prefix = "app://files/";
+	static constexpr size_t TokenLength = 32;
+
+	~FileTokens() override { Detach(); }
+
+	std::string Register(const std::string& path, const std::string& contentType);
+	bool Revoke(std::string_view url);
+	void RevokeAll();
+
+	bool HandleRequest(const ResourceQuery& query, std::string_view path, ResourceResult* result) override;
+
+private:
+	struct Entry {
+		std::shared_ptr<FileBlob> File;
+		std::string ContentType;
+		std::string Path;
+	};
+
+	std::mutex _mutex;
+	std::unordered_map<std::string, Entry> _entries;
+};
+
+}
+
+#endif // !GLUINO_FILE_TOKENS_H
@@ -0,0 +1,56 @@
+#pragma once
+
+#ifndef GLUINO_FILE_WATCHER_H
+#define GLUINO_FILE_WATCHER_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Gluino {
+
+class FileWatcher {
+public:
+	// Overflow is set when events were lost and any file under the root may have changed.
+	typedef std::function<void(const std::vector<std::string>& paths, bool overflow)> ChangeCallback;
+
+	FileWatcher(std::string root, ChangeCallback callback);
+	~FileWatcher();
+
+	FileWatcher(const FileWatcher&) = delete;
+	FileWatcher& operator=(const FileWatcher&) = delete;
+
+	bool Start();
+	void Stop();
+
+	[[nodiscard]] const std::string& GetRoot() const { return _root; }
+
+	static constexpr auto DebounceInterval = std::chrono::milliseconds(50);
+
+private:
+	std::string _root;
+	ChangeCallback _callback;
+	std::thread _thread;
+	std::atomic<bool> _running = false;
+
+#ifdef _WIN32
+	void* _hDirectory = nullptr;
+	void* _hStopEvent = nullptr;
+#else
+	int _fd = -1;
+	int _stopFd = -1;
+	std::unordered_map<int, std::string> _watches;
+
+	void AddWatches(const std::string& directory);
+#endif
+
+	void Run();
+};
+
+}
+
+#endif // !GLUINO_FILE_WATCHER_H
@@ -0,0 +1,27 @@
+#pragma once
+
+#ifndef GLUINO_GEOMETRY_H
+#define GLUINO_GEOMETRY_H
+
+namespace Gluino {
+
+struct Size {
+    int width;
+    int height;
+};
+
+struct Point {
+    int x;
+    int y;
+};
+
+struct Rect {
+    int x;
+    int y;
+    int width;
+    int height;
+};
+
+}
+
+#endif // !GLUINO_GEOMETRY_H
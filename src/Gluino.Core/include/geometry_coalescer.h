@@ -0,0 +1,52 @@
+#pragma once
+
+#ifndef GLUINO_GEOMETRY_COALESCER_H
+#define GLUINO_GEOMETRY_COALESCER_H
+
+#include "geometry.h"
+
+#include <atomic>
+#include <chrono>
+
+namespace Gluino {
+
+struct GeometryUpdate {
+	bool Resized = false;
+	bool Moved = false;
+	Gluino::Size Size = {};
+	Point Location = {};
+};
+
+// Merges bursts of resize/move notifications into at most one delivery per interval.
+// Owned and driven by the window thread; only the interval may be changed from other threads.
+class GeometryCoalescer {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	explicit GeometryCoalescer(Clock::duration interval = DefaultInterval);
+
+	void SetInterval(Clock::duration interval);
+	[[nodiscard]] Clock::duration GetInterval() const;
+
+	bool Resize(const Size& size, Clock::time_point now);
+	bool Move(const Point& location, Clock::time_point now);
+
+	bool Poll(Clock::time_point now, GeometryUpdate* update);
+	bool Flush(GeometryUpdate* update);
+
+	[[nodiscard]] bool HasPending() const { return _pending.Resized || _pending.Moved; }
+	[[nodiscard]] Clock::time_point GetDeadline() const { return _lastDelivery + GetInterval(); }
+
+	static constexpr Clock::duration DefaultInterval = std::chrono::microseconds(16667);
+
+private:
+	std::atomic<Clock::rep> _interval;
+	Clock::time_point _lastDelivery;
+	GeometryUpdate _pending;
+
+	bool IsDue(Clock::time_point now) const;
+};
+
+}
+
+#endif // !GLUINO_GEOMETRY_COALESCER_H
@@ -0,0 +1,66 @@
+#pragma once
+
+#ifndef GLUINO_PLUGIN_ABI_H
+#define GLUINO_PLUGIN_ABI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#define GLUINO_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define GLUINO_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+#define GLUINO_PLUGIN_ABI_VERSION 1
+#define GLUINO_PLUGIN_ENTRY_POINT "GluinoPlugin_Create"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Strings are NUL-terminated UTF-8 and are only valid for the duration of the call they are passed to.
+ * Structs start with their size so that fields can be appended without breaking older plugins.
+ */
+
+typedef struct GluinoPluginResponse GluinoPluginResponse;
+
+typedef struct GluinoPluginRequest {
+	uint32_t size;
+	const char* url;
+	const char* path;
+	const char* method;
+	const char* headers;
+} GluinoPluginRequest;
+
+typedef struct GluinoPluginHost {
+	uint32_t size;
+	uint32_t abiVersion;
+	void (*SetStatus)(GluinoPluginResponse* response, int statusCode);
+	void (*SetContentType)(GluinoPluginResponse* response, const char* contentType);
+	void (*AddHeader)(GluinoPluginResponse* response, const char* name, const char* value);
+	void (*Write)(GluinoPluginResponse* response, const void* data, size_t size);
+	void (*SetBody)(GluinoPluginResponse* response, const void* data, size_t size, void (*release)(void* context), void* context);
+} GluinoPluginHost;
+
+typedef struct GluinoPluginHandler {
+	uint32_t size;
+	void* context;
+	int (*HandleRequest)(void* context, const GluinoPluginRequest* request, GluinoPluginResponse* response);
+	void (*Destroy)(void* context);
+} GluinoPluginHandler;
+
+/*
+ * Exported by the plugin as GLUINO_PLUGIN_ENTRY_POINT.
+ * Fills the handler and returns non-zero on success. The host pointer stays valid until Destroy is called.
+ * HandleRequest returns zero to let the request fall through to the next handler. It is called on the UI thread.
+ * A 200 response with a complete body is served to Range requests by the host.
+ */
+typedef int (*GluinoPluginCreateFn)(const GluinoPluginHost* host, const char* options, GluinoPluginHandler* handler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !GLUINO_PLUGIN_ABI_H
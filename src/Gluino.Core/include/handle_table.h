@@ -0,0 +1,202 @@
+#pragma once
+
+#ifndef GLUINO_HANDLE_TABLE_H
+#define GLUINO_HANDLE_TABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+namespace Gluino {
+
+// Dense slot map of non-owning pointers. A handle combines a slot index with the slot's
+// generation, so a handle to a removed entry never resolves, even once its slot is reused.
+// Handle 0 is never issued.
+//
+// A pin keeps an entry's value alive while a caller on another thread uses it: a removed entry
+// stops resolving at once, but its slot is not reused and the release passed to Remove does not
+// run until the last pin on it is dropped.
+template <typename T>
+class HandleTable {
+public:
+	typedef uintptr_t Handle;
+	typedef std::function<void()> Release;
+
+	template <typename U>
+	class Pinned {
+	public:
+		Pinned() = default;
+		Pinned(Pinned&& other) noexcept
+			: _table(std::exchange(other._table, nullptr)), _index(other._index), _value(std::exchange(other._value, nullptr)) {}
+		~Pinned() { if (_table) _table->Unpin(_index); }
+
+		Pinned(const Pinned&) = delete;
+		Pinned& operator=(const Pinned&) = delete;
+		Pinned& operator=(Pinned&&) = delete;
+
+		operator U*() const { return _value; }
+		U* operator->() const { return _value; }
+
+	private:
+		friend class HandleTable;
+
+		HandleTable* _table = nullptr;
+		uint32_t _index = 0;
+		U* _value = nullptr;
+
+		Pinned(HandleTable* table, const uint32_t index, U* value) : _table(table), _index(index), _value(value) {}
+	};
+
+	Handle Add(T* value) {
+		std::unique_lock lock(_mutex);
+
+		uint32_t index;
+		if (_freeHead != NoSlot) {
+			index = _freeHead;
+			_freeHead = _slots[index].NextFree;
+		}
+		else {
+			if (_slots.size() > IndexMask)
+				return 0;
+			index = (uint32_t)_slots.size();
+			_slots.emplace_back();
+		}
+
+		auto& slot = _slots[index];
+		slot.Value = value;
+		slot.NextFree = NoSlot;
+		++_count;
+		return slot.Generation << IndexBits | index;
+	}
+
+	// The release frees what the value points to; it runs here, or on the thread that drops the
+	// last pin on the entry.
+	bool Remove(const Handle handle, Release release = {}) {
+		{
+			std::unique_lock lock(_mutex);
+			const auto slot = Find(handle);
+			if (!slot)
+				return false;
+
+			slot->Value = nullptr;
+			slot->Generation = slot->Generation == GenerationMask ? 1 : slot->Generation + 1;
+			--_count;
+			if (slot->Pins.load(std::memory_order_acquire) > 0) {
+				slot->PendingRelease = std::move(release);
+				slot->Retired = true;
+				return true;
+			}
+			Free((uint32_t)(handle & IndexMask));
+		}
+
+		if (release)
+			release();
+		return true;
+	}
+
+	// Points a live handle at another value, keeping its generation.
+	bool Replace(const Handle handle, T* value) {
+		std::unique_lock lock(_mutex);
+		const auto slot = Find(handle);
+		if (!slot)
+			return false;
+
+		slot->Value = value;
+		return true;
+	}
+
+	[[nodiscard]] T* Get(const Handle handle) const {
+		std::shared_lock lock(_mutex);
+		const auto slot = Find(handle);
+		return slot ? slot->Value : nullptr;
+	}
+
+	template <typename U = T>
+	[[nodiscard]] Pinned<U> Pin(const Handle handle) {
+		std::shared_lock lock(_mutex);
+		const auto slot = Find(handle);
+		if (!slot)
+			return {};
+
+		slot->Pins.fetch_add(1, std::memory_order_relaxed);
+		return { this, (uint32_t)(handle & IndexMask), static_cast<U*>(slot->Value) };
+	}
+
+	[[nodiscard]] size_t GetCount() const {
+		std::shared_lock lock(_mutex);
+		return _count;
+	}
+
+private:
+	static constexpr int IndexBits = sizeof(Handle) == 8 ? 32 : 20;
+	static constexpr Handle IndexMask = ((Handle)1 << IndexBits) - 1;
+	static constexpr Handle GenerationMask = ~(Handle)0 >> IndexBits;
+	static constexpr uint32_t NoSlot = UINT32_MAX;
+
+	struct Slot {
+		T* Value = nullptr;
+		Handle Generation = 1;
+		uint32_t NextFree = NoSlot;
+		std::atomic<uint32_t> Pins = 0;
+		bool Retired = false;
+		Release PendingRelease;
+
+		Slot() = default;
+
+		// Slots only move while the table is locked exclusively, when no pin can change.
+		Slot(Slot&& other) noexcept
+			: Value(other.Value), Generation(other.Generation), NextFree(other.NextFree),
+			Pins(other.Pins.load(std::memory_order_relaxed)), Retired(other.Retired),
+			PendingRelease(std::move(other.PendingRelease)) {}
+	};
+
+	mutable std::shared_mutex _mutex;
+	std::vector<Slot> _slots;
+	uint32_t _freeHead = NoSlot;
+	size_t _count = 0;
+
+	void Free(const uint32_t index) {
+		_slots[index].NextFree = _freeHead;
+		_freeHead = index;
+	}
+
+	void Unpin(const uint32_t index) {
+		{
+			std::shared_lock lock(_mutex);
+			auto& slot = _slots[index];
+			if (slot.Pins.fetch_sub(1, std::memory_order_acq_rel) != 1 || !slot.Retired)
+				return;
+		}
+
+		// The entry was removed while pinned and this was its last pin; nothing can pin it again.
+		Release release;
+		{
+			std::unique_lock lock(_mutex);
+			auto& slot = _slots[index];
+			release = std::move(slot.PendingRelease);
+			slot.PendingRelease = nullptr;
+			slot.Retired = false;
+			Free(index);
+		}
+
+		if (release)
+			release();
+	}
+
+	Slot* Find(const Handle handle) const {
+		const auto index = handle & IndexMask;
+		if (index >= _slots.size())
+			return nullptr;
+
+		const auto& slot = _slots[index];
+		return slot.Value && slot.Generation == handle >> IndexBits ? const_cast<Slot*>(&slot) : nullptr;
+	}
+};
+
+}
+
+#endif // !GLUINO_HANDLE_TABLE_H
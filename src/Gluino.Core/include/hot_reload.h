@@ -0,0 +1,50 @@
+#pragma once
+
+#ifndef GLUINO_HOT_RELOAD_H
+#define GLUINO_HOT_RELOAD_H
+
+#include "file_watcher.h"
+#include "registry.h"
+#include "vfs.h"
+
+namespace Gluino {
+
+class HotReload {
+public:
+	HotReload(Vfs* vfs, const DirectoryLayer* layer);
+	~HotReload();
+
+	HotReload(const HotReload&) = delete;
+	HotReload& operator=(const HotReload&) = delete;
+
+	// Fails once the watched layer or its file system has been removed.
+	bool Start();
+	void Stop();
+
+	// Subscribers are kept by handle and dropped once their window or webview has closed.
+	void Subscribe(WindowHandle window, WebViewHandle webView);
+	void Unsubscribe(WebViewHandle webView);
+
+	// Stops the hot reloads watching the layer, or every layer of the file system when null,
+	// and unlinks them. Called by the file system before the layer or itself goes away.
+	static void Release(Vfs* vfs, const VfsLayer* layer);
+
+private:
+	struct Subscriber {
+		WindowHandle Window;
+		WebViewHandle WebView;
+	};
+
+	// Guarded by the shared link lock, which is held while the watcher starts and stops.
+	Vfs* _vfs;
+	const VfsLayer* _layer;
+	FileWatcher _watcher;
+	std::mutex _mutex;
+	std::vector<Subscriber> _subscribers;
+
+	void OnChanged(const std::vector<std::string>& paths, bool overflow);
+};
+
+}
+
+#endif // !GLUINO_HOT_RELOAD_H
@@ -0,0 +1,52 @@
+#pragma once
+
+#ifndef GLUINO_IDLE_SCHEDULER_H
+#define GLUINO_IDLE_SCHEDULER_H
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace Gluino {
+
+// Low-priority work that the UI loop runs only while it has nothing else to do.
+// Tasks may be posted and cancelled from any thread and run on the loop's thread. A task
+// receives the deadline of the current slice and returns true if it has more work, in which
+// case it is resumed in a later idle period.
+class IdleScheduler {
+public:
+	using Clock = std::chrono::steady_clock;
+	using Task = std::function<bool(Clock::time_point deadline)>;
+
+	int Post(Task task);
+	bool Cancel(int id);
+
+	[[nodiscard]] bool HasWork() const { return _count.load(std::memory_order_acquire) > 0; }
+
+	bool RunSlice(const std::function<bool()>& shouldYield);
+
+	void SetBudget(Clock::duration budget);
+	[[nodiscard]] Clock::duration GetBudget() const;
+
+	static constexpr Clock::duration DefaultBudget = std::chrono::milliseconds(4);
+
+private:
+	struct Entry {
+		int Id;
+		Task Run;
+	};
+
+	std::mutex _mutex;
+	std::deque<Entry> _tasks;
+	std::atomic<size_t> _count = 0;
+	std::atomic<Clock::rep> _budget = DefaultBudget.count();
+	int _nextId = 1;
+	int _runningId = 0;
+	bool _runningCancelled = false;
+};
+
+}
+
+#endif // !GLUINO_IDLE_SCHEDULER_H
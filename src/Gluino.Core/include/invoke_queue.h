@@ -0,0 +1,47 @@
+#pragma once
+
+#ifndef GLUINO_INVOKE_QUEUE_H
+#define GLUINO_INVOKE_QUEUE_H
+
+#include <atomic>
+#include <functional>
+
+namespace Gluino {
+
+class InvokeQueue {
+public:
+	InvokeQueue();
+	~InvokeQueue();
+
+	InvokeQueue(const InvokeQueue&) = delete;
+	InvokeQueue& operator=(const InvokeQueue&) = delete;
+
+	bool Push(std::function<void()> task);
+	bool Drain(size_t limit = MaxBatchSize);
+
+	// Safe to call from any thread.
+	[[nodiscard]] bool IsEmpty() const;
+
+	static constexpr size_t MaxBatchSize = 4096;
+
+private:
+	struct Node {
+		std::atomic<Node*> Next = nullptr;
+		std::function<void()> Task;
+	};
+
+	alignas(64) std::atomic<Node*> _head;
+	alignas(64) Node* _tail;
+	Node _stub;
+	std::atomic<bool> _wakePending = false;
+	// Counted before a task is linked and after it has run, so it never reads as empty while
+	// a task is queued. The consumer-side tail is not safe to read from other threads.
+	std::atomic<size_t> _pending = 0;
+
+	void Enqueue(Node* node);
+	Node* Dequeue();
+};
+
+}
+
+#endif // !GLUINO_INVOKE_QUEUE_H
@@ -0,0 +1,105 @@
+#pragma once
+
+#ifndef GLUINO_LOOPBACK_SERVER_H
+#define GLUINO_LOOPBACK_SERVER_H
+
+#include "resource_router.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+#include <unordered_map>
+
+namespace Gluino {
+
+struct LoopbackRequest {
+	const char* Method;
+	const char* Path;
+	const char* Headers;
+	const void* Body;
+	int BodyLength;
+};
+
+struct LoopbackResponse {
+	int StatusCode = 404;
+	std::string ContentType;
+	std::vector<char> Body;
+};
+
+typedef void (*LoopbackRequestDelegate)(const LoopbackRequest*, LoopbackResponse*);
+typedef void (*LoopbackSocketDelegate)(int connectionId, const char* path);
+typedef void (*LoopbackMessageDelegate)(int connectionId, const void* data, int size, bool binary);
+typedef void (*LoopbackCloseDelegate)(int connectionId);
+
+struct LoopbackServerEvents {
+	LoopbackRequestDelegate* OnRequest;
+	LoopbackSocketDelegate* OnSocketOpen;
+	LoopbackMessageDelegate* OnSocketMessage;
+	LoopbackCloseDelegate* OnSocketClose;
+};
+
+class LoopbackServer {
+public:
+	explicit LoopbackServer(const LoopbackServerEvents* events);
+	~LoopbackServer();
+
+	LoopbackServer(const LoopbackServer&) = delete;
+	LoopbackServer& operator=(const LoopbackServer&) = delete;
+
+	bool Start();
+	void Stop();
+
+	[[nodiscard]] int GetPort() const { return _port; }
+	[[nodiscard]] const std::string& GetToken() const { return _token; }
+	[[nodiscard]] std::string GetBaseUrl() const;
+
+	ResourceRouter* GetResourceRouter() { return &_resourceRouter; }
+
+	bool Send(int connectionId, const void* data, size_t size, bool binary);
+	void Close(int connectionId);
+
+	static constexpr size_t MaxHeaderSize = 64 * 1024;
+	static constexpr size_t MaxBodySize = 256 * 1024 * 1024;
+	static constexpr size_t MaxConnections = 64;
+
+private:
+	struct Connection {
+		intptr_t Socket;
+		std::mutex SendMutex;
+		std::atomic<bool> IsWebSocket = false;
+	};
+
+	struct HttpRequest;
+
+	LoopbackRequestDelegate _onRequest;
+	LoopbackSocketDelegate _onSocketOpen;
+	LoopbackMessageDelegate _onSocketMessage;
+	LoopbackCloseDelegate _onSocketClose;
+
+	ResourceRouter _resourceRouter;
+
+	intptr_t _listenSocket = -1;
+	int _port = 0;
+	std::string _token;
+	std::thread _acceptThread;
+	std::atomic<bool> _running = false;
+
+	std::mutex _mutex;
+	std::condition_variable _cv;
+	std::unordered_map<int, std::shared_ptr<Connection>> _connections;
+	int _nextConnectionId = 1;
+	size_t _activeConnections = 0;
+
+	void Accept(intptr_t listenSocket);
+	void Serve(int connectionId, std::shared_ptr<Connection> connection);
+	bool ServeRequest(int connectionId, Connection& connection, std::string& buffer);
+	bool ServeHttp(Connection& connection, const HttpRequest& request);
+	void ServeWebSocket(int connectionId, Connection& connection, const HttpRequest& request, std::string buffer);
+
+	static bool SendContent(Connection& connection, const ResourceResult& result);
+	static bool SendAll(Connection& connection, const char* data, size_t size);
+};
+
+}
+
+#endif // !GLUINO_LOOPBACK_SERVER_H
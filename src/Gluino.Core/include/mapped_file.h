@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef GLUINO_MAPPED_FILE_H
+#define GLUINO_MAPPED_FILE_H
+
+#include "resource.h"
+
+namespace Gluino {
+
+class MappedFile {
+public:
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	static std::shared_ptr<MappedFile> Open(const std::string& path);
+
+	[[nodiscard]] const char* GetData() const { return _data; }
+	[[nodiscard]] size_t GetSize() const { return _size; }
+
+#ifndef _WIN32
+	// Files up to this size are read into memory rather than mapped.
+	static constexpr size_t CopyThreshold = 16 * 1024 * 1024;
+#endif
+
+private:
+	MappedFile() = default;
+
+	const char* _data = nullptr;
+	size_t _size = 0;
+#ifdef _WIN32
+	void* _hFile = nullptr;
+	void* _hMapping = nullptr;
+#else
+	int _fd = -1;
+	std::vector<char> _copy;
+#endif
+};
+
+class MappedBlob final : public ResourceBlob {
+public:
+	MappedBlob(std::shared_ptr<MappedFile> file, const size_t offset, const size_t size)
+		: _file(std::move(file)), _offset(offset), _size(size) {}
+
+	[[nodiscard]] const char* GetData() const override { return _file->GetData() + _offset; }
+	[[nodiscard]] size_t GetSize() const override { return _size; }
+
+private:
+	std::shared_ptr<MappedFile> _file;
+	size_t _offset;
+	size_t _size;
+};
+
+// A file read through its handle on demand rather than mapped. On POSIX, touching a shared
+// mapping past the end of a file truncated under it raises SIGBUS, and log rotation or an editor
+// saving in place does exactly that; a read here only comes up short.
+class FileBlob final : public ResourceBlob {
+public:
+	~FileBlob() override;
+
+	FileBlob(const FileBlob&) = delete;
+	FileBlob& operator=(const FileBlob&) = delete;
+
+	static std::shared_ptr<FileBlob> Open(const std::string& path);
+
+	[[nodiscard]] const char* GetData() const override { return nullptr; }
+	[[nodiscard]] size_t GetSize() const override { return _size; }
+	size_t Read(size_t offset, char* buffer, size_t count) const override;
+
+	// Whether the file no longer has the size it had when it was opened.
+	[[nodiscard]] bool IsResized() const;
+
+private:
+	FileBlob() = default;
+
+	size_t _size = 0;
+#ifdef _WIN32
+	void* _hFile = nullptr;
+#else
+	int _fd = -1;
+#endif
+};
+
+}
+
+#endif // !GLUINO_MAPPED_FILE_H
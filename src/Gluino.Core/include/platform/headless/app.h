@@ -0,0 +1,49 @@
+#pragma once
+
+#ifndef GLUINO_APP_H
+#define GLUINO_APP_H
+
+#include "app_base.h"
+#include "window.h"
+#include "webview.h"
+#include "ui_thread.h"
+
+#include <atomic>
+#include <memory>
+
+namespace Gluino {
+
+// The app's loop without a display: it waits on the wake handle and the timer wheel alone,
+// so posted work, timers, idle tasks and event delivery behave as they do on a native loop.
+class App final : public AppBase {
+public:
+	explicit App(char* appId);
+	~App() override;
+
+	static bool Initialize(const char*) { return true; }
+
+	void Run() override;
+	bool RunOnce(int timeout) override;
+	void Exit() override;
+
+	bool HasPendingWork() override;
+	[[nodiscard]] autostr GetAppId() const { return _appId; }
+
+	static void NotifyDestroy(Window* window);
+
+protected:
+	WindowBase* NewWindowPair(
+		WindowOptions* windowOptions, WindowEvents* windowEvents,
+		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+		UiThreadBase* thread, WebViewBase** webView) override;
+	void OnWindowCreated(WindowBase* window, UiThreadBase* thread) override;
+	std::unique_ptr<UiThreadBase> NewUiThread() override;
+
+private:
+	char* _appId;
+	std::atomic<bool> _exiting = false;
+};
+
+}
+
+#endif // !GLUINO_APP_H
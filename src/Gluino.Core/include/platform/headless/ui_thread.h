@@ -0,0 +1,43 @@
+#pragma once
+
+#ifndef GLUINO_UI_THREAD_H
+#define GLUINO_UI_THREAD_H
+
+#include "ui_thread_base.h"
+#include "wake_handle.h"
+#include "registry.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Gluino {
+
+class UiThread final : public UiThreadBase {
+public:
+	UiThread();
+	~UiThread() override;
+
+	[[nodiscard]] bool IsCurrent() const override { return std::this_thread::get_id() == _threadId; }
+	void Stop() override;
+
+	void AddWindow(WindowHandle window);
+
+protected:
+	void Wake() override;
+
+private:
+	std::thread _thread;
+	std::thread::id _threadId;
+	WakeHandle _wakeHandle;
+	std::vector<WindowHandle> _windows;
+	bool _running = true;
+
+	std::atomic<bool> _stopping = false;
+
+	void Run(std::promise<void>* ready);
+};
+
+}
+
+#endif // !GLUINO_UI_THREAD_H
@@ -0,0 +1,70 @@
+#pragma once
+
+#ifndef GLUINO_WEBVIEW_H
+#define GLUINO_WEBVIEW_H
+
+#include "webview_base.h"
+#include "window.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace Gluino {
+
+// A webview with no browser behind it. Navigations load their document through the resource
+// pipeline and commit on the window's loop. The page is scripted from outside: the Page calls
+// post messages and issue requests as page script would, and a page handler receives what the
+// host sends.
+class WebView final : public WebViewBase {
+public:
+	using PageHandler = std::function<void(const std::string& message)>;
+
+	explicit WebView(WebViewOptions* options, const WebViewEvents* events) : WebViewBase(options, events) {}
+	~WebView() override;
+
+	void Focus() const {}
+	void Close();
+
+	[[nodiscard]] bool IsCreated() const override { return _window != nullptr; }
+
+	void Attach(WindowBase* window) override;
+	void Navigate(autostr url) override;
+	void NativateToString(autostr content) override;
+	void InjectScript(autostr script, bool onDocumentCreated) override;
+
+	bool GetContextMenuEnabled() override;
+	void SetContextMenuEnabled(bool enabled) override;
+
+	bool GetDevToolsEnabled() override;
+	void SetDevToolsEnabled(bool enabled) override;
+
+	autostr GetUserAgent() override;
+	void SetUserAgent(autostr userAgent) override;
+
+	void PagePostMessage(std::string message);
+	bool PageFetch(const ResourceQuery& query, ResourceResult* result);
+	void SetPageHandler(PageHandler handler) { _pageHandler = std::move(handler); }
+	[[nodiscard]] const std::string& GetPageUrl() const { return _pageUrl; }
+
+	static constexpr auto DefaultUserAgent = "Gluino Headless";
+
+protected:
+	void SendWebMessage(autostr message) override;
+	void ApplyThrottleLevel(ThrottleLevel) override {}
+	void ApplyVisible(bool) override {}
+	void ApplyBounds() override {}
+
+private:
+	Window* _window = nullptr;
+
+	std::string _pageUrl;
+	PageHandler _pageHandler;
+	int _navigationId = 0;
+
+	void Load(std::string url, bool fetch);
+};
+
+}
+
+#endif // !GLUINO_WEBVIEW_H
@@ -0,0 +1,126 @@
+#pragma once
+
+#ifndef GLUINO_WINDOW_H
+#define GLUINO_WINDOW_H
+
+#include "window_base.h"
+#include "geometry_coalescer.h"
+
+#include <atomic>
+#include <functional>
+
+namespace Gluino {
+
+class WebView;
+
+// A window with no display behind it. Geometry, state and focus are kept here and change
+// immediately, raising the same events as a native window would; work posted to it runs on
+// the loop that created it, and changes made from another thread wait for that loop.
+class Window final : public WindowBase {
+public:
+	using LoopDispatch = std::function<void(std::function<void()>)>;
+
+	explicit Window(WindowOptions* options, const WindowEvents* events, WebView* webView, LoopDispatch dispatch);
+	~Window() override;
+
+	WebView* GetWebView() const { return (WebView*)_webViews.GetPrimary(); }
+
+	void Adopt(WindowOptions* options, const WindowEvents* events) override;
+
+	void Show() override;
+	void Hide() override;
+	void Close() override;
+	void Center() override;
+	void DragMove() override;
+
+	// Destroys the window without asking the host, as when its UI thread is stopped.
+	void Destroy();
+
+	// Simulates the user moving keyboard focus to or away from the window.
+	void SetFocused(bool focused);
+
+	void GetBounds(Rect* bounds) override;
+	bool GetIsDarkMode() override;
+
+	autostr GetTitle() override;
+	void SetTitle(autostr title) override;
+
+	void GetIcon(void** data, int* size) override;
+	void SetIcon(void* data, int size) override;
+
+	WindowBorderStyle GetBorderStyle() override;
+	void SetBorderStyle(WindowBorderStyle style) override;
+
+	WindowState GetWindowState() override;
+	void SetWindowState(WindowState state) override;
+
+	WindowTheme GetTheme() override;
+	void SetTheme(WindowTheme theme) override;
+
+	Size GetMinimumSize() override;
+	void SetMinimumSize(Size& size) override;
+
+	Size GetMaximumSize() override;
+	void SetMaximumSize(Size& size) override;
+
+	Size GetSize() override;
+	void SetSize(Size& size) override;
+
+	Point GetLocation() override;
+	void SetLocation(Point& location) override;
+
+	bool GetMinimizeEnabled() override;
+	void SetMinimizeEnabled(bool enabled) override;
+
+	bool GetMaximizeEnabled() override;
+	void SetMaximizeEnabled(bool enabled) override;
+
+	bool GetTopMost() override;
+	void SetTopMost(bool topMost) override;
+
+	void ApplyChanges(const WindowChangeSet& changes) override;
+
+	WebViewBase* AddWebView(WebViewOptions* options, const WebViewEvents* events) override;
+	bool RemoveWebView(WebViewBase* webView) override;
+
+	int GetGeometryEventInterval() const { return _geometryEventInterval; }
+	void SetGeometryEventInterval(int interval);
+
+	// The screen every headless window is placed on.
+	static constexpr Rect WorkArea = { 0, 0, 1920, 1080 };
+
+protected:
+	void Wake() override;
+	void RestackWebViews() override {}
+
+private:
+	LoopDispatch _dispatch;
+
+	Rect _normalBounds;
+	WindowState _windowState;
+	WindowState _startState;
+	Size _minSize;
+	Size _maxSize;
+	bool _minimizeEnabled;
+	bool _maximizeEnabled;
+	bool _topMost;
+	bool _visible;
+	bool _focused;
+	std::atomic<bool> _destroyed;
+
+	GeometryCoalescer _geometry;
+	int _geometryEventInterval;
+	int _geometryTimer;
+	bool _deferEvents;
+
+	bool Forward(const std::function<void()>& task);
+	void SetNormalBounds(Rect bounds);
+	void UpdateState(WindowState state);
+	void UpdateSnapshot();
+	void QueueGeometry(bool due);
+	void DeliverGeometry(const GeometryUpdate& update);
+};
+
+}
+
+#endif // !GLUINO_WINDOW_H
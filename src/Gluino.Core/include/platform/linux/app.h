@@ -0,0 +1,56 @@
+#pragma once
+
+#ifndef GLUINO_APP_H
+#define GLUINO_APP_H
+
+#include "app_base.h"
+#include "window.h"
+#include "webview.h"
+#include "ui_thread.h"
+#include "loop_source.h"
+
+#include <gtk/gtk.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace Gluino {
+
+class App final : public AppBase {
+public:
+	explicit App(char* appId);
+	~App() override;
+
+	// Initialises GTK on the calling thread, which becomes the app's loop; false without a display.
+	static bool Initialize(const char* appId);
+
+	void Run() override;
+	bool RunOnce(int timeout) override;
+	void Exit() override;
+
+	bool HasPendingWork() override;
+	[[nodiscard]] autostr GetAppId() const { return _appId; }
+
+	static void NotifyDestroy(Window* window);
+
+	static constexpr int MaxEventsPerRun = 1024;
+
+protected:
+	WindowBase* NewWindowPair(
+		WindowOptions* windowOptions, WindowEvents* windowEvents,
+		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+		UiThreadBase* thread, WebViewBase** webView) override;
+	void OnWindowCreated(WindowBase* window, UiThreadBase* thread) override;
+	std::unique_ptr<UiThreadBase> NewUiThread() override;
+	void ReleaseUiThread(std::unique_ptr<UiThreadBase> thread) override;
+
+private:
+	char* _appId;
+	std::thread::id _threadId;
+	std::unique_ptr<LoopSource> _loopSource;
+	std::atomic<bool> _exiting = false;
+};
+
+}
+
+#endif // !GLUINO_APP_H
@@ -0,0 +1,47 @@
+#pragma once
+
+#ifndef GLUINO_UI_THREAD_H
+#define GLUINO_UI_THREAD_H
+
+#include "ui_thread_base.h"
+#include "wake_handle.h"
+#include "loop_source.h"
+#include "registry.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Gluino {
+
+// GTK may only be used from the thread that initialised it, so a UI thread on Linux is a
+// separate queue and timer wheel driven by the GTK main context rather than a thread of its
+// own. Its windows are still created, driven and destroyed only through it.
+class UiThread final : public UiThreadBase {
+public:
+	explicit UiThread(std::thread::id threadId);
+	~UiThread() override;
+
+	[[nodiscard]] bool IsCurrent() const override { return std::this_thread::get_id() == _threadId; }
+	void Stop() override;
+
+	void AddWindow(WindowHandle window);
+
+protected:
+	void Wake() override;
+
+private:
+	std::thread::id _threadId;
+	WakeHandle _wakeHandle;
+	std::unique_ptr<LoopSource> _loopSource;
+	std::vector<WindowHandle> _windows;
+
+	std::atomic<bool> _stopping = false;
+
+	void DestroyWindows();
+};
+
+}
+
+#endif // !GLUINO_UI_THREAD_H
@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef GLUINO_WEBVIEW_H
+#define GLUINO_WEBVIEW_H
+
+#include "webview_base.h"
+#include "window.h"
+
+#include <memory>
+
+#include <webkit2/webkit2.h>
+
+namespace Gluino {
+
+class WebView final : public WebViewBase {
+public:
+	explicit WebView(WebViewOptions* options, const WebViewEvents* events) : WebViewBase(options, events) {}
+	~WebView() override;
+
+	GtkWidget* GetWidget() const { return (GtkWidget*)_webview; }
+	void Focus() const;
+	void Close();
+
+	[[nodiscard]] bool IsCreated() const override { return _webview != nullptr; }
+
+	void Attach(WindowBase* window) override;
+	void Navigate(autostr url) override;
+	void NativateToString(autostr content) override;
+	void InjectScript(autostr script, bool onDocumentCreated) override;
+
+	bool GetContextMenuEnabled() override;
+	void SetContextMenuEnabled(bool enabled) override;
+
+	bool GetDevToolsEnabled() override;
+	void SetDevToolsEnabled(bool enabled) override;
+
+	autostr GetUserAgent() override;
+	void SetUserAgent(autostr userAgent) override;
+
+protected:
+	void SendWebMessage(autostr message) override;
+	void ApplyThrottleLevel(ThrottleLevel level) override;
+	void ApplyVisible(bool visible) override;
+	void ApplyBounds() override;
+	void ApplySettings() override;
+	void OnMount(const std::string& prefix) override;
+
+private:
+	Window* _window = nullptr;
+	WebKitWebView* _webview = nullptr;
+	WebKitSettings* _settings = nullptr;
+	WebKitUserContentManager* _contentManager = nullptr;
+
+	void HandleSchemeRequest(WebKitURISchemeRequest* request);
+
+	static WebKitWebContext* GetWebContext();
+	static void RegisterScheme(const char* url);
+
+	static void OnSchemeRequest(WebKitURISchemeRequest* request, gpointer data);
+	static void OnLoadChanged(WebKitWebView* webview, WebKitLoadEvent loadEvent, gpointer data);
+	static void OnScriptMessage(WebKitUserContentManager* manager, WebKitJavascriptResult* result, gpointer data);
+	static gboolean OnContextMenu(WebKitWebView* webview, WebKitContextMenu* menu, GdkEvent* event, WebKitHitTestResult* hit, gpointer data);
+	static gboolean OnPermissionRequest(WebKitWebView* webview, WebKitPermissionRequest* request, gpointer data);
+};
+
+}
+
+#endif // !GLUINO_WEBVIEW_H
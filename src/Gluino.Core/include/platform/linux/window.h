@@ -0,0 +1,130 @@
+#pragma once
+
+#ifndef GLUINO_WINDOW_H
+#define GLUINO_WINDOW_H
+
+#include "window_base.h"
+#include "geometry_coalescer.h"
+#include "wake_handle.h"
+#include "loop_source.h"
+
+#include <gtk/gtk.h>
+#include <memory>
+
+namespace Gluino {
+
+class WebView;
+
+class Window final : public WindowBase {
+public:
+	explicit Window(WindowOptions* options, const WindowEvents* events, WebView* webView);
+	~Window() override;
+
+	GtkWindow* GetHandle() const { return _window; }
+	GtkOverlay* GetOverlay() const { return _overlay; }
+	WebView* GetWebView() const { return (WebView*)_webViews.GetPrimary(); }
+
+	void Adopt(WindowOptions* options, const WindowEvents* events) override;
+
+	void Show() override;
+	void Hide() override;
+	void Close() override;
+	void Center() override;
+	void DragMove() override;
+
+	// Destroys the window without asking the host, as when its UI thread is stopped.
+	void Destroy();
+
+	void GetBounds(Rect* bounds) override;
+	bool GetIsDarkMode() override;
+
+	autostr GetTitle() override;
+	void SetTitle(autostr title) override;
+
+	void GetIcon(void** data, int* size) override;
+	void SetIcon(void* data, int size) override;
+
+	WindowBorderStyle GetBorderStyle() override;
+	void SetBorderStyle(WindowBorderStyle style) override;
+
+	WindowState GetWindowState() override;
+	void SetWindowState(WindowState state) override;
+
+	WindowTheme GetTheme() override;
+	void SetTheme(WindowTheme theme) override;
+
+	Size GetMinimumSize() override;
+	void SetMinimumSize(Size& size) override;
+
+	Size GetMaximumSize() override;
+	void SetMaximumSize(Size& size) override;
+
+	Size GetSize() override;
+	void SetSize(Size& size) override;
+
+	Point GetLocation() override;
+	void SetLocation(Point& location) override;
+
+	bool GetMinimizeEnabled() override;
+	void SetMinimizeEnabled(bool enabled) override;
+
+	bool GetMaximizeEnabled() override;
+	void SetMaximizeEnabled(bool enabled) override;
+
+	bool GetTopMost() override;
+	void SetTopMost(bool topMost) override;
+
+	void ApplyChanges(const WindowChangeSet& changes) override;
+
+	WebViewBase* AddWebView(WebViewOptions* options, const WebViewEvents* events) override;
+	bool RemoveWebView(WebViewBase* webView) override;
+
+	int GetGeometryEventInterval() const { return _geometryEventInterval; }
+	void SetGeometryEventInterval(int interval);
+
+protected:
+	void Wake() override;
+	void RestackWebViews() override;
+
+private:
+	GtkWindow* _window;
+	GtkOverlay* _overlay;
+	WakeHandle _wakeHandle;
+	std::unique_ptr<LoopSource> _loopSource;
+	gulong _themeHandler;
+
+	WindowState _windowState;
+	Size _minSize;
+	Size _maxSize;
+	bool _minimizeEnabled;
+	bool _maximizeEnabled;
+	bool _topMost;
+	bool _destroyed;
+
+	GeometryCoalescer _geometry;
+	int _geometryEventInterval;
+	guint _geometryTimer;
+	bool _deferEvents;
+
+	void UpdateCaptionButtons();
+	void UpdateGeometryHints();
+	void UpdateSnapshot();
+	void QueueGeometry(bool due);
+	void DeliverGeometry(const GeometryUpdate& update);
+
+	static gboolean OnDeleteEvent(GtkWidget* widget, GdkEvent* event, gpointer data);
+	static void OnDestroy(GtkWidget* widget, gpointer data);
+	static gboolean OnConfigureEvent(GtkWidget* widget, GdkEventConfigure* event, gpointer data);
+	static gboolean OnWindowStateEvent(GtkWidget* widget, GdkEventWindowState* event, gpointer data);
+	static gboolean OnFocusInEvent(GtkWidget* widget, GdkEventFocus* event, gpointer data);
+	static gboolean OnFocusOutEvent(GtkWidget* widget, GdkEventFocus* event, gpointer data);
+	static void OnShow(GtkWidget* widget, gpointer data);
+	static void OnHide(GtkWidget* widget, gpointer data);
+	static void OnRealize(GtkWidget* widget, gpointer data);
+	static void OnThemeChanged(GObject* settings, GParamSpec* pspec, gpointer data);
+	static gboolean OnGeometryTimer(gpointer data);
+};
+
+}
+
+#endif // !GLUINO_WINDOW_H
@@ -14,7 +14,6 @@ class Window final : public WindowBase {
     void Show() override;
     void Hide() override;
     void Close() override;
-    void Invoke(Delegate action) override;
 
     void GetBounds(Rect* bounds) override;
 
@@ -42,6 +41,11 @@ class Window final : public WindowBase {
     bool GetTopMost() override;
     void SetTopMost(bool topMost) override;
 
+    void ApplyChanges(const WindowChangeSet& changes) override;
+
+protected:
+    void Wake() override;
+
 private:
     
 };
@@ -7,8 +7,11 @@
 #include "app_base.h"
 #include "window.h"
 #include "webview.h"
+#include "ui_thread.h"
+#include "loop_timer.h"
 
 #include <Windows.h>
+#include <memory>
 
 #pragma comment(lib, "Dwmapi.lib")
 
@@ -21,22 +24,37 @@ public:
 	explicit App(HINSTANCE hInstance, wchar_t* appId);
 	~App() override;
 
-	void SpawnWindow(
-		WindowOptions* windowOptions, WindowEvents* windowEvents,
-		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
-		WindowBase** window, WebViewBase** webView) override;
-	void DespawnWindow(WindowBase* window) override;
 	void Run() override;
+	bool RunOnce(int timeout) override;
 	void Exit() override;
 
+	bool HasPendingWork() override;
+	[[nodiscard]] autostr GetAppId() const { return _appId; }
+
 	static HINSTANCE GetHInstance();
 	static wchar_t* GetWndClassName();
+	static void NotifyWake(HWND hWnd);
 	static LRESULT CALLBACK WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
+	static constexpr int MaxMessagesPerRun = 1024;
+
+protected:
+	WindowBase* NewWindowPair(
+		WindowOptions* windowOptions, WindowEvents* windowEvents,
+		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+		UiThreadBase* thread, WebViewBase** webView) override;
+	void OnWindowCreated(WindowBase* window, UiThreadBase* thread) override;
+	void OnDespawnWindow(WindowBase* window) override;
+	std::unique_ptr<UiThreadBase> NewUiThread() override;
+
 private:
 	HINSTANCE _hInstance;
 	wchar_t* _appId;
 	wchar_t* _wndClassName;
+	DWORD _mainThreadId;
+	LoopTimer _loopTimer;
+
+	void ProcessMessage(const MSG& msg);
 };
 
 }
@@ -0,0 +1,42 @@
+#pragma once
+
+#ifndef GLUINO_UI_THREAD_H
+#define GLUINO_UI_THREAD_H
+
+#include "ui_thread_base.h"
+#include "loop_timer.h"
+
+#include <Windows.h>
+#include <thread>
+
+namespace Gluino {
+
+class UiThread final : public UiThreadBase {
+public:
+	UiThread();
+	~UiThread() override;
+
+	[[nodiscard]] bool IsCurrent() const override { return GetCurrentThreadId() == _threadId; }
+	void Stop() override;
+
+	[[nodiscard]] DWORD GetThreadId() const { return _threadId; }
+
+	static LRESULT CALLBACK WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
+
+protected:
+	void Wake() override;
+
+private:
+	std::thread _thread;
+	DWORD _threadId = 0;
+	HWND _hWnd = nullptr;
+	LoopTimer _loopTimer;
+
+	std::atomic<bool> _stopping = false;
+
+	void Run(std::promise<void>* ready);
+};
+
+}
+
+#endif // !GLUINO_UI_THREAD_H
@@ -13,23 +13,24 @@ namespace Gluino {
 
 class WebView final : public WebViewBase {
 public:
-	explicit WebView(WebViewOptions* options, const WebViewEvents* events) : WebViewBase(options, events) {
-		_contextMenuEnabled = options->ContextMenuEnabled;
-		_devToolsEnabled = options->DevToolsEnabled;
-		_grantPermissions = options->GrantPermissions;
-	}
+	explicit WebView(WebViewOptions* options, const WebViewEvents* events) : WebViewBase(options, events) {}
 	~WebView() override;
 
+	HWND GetHostHandle() const { return _hWndHost; }
 	void Refit(const WindowBorderStyle& borderStyle) const;
 	void Focus() const;
+	void Close();
+
+	[[nodiscard]] bool IsCreated() const override { return _webview != nullptr; }
 
 	void Attach(WindowBase* window) override;
 	void Navigate(autostr url) override;
 	void NativateToString(autostr content) override;
-	void PostWebMessage(autostr message) override;
 	void InjectScript(autostr script, bool onDocumentCreated) override;
 
-	bool GetGrantPermissions() const;
+	// Releases the calling thread's shared environment. Must run before the thread uninitializes
+	// COM, which its thread-local storage would otherwise outlive.
+	static void ReleaseThreadEnvironment();
 
 	bool GetContextMenuEnabled() override;
 	void SetContextMenuEnabled(bool enabled) override;
@@ -40,13 +41,19 @@ public:
 	autostr GetUserAgent() override;
 	void SetUserAgent(autostr userAgent) override;
 
+protected:
+	void SendWebMessage(autostr message) override;
+	void ApplyThrottleLevel(ThrottleLevel level) override;
+	void ApplyVisible(bool visible) override;
+	void ApplyBounds() override;
+	void ApplySettings() override;
+
 private:
 	Window* _window = nullptr;
 	HWND _hWndWnd = nullptr;
-
-	bool _contextMenuEnabled;
-	bool _devToolsEnabled;
-	bool _grantPermissions = false;
+	HWND _hWndHost = nullptr;
+	bool _creatingController = false;
+	bool _closed = false;
 
 	wil::com_ptr<ICoreWebView2>            _webview;
 	wil::com_ptr<ICoreWebView2Environment> _webviewEnv;
@@ -58,10 +65,13 @@ private:
 	HRESULT OnWebView2CreateEnvironmentCompleted(HRESULT result, ICoreWebView2Environment* env);
 	HRESULT OnWebView2CreateControllerCompleted(HRESULT result, ICoreWebView2Controller* controller);
 	HRESULT OnWebView2NavigationStarting(ICoreWebView2* sender, ICoreWebView2NavigationStartingEventArgs* args);
+	HRESULT OnWebView2ContentLoading(ICoreWebView2* sender, ICoreWebView2ContentLoadingEventArgs* args);
 	HRESULT OnWebView2NavigationCompleted(ICoreWebView2* sender, ICoreWebView2NavigationCompletedEventArgs* args);
 	HRESULT OnWebView2WebMessageReceived(ICoreWebView2* sender, ICoreWebView2WebMessageReceivedEventArgs* args);
 	HRESULT OnWebView2WebResourceRequested(ICoreWebView2* sender, ICoreWebView2WebResourceRequestedEventArgs* args);
 	HRESULT OnWebView2PermissionRequested(ICoreWebView2* sender, ICoreWebView2PermissionRequestedEventArgs* args);
+
+	HRESULT PutResourceResponse(ICoreWebView2WebResourceRequestedEventArgs* args, const ResourceResult& result) const;
 };
 
 }
@@ -5,6 +5,7 @@
 
 #include "window_base.h"
 #include "window_frame.h"
+#include "geometry_coalescer.h"
 
 #undef min
 #undef max
@@ -19,14 +20,16 @@ public:
 	~Window() override;
 
 	HWND GetHandle() const { return _hWnd; }
+	WebView* GetWebView() const { return (WebView*)_webViews.GetPrimary(); }
 	LRESULT WndProc(UINT msg, WPARAM wParam, LPARAM lParam);
 
+	void Adopt(WindowOptions* options, const WindowEvents* events) override;
+
 	void Show() override;
 	void Hide() override;
 	void Close() override;
 	void Center() override;
 	void DragMove() override;
-	void Invoke(Delegate action) override;
 
 	void GetBounds(Rect* bounds) override;
 	bool GetIsDarkMode() override;
@@ -67,6 +70,18 @@ public:
 	bool GetTopMost() override;
 	void SetTopMost(bool topMost) override;
 
+	void ApplyChanges(const WindowChangeSet& changes) override;
+
+	WebViewBase* AddWebView(WebViewOptions* options, const WebViewEvents* events) override;
+	bool RemoveWebView(WebViewBase* webView) override;
+
+	int GetGeometryEventInterval() const { return _geometryEventInterval; }
+	void SetGeometryEventInterval(int interval);
+
+protected:
+	void Wake() override;
+	void RestackWebViews() override;
+
 private:
 	HWND _hWnd;
 	WindowFrame* _frame;
@@ -77,7 +92,17 @@ private:
 	bool _minimizeEnabled;
 	bool _maximizeEnabled;
 
-	WebView* _webView;
+	GeometryCoalescer _geometry;
+	int _geometryEventInterval;
+	bool _geometryTimerArmed;
+	bool _deferEvents;
+
+	bool UpdateCaptionButtons();
+	LONG_PTR BuildStyle(WindowBorderStyle borderStyle, LONG_PTR style) const;
+	static bool IsBorderless(WindowBorderStyle style);
+	void UpdateSnapshot();
+	void QueueGeometry(bool due);
+	void DeliverGeometry(const GeometryUpdate& update);
 };
 
 }
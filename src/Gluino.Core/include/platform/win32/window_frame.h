@@ -4,9 +4,10 @@
 #define GLUINO_WINDOW_FRAME_H
 
 #include "common.h"
+#include "handle_table.h"
 
+#include <array>
 #include <Windows.h>
-#include <vector>
 
 namespace Gluino {
 
@@ -19,10 +20,19 @@ public:
 	void Update() const;
 
 private:
+	struct Edge {
+		WindowFrame* Frame;
+		WindowEdge Kind;
+		HWND Handle;
+		HandleTable<Edge>::Handle RegistryHandle;
+	};
+
 	HWND _hWndWindow;
-	std::vector<HWND> _hWndEdges;
+	std::array<Edge, 8> _edges{};
 	bool _isAttached = false;
 
+	static HandleTable<Edge> EdgeRegistry;
+
 	Rect GetEdgeRect(WindowEdge edge) const;
 
 	LRESULT CALLBACK WndFrameEdgeProc(HWND hWnd, WindowEdge edge, UINT msg, WPARAM wParam, LPARAM lParam) const;
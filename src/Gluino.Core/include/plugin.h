@@ -0,0 +1,32 @@
+#pragma once
+
+#ifndef GLUINO_PLUGIN_H
+#define GLUINO_PLUGIN_H
+
+#include "gluino_plugin.h"
+#include "resource.h"
+
+namespace Gluino {
+
+class Plugin final : public ResourceHandler {
+public:
+	~Plugin() override;
+
+	Plugin(const Plugin&) = delete;
+	Plugin& operator=(const Plugin&) = delete;
+
+	static std::unique_ptr<Plugin> Load(const std::string& path, const std::string& options);
+
+	bool HandleRequest(const ResourceQuery& query, std::string_view path, ResourceResult* result) override;
+
+private:
+	struct Module;
+
+	Plugin() = default;
+
+	std::shared_ptr<Module> _module;
+};
+
+}
+
+#endif // !GLUINO_PLUGIN_H
@@ -0,0 +1,42 @@
+#pragma once
+
+#ifndef GLUINO_PREFETCHER_H
+#define GLUINO_PREFETCHER_H
+
+#include "resource_router.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace Gluino {
+
+class Prefetcher {
+public:
+	explicit Prefetcher(ResourceRouter* router) : _router(router) {}
+	~Prefetcher();
+
+	Prefetcher(const Prefetcher&) = delete;
+	Prefetcher& operator=(const Prefetcher&) = delete;
+
+	void SetManifest(const std::string& route, std::vector<std::string> urls);
+	void RemoveManifest(const std::string& route);
+
+	void Prefetch(std::string_view url);
+
+	// Upper bound of the worker pool shared by every prefetcher in the process.
+	static constexpr unsigned MaxWorkers = 4;
+
+private:
+	class Pool;
+
+	ResourceRouter* _router;
+
+	std::mutex _mutex;
+	std::unordered_map<std::string, std::vector<std::string>> _manifests;
+
+	const std::vector<std::string>* FindManifest(std::string_view url) const;
+};
+
+}
+
+#endif // !GLUINO_PREFETCHER_H
@@ -0,0 +1,22 @@
+#pragma once
+
+#ifndef GLUINO_REGISTRY_H
+#define GLUINO_REGISTRY_H
+
+#include "handle_table.h"
+
+namespace Gluino {
+
+class WindowBase;
+class WebViewBase;
+
+typedef HandleTable<WindowBase>::Handle WindowHandle;
+typedef HandleTable<WebViewBase>::Handle WebViewHandle;
+
+// Every spawned window and webview is registered here; the C ABI refers to them only by handle.
+inline HandleTable<WindowBase> WindowRegistry;
+inline HandleTable<WebViewBase> WebViewRegistry;
+
+}
+
+#endif // !GLUINO_REGISTRY_H
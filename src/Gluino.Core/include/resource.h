@@ -0,0 +1,85 @@
+#pragma once
+
+#ifndef GLUINO_RESOURCE_H
+#define GLUINO_RESOURCE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Gluino {
+
+class ResourceBlob {
+public:
+	virtual ~ResourceBlob() = default;
+
+	// The content in memory, or nullptr for a blob that is only read on demand through Read.
+	[[nodiscard]] virtual const char* GetData() const = 0;
+	[[nodiscard]] virtual size_t GetSize() const = 0;
+
+	// Copies up to count bytes from offset into buffer and returns the number copied, which is
+	// less than asked only at the end of the content.
+	virtual size_t Read(size_t offset, char* buffer, size_t count) const;
+};
+
+class MemoryBlob final : public ResourceBlob {
+public:
+	explicit MemoryBlob(std::vector<char> data) : _data(std::move(data)) {}
+
+	[[nodiscard]] const char* GetData() const override { return _data.data(); }
+	[[nodiscard]] size_t GetSize() const override { return _data.size(); }
+
+private:
+	std::vector<char> _data;
+};
+
+struct ResourceQuery {
+	std::string Url;
+	std::string Method;
+	std::string Range;
+	std::string Headers;
+};
+
+struct ResourceResult {
+	int StatusCode = 200;
+	std::string ContentType;
+	std::shared_ptr<const ResourceBlob> Blob;
+	size_t Offset = 0;
+	size_t Length = 0;
+	std::vector<std::pair<std::string, std::string>> Headers;
+
+	[[nodiscard]] std::string GetHeaders() const;
+};
+
+class ResourceRouter;
+
+class ResourceHandler {
+public:
+	virtual ~ResourceHandler();
+
+	virtual bool HandleRequest(const ResourceQuery& query, std::string_view path, ResourceResult* result) = 0;
+	virtual bool Prefetch([[maybe_unused]] std::string_view path) { return false; }
+
+	// Unmounts the handler from every router it is mounted in, waiting for requests they are
+	// routing to it. Every derived handler calls this first thing in its destructor.
+	void Detach();
+
+private:
+	friend class ResourceRouter;
+
+	// One entry per mount point, guarded by the routers' shared mount lock.
+	std::vector<ResourceRouter*> _routers;
+};
+
+const char* GetMimeType(std::string_view path);
+const char* GetReasonPhrase(int statusCode);
+std::string DecodeUrlPath(std::string_view path);
+std::string GenerateToken(size_t length);
+void SetResourceContent(const ResourceQuery& query, std::shared_ptr<const ResourceBlob> blob, ResourceResult* result);
+
+}
+
+#endif // !GLUINO_RESOURCE_H
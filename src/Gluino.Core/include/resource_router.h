@@ -0,0 +1,44 @@
+#pragma once
+
+#ifndef GLUINO_RESOURCE_ROUTER_H
+#define GLUINO_RESOURCE_ROUTER_H
+
+#include "resource.h"
+
+#include <mutex>
+#include <shared_mutex>
+
+namespace Gluino {
+
+class ResourceRouter {
+public:
+	ResourceRouter() = default;
+	~ResourceRouter();
+
+	ResourceRouter(const ResourceRouter&) = delete;
+	ResourceRouter& operator=(const ResourceRouter&) = delete;
+
+	void Mount(const std::string& prefix, ResourceHandler* handler);
+	void Unmount(const std::string& prefix);
+	void Unmount(const ResourceHandler* handler);
+
+	bool Route(const ResourceQuery& query, ResourceResult* result);
+	bool Prefetch(std::string_view url);
+
+private:
+	struct MountPoint {
+		std::string Prefix;
+		ResourceHandler* Handler;
+	};
+
+	friend class ResourceHandler;
+
+	std::shared_mutex _mutex;
+	std::vector<MountPoint> _mounts;
+
+	void Unlink(const MountPoint& mount);
+};
+
+}
+
+#endif // !GLUINO_RESOURCE_ROUTER_H
@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef GLUINO_SEQLOCK_H
+#define GLUINO_SEQLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Gluino {
+
+// Single-writer sequence lock for small trivially copyable values.
+// Readers never block the writer; they retry if a store raced with their copy.
+template <typename T>
+class SeqLock {
+	static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+	SeqLock() : SeqLock(T{}) {}
+
+	explicit SeqLock(const T& value) {
+		Write(value);
+	}
+
+	void Store(const T& value) {
+		const auto sequence = _sequence.load(std::memory_order_relaxed);
+		_sequence.store(sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		Write(value);
+		_sequence.store(sequence + 2, std::memory_order_release);
+	}
+
+	[[nodiscard]] T Load() const {
+		uint64_t words[WordCount];
+		uint32_t before, after;
+
+		do {
+			before = _sequence.load(std::memory_order_acquire);
+			for (size_t i = 0; i < WordCount; ++i)
+				words[i] = _words[i].load(std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_acquire);
+			after = _sequence.load(std::memory_order_relaxed);
+		} while (before != after || before & 1);
+
+		T value;
+		memcpy(&value, words, sizeof(T));
+		return value;
+	}
+
+	[[nodiscard]] uint32_t GetSequence() const {
+		return _sequence.load(std::memory_order_acquire) >> 1;
+	}
+
+private:
+	static constexpr size_t WordCount = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+	std::atomic<uint32_t> _sequence = 0;
+	std::atomic<uint64_t> _words[WordCount];
+
+	void Write(const T& value) {
+		uint64_t words[WordCount] = {};
+		memcpy(words, &value, sizeof(T));
+		for (size_t i = 0; i < WordCount; ++i)
+			_words[i].store(words[i], std::memory_order_relaxed);
+	}
+};
+
+}
+
+#endif // !GLUINO_SEQLOCK_H
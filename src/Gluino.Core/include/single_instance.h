@@ -0,0 +1,62 @@
+#pragma once
+
+#ifndef GLUINO_SINGLE_INSTANCE_H
+#define GLUINO_SINGLE_INSTANCE_H
+
+#include "wake_handle.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Gluino {
+
+// Keeps one process per name and user. The first process to acquire the name listens on a local
+// socket, a named pipe on Windows and a UNIX domain socket elsewhere. Later launches forward
+// their arguments to it and can exit straight away. The callback runs on the listener thread.
+class SingleInstance {
+public:
+	typedef std::function<void(std::vector<std::string> args)> ArgumentsCallback;
+
+	SingleInstance(std::string name, ArgumentsCallback callback);
+	~SingleInstance();
+
+	SingleInstance(const SingleInstance&) = delete;
+	SingleInstance& operator=(const SingleInstance&) = delete;
+
+	// Returns false if a running instance received the arguments, and true if this process is
+	// now the primary instance or the name could not be used at all.
+	bool Acquire(const std::vector<std::string>& args);
+	void Stop();
+
+	static std::string Encode(const std::vector<std::string>& args);
+	static bool Decode(const std::string& data, std::vector<std::string>* args);
+
+	static constexpr auto ConnectTimeout = std::chrono::milliseconds(1000);
+	static constexpr size_t MaxMessageSize = 1024 * 1024;
+
+private:
+	std::string _name;
+	ArgumentsCallback _callback;
+	std::thread _thread;
+	std::atomic<bool> _running = false;
+	WakeHandle _stop;
+
+#ifdef _WIN32
+	void* _hPipe = nullptr;
+#else
+	int _fd = -1;
+	std::string _path;
+#endif
+
+	bool Listen();
+	bool Forward(const std::string& message) const;
+	void Run();
+};
+
+}
+
+#endif // !GLUINO_SINGLE_INSTANCE_H
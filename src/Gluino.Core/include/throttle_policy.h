@@ -0,0 +1,53 @@
+#pragma once
+
+#ifndef GLUINO_THROTTLE_POLICY_H
+#define GLUINO_THROTTLE_POLICY_H
+
+#include <chrono>
+#include <optional>
+
+namespace Gluino {
+
+enum class ThrottleLevel {
+	Active,
+	Throttled,
+	Suspended
+};
+
+// Decides how much work a window may do while the user cannot see it. A hidden or minimized
+// window is throttled straight away and, if a suspend delay is set, its browser is suspended
+// once it has stayed in the background that long. Showing or restoring it makes it active
+// again. Platform-neutral: the window feeds it transitions and applies the returned levels.
+class ThrottlePolicy {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	void SetEnabled(bool enabled, Clock::time_point now);
+	[[nodiscard]] bool GetEnabled() const { return _enabled; }
+
+	// A negative delay never suspends the browser.
+	void SetSuspendDelay(Clock::duration delay, Clock::time_point now);
+	[[nodiscard]] Clock::duration GetSuspendDelay() const { return _suspendDelay; }
+
+	ThrottleLevel SetVisible(bool visible, Clock::time_point now);
+	ThrottleLevel SetMinimized(bool minimized, Clock::time_point now);
+	ThrottleLevel Update(Clock::time_point now);
+
+	[[nodiscard]] ThrottleLevel GetLevel() const { return _level; }
+	[[nodiscard]] std::optional<Clock::time_point> GetDeadline() const;
+
+private:
+	bool _enabled = true;
+	bool _visible = true;
+	bool _minimized = false;
+	Clock::duration _suspendDelay = Clock::duration(-1);
+	Clock::time_point _backgroundSince;
+	ThrottleLevel _level = ThrottleLevel::Active;
+
+	[[nodiscard]] bool IsBackground() const { return _enabled && (!_visible || _minimized); }
+	ThrottleLevel Evaluate(bool wasBackground, Clock::time_point now);
+};
+
+}
+
+#endif // !GLUINO_THROTTLE_POLICY_H
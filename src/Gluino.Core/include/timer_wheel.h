@@ -0,0 +1,91 @@
+#pragma once
+
+#ifndef GLUINO_TIMER_WHEEL_H
+#define GLUINO_TIMER_WHEEL_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Gluino {
+
+// Hierarchical timing wheel driven by a UI loop. Timers may be scheduled and cancelled
+// from any thread; callbacks run on the thread that calls Advance. Deadlines are rounded
+// up to the slack so that nearby timers expire in the same tick and share one wakeup.
+// The timers of a suspended owner keep their deadlines but leave the wheel, so they neither
+// fire nor wake the loop; on resume, the ones that came due in the meantime fire once.
+class TimerWheel {
+public:
+	using Clock = std::chrono::steady_clock;
+	using Callback = std::function<void()>;
+
+	TimerWheel();
+
+	int Schedule(Clock::duration due, Callback callback, Clock::duration period = {}, const void* owner = nullptr);
+	bool Cancel(int id);
+	void CancelAll(const void* owner);
+
+	void Suspend(const void* owner);
+	void Resume(const void* owner);
+
+	size_t Advance(Clock::time_point now);
+
+	[[nodiscard]] std::optional<Clock::time_point> GetNextDeadline();
+	[[nodiscard]] size_t GetCount();
+
+	void SetSlack(Clock::duration slack);
+	[[nodiscard]] Clock::duration GetSlack();
+
+	void SetWakeCallback(std::function<void()> wake) { _wake = std::move(wake); }
+
+	static constexpr Clock::duration Resolution = std::chrono::microseconds(250);
+
+private:
+	static constexpr int LevelBits = 6;
+	static constexpr int Levels = 4;
+	static constexpr uint64_t SlotCount = 1ull << LevelBits;
+	static constexpr uint64_t SlotMask = SlotCount - 1;
+
+	struct Timer {
+		uint64_t Expiry;
+		uint64_t Period;
+		Callback Run;
+		const void* Owner;
+		bool Suspended;
+	};
+
+	struct SlotEntry {
+		int Id;
+		uint64_t Expiry;
+	};
+
+	std::mutex _mutex;
+	Clock::time_point _origin;
+	uint64_t _current = 0;
+	uint64_t _slack = 1;
+	uint64_t _armedExpiry = 0;
+	int _nextId = 1;
+	std::unordered_map<int, Timer> _timers;
+	std::unordered_set<const void*> _suspendedOwners;
+	std::array<std::array<std::vector<SlotEntry>, SlotCount>, Levels> _slots;
+	std::function<void()> _wake;
+
+	[[nodiscard]] uint64_t ToTicks(Clock::time_point time) const;
+	[[nodiscard]] uint64_t ToTicks(Clock::duration duration) const;
+	[[nodiscard]] uint64_t ApplySlack(uint64_t expiry) const;
+
+	void Insert(int id, uint64_t expiry);
+	void Cascade(int level);
+	void Rebuild();
+	std::optional<uint64_t> FindNextExpiry() const;
+};
+
+}
+
+#endif // !GLUINO_TIMER_WHEEL_H
@@ -0,0 +1,62 @@
+#pragma once
+
+#ifndef GLUINO_UI_THREAD_BASE_H
+#define GLUINO_UI_THREAD_BASE_H
+
+#include "invoke_queue.h"
+#include "timer_wheel.h"
+
+#include <future>
+
+namespace Gluino {
+
+// A dedicated UI thread with its own message loop. Windows spawned onto it are
+// created, driven and destroyed on that thread only.
+class UiThreadBase {
+public:
+	UiThreadBase() {
+		_timerWheel.SetWakeCallback([this] { Wake(); });
+	}
+
+	virtual ~UiThreadBase() = default;
+
+	[[nodiscard]] virtual bool IsCurrent() const = 0;
+	virtual void Stop() = 0;
+
+	void Dispatch(std::function<void()> task) {
+		if (_invokeQueue.Push(std::move(task)))
+			Wake();
+	}
+
+	void Invoke(const std::function<void()>& task) {
+		if (IsCurrent()) {
+			task();
+			return;
+		}
+
+		std::promise<void> promise;
+		const auto future = promise.get_future();
+		Dispatch([&task, &promise] {
+			task();
+			promise.set_value();
+		});
+		future.wait();
+	}
+
+	void DrainInvokeQueue() {
+		if (_invokeQueue.Drain())
+			Wake();
+	}
+
+	TimerWheel* GetTimerWheel() { return &_timerWheel; }
+
+protected:
+	InvokeQueue _invokeQueue;
+	TimerWheel _timerWheel;
+
+	virtual void Wake() = 0;
+};
+
+}
+
+#endif // !GLUINO_UI_THREAD_BASE_H
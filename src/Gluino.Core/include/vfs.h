@@ -0,0 +1,140 @@
+#pragma once
+
+#ifndef GLUINO_VFS_H
+#define GLUINO_VFS_H
+
+#include "mapped_file.h"
+#include "resource.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Gluino {
+
+class HotReload;
+class Vfs;
+
+class VfsLayer {
+public:
+	virtual ~VfsLayer() = default;
+
+	virtual std::shared_ptr<const ResourceBlob> Open(const std::string& path) = 0;
+	[[nodiscard]] virtual bool IsResident() const { return false; }
+
+protected:
+	friend class Vfs;
+
+	Vfs* _vfs = nullptr;
+};
+
+class DirectoryLayer final : public VfsLayer {
+public:
+	explicit DirectoryLayer(std::string root);
+
+	std::shared_ptr<const ResourceBlob> Open(const std::string& path) override;
+
+	[[nodiscard]] const std::string& GetRoot() const { return _root; }
+
+private:
+	std::string _root;
+};
+
+class ZipLayer final : public VfsLayer {
+public:
+	static std::unique_ptr<ZipLayer> Load(std::shared_ptr<MappedFile> file);
+
+	std::shared_ptr<const ResourceBlob> Open(const std::string& path) override;
+	[[nodiscard]] bool IsResident() const override { return true; }
+
+private:
+	struct Entry {
+		size_t Offset;
+		size_t CompressedSize;
+		size_t Size;
+		int Method;
+	};
+
+	explicit ZipLayer(std::shared_ptr<MappedFile> file) : _file(std::move(file)) {}
+
+	std::shared_ptr<MappedFile> _file;
+	std::unordered_map<std::string, Entry> _entries;
+};
+
+class PackLayer final : public VfsLayer {
+public:
+	static std::unique_ptr<PackLayer> Load(std::shared_ptr<MappedFile> file);
+	static bool Build(const std::string& directory, const std::string& output);
+
+	std::shared_ptr<const ResourceBlob> Open(const std::string& path) override;
+	[[nodiscard]] bool IsResident() const override { return true; }
+
+private:
+	explicit PackLayer(std::shared_ptr<MappedFile> file) : _file(std::move(file)) {}
+
+	std::shared_ptr<MappedFile> _file;
+	std::unordered_map<std::string, std::pair<size_t, size_t>> _entries;
+};
+
+class OverlayLayer final : public VfsLayer {
+public:
+	std::shared_ptr<const ResourceBlob> Open(const std::string& path) override;
+	[[nodiscard]] bool IsResident() const override { return true; }
+
+	void Put(const std::string& path, const void* data, size_t size);
+	void Remove(const std::string& path);
+
+private:
+	std::mutex _mutex;
+	std::unordered_map<std::string, std::shared_ptr<const ResourceBlob>> _files;
+};
+
+class Vfs final : public ResourceHandler {
+public:
+	Vfs() = default;
+	~Vfs() override;
+
+	Vfs(const Vfs&) = delete;
+	Vfs& operator=(const Vfs&) = delete;
+
+	VfsLayer* AddLayer(std::unique_ptr<VfsLayer> layer, int priority);
+	void RemoveLayer(const VfsLayer* layer);
+
+	std::shared_ptr<const ResourceBlob> Open(const std::string& path);
+	void Invalidate(const std::string& path);
+	void InvalidateAll();
+
+	bool HandleRequest(const ResourceQuery& query, std::string_view path, ResourceResult* result) override;
+	bool Prefetch(std::string_view path) override;
+
+	static std::string NormalizePath(std::string_view path);
+
+private:
+	friend class HotReload;
+
+	struct Layer {
+		std::unique_ptr<VfsLayer> Instance;
+		int Priority;
+	};
+
+	struct CacheEntry {
+		VfsLayer* Layer;
+		std::shared_ptr<const ResourceBlob> Blob;
+	};
+
+	std::shared_mutex _mutex;
+	std::vector<Layer> _layers;
+	std::unordered_map<std::string, CacheEntry> _cache;
+	uint64_t _generation = 0;
+
+	// Guarded by the hot reload link lock.
+	std::vector<HotReload*> _hotReloads;
+
+	std::shared_ptr<const ResourceBlob> Load(const std::string& path);
+
+	static std::string ToFilePath(std::string_view path);
+};
+
+}
+
+#endif // !GLUINO_VFS_H
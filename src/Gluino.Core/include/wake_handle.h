@@ -0,0 +1,37 @@
+#pragma once
+
+#ifndef GLUINO_WAKE_HANDLE_H
+#define GLUINO_WAKE_HANDLE_H
+
+#include <cstdint>
+
+namespace Gluino {
+
+// Waitable handle that becomes ready when work is posted to an event loop.
+// The native handle is an event HANDLE on Windows and an eventfd on Linux, so a host
+// can wait on it alongside its own I/O.
+class WakeHandle {
+public:
+	WakeHandle();
+	~WakeHandle();
+
+	WakeHandle(const WakeHandle&) = delete;
+	WakeHandle& operator=(const WakeHandle&) = delete;
+
+	void Signal();
+	void Reset();
+
+	[[nodiscard]] intptr_t GetNative() const;
+
+private:
+#ifdef _WIN32
+	void* _hEvent = nullptr;
+#else
+	int _fd = -1;
+	int _writeFd = -1;
+#endif
+};
+
+}
+
+#endif // !GLUINO_WAKE_HANDLE_H
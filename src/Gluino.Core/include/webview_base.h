@@ -6,36 +6,174 @@
 #include "webview_options.h"
 #include "webview_events.h"
 #include "window_base.h"
+#include "resource_router.h"
+#include "file_tokens.h"
+#include "prefetcher.h"
+#include "throttle_policy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace Gluino {
 
 class WebViewBase {
 public:
-	explicit WebViewBase(WebViewOptions* options, const WebViewEvents* events) {
+	explicit WebViewBase(WebViewOptions* options, const WebViewEvents* events) : _prefetcher(&_resourceRouter) {
 #ifdef _WIN32
 		if (options->StartUrlW) _startUrl = CopyStr(options->StartUrlW);
 		if (options->StartContentW) _startContent = CopyStr(options->StartContentW);
 		if (options->UserAgentW) _userAgent = CopyStr(options->UserAgentW);
 #else
 		if (options->StartUrlA) _startUrl = CopyStr(options->StartUrlA);
-		if (options->StartStrA) _startStr = CopyStr(options->StartStrA);
+		if (options->StartContentA) _startContent = CopyStr(options->StartContentA);
 		if (options->UserAgentA) _userAgent = CopyStr(options->UserAgentA);
 #endif
 
+		_contextMenuEnabled = options->ContextMenuEnabled;
+		_devToolsEnabled = options->DevToolsEnabled;
+		_grantPermissions = options->GrantPermissions;
+
 		_onCreated = (Delegate)events->OnCreated;
-		_onNavigationStart = (StringDelegate)events->OnNavigationStart;
-		_onNavigationEnd = (Delegate)events->OnNavigationEnd;
-		_onMessageReceived = (StringDelegate)events->OnMessageReceived;
 		_onResourceRequested = (WebResourceDelegate)events->OnResourceRequested;
+		SetSuspendDelay(options->SuspendDelay);
+
+		_resourceRouter.Mount(FileTokens::Prefix, &_fileTokens);
 	}
-	virtual ~WebViewBase() = default;
+	virtual ~WebViewBase() {
+		if (_host && _throttleTimer)
+			_host->StopTimer(_throttleTimer);
+	}
+
+	// Applies the options and events of a newly spawned webview to a pooled one. Created is then
+	// reported and the start page loaded from the window's loop, after the host has received the
+	// handles, as it would be for a webview created from scratch.
+	void Adopt(WebViewOptions* options, const WebViewEvents* events) {
+		delete[] std::exchange(_startUrl, nullptr);
+		delete[] std::exchange(_startContent, nullptr);
+		delete[] std::exchange(_userAgent, nullptr);
+#ifdef _WIN32
+		if (options->StartUrlW) _startUrl = CopyStr(options->StartUrlW);
+		if (options->StartContentW) _startContent = CopyStr(options->StartContentW);
+		if (options->UserAgentW) _userAgent = CopyStr(options->UserAgentW);
+#else
+		if (options->StartUrlA) _startUrl = CopyStr(options->StartUrlA);
+		if (options->StartContentA) _startContent = CopyStr(options->StartContentA);
+		if (options->UserAgentA) _userAgent = CopyStr(options->UserAgentA);
+#endif
+
+		_contextMenuEnabled = options->ContextMenuEnabled;
+		_devToolsEnabled = options->DevToolsEnabled;
+		_grantPermissions = options->GrantPermissions;
+
+		_onCreated = (Delegate)events->OnCreated;
+		_onResourceRequested = (WebResourceDelegate)events->OnResourceRequested;
+		SetSuspendDelay(options->SuspendDelay);
+
+		ApplySettings();
+		StartOnLoop();
+	}
+
+	// Whether the native webview exists; false until it has been created or if creation failed.
+	[[nodiscard]] virtual bool IsCreated() const = 0;
 
 	virtual void Attach(WindowBase* window) = 0;
 	virtual void Navigate(autostr url) = 0;
 	virtual void NativateToString(autostr content) = 0;
-	virtual void PostWebMessage(autostr message) = 0;
 	virtual void InjectScript(autostr script, bool onDocumentCreated) = 0;
 
+	// Messages posted while the webview is throttled are held and delivered in order, in one
+	// burst, when it becomes active again. A repeat of the last held message is dropped, and
+	// past MaxHeldMessages or MaxHeldBytes the oldest ones make room.
+	void PostWebMessage(const autostr message) {
+		if (_throttleLevel != ThrottleLevel::Active) {
+			HoldMessage(message);
+			return;
+		}
+		SendWebMessage(message);
+	}
+
+	static constexpr size_t MaxHeldMessages = 256;
+	static constexpr size_t MaxHeldBytes = 4 * 1024 * 1024;
+
+	// A webview is throttled as much as its window, and further while it is hidden within a
+	// visible window: its page is hidden straight away and suspended, with its memory trimmed,
+	// once it has stayed hidden for the suspend delay. Showing it resumes the same page.
+	[[nodiscard]] ThrottleLevel GetThrottleLevel() const { return _throttleLevel; }
+	void SetWindowThrottleLevel(const ThrottleLevel level) {
+		_windowThrottleLevel = level;
+		UpdateThrottleLevel();
+	}
+
+	[[nodiscard]] bool GetVisible() const { return _visible; }
+	void SetVisible(const bool visible) {
+		if (visible == _visible)
+			return;
+
+		_visible = visible;
+		ApplyVisible(visible);
+		_throttle.SetVisible(visible, ThrottlePolicy::Clock::now());
+		UpdateThrottleLevel();
+	}
+
+	// Milliseconds a hidden webview waits before its page is suspended; negative for never.
+	[[nodiscard]] int GetSuspendDelay() const {
+		return (int)std::chrono::duration_cast<std::chrono::milliseconds>(_throttle.GetSuspendDelay()).count();
+	}
+	void SetSuspendDelay(const int delay) {
+		_throttle.SetSuspendDelay(std::chrono::milliseconds(std::max(delay, -1)), ThrottlePolicy::Clock::now());
+		UpdateThrottleLevel();
+	}
+
+	// Bounds are in the window's client coordinates; without bounds the webview fills the window.
+	bool GetBounds(Rect* bounds) const {
+		*bounds = _bounds;
+		return !_fillWindow;
+	}
+	void SetBounds(const Rect* bounds) {
+		_fillWindow = bounds == nullptr;
+		if (bounds)
+			_bounds = *bounds;
+		ApplyBounds();
+	}
+
+	[[nodiscard]] int GetViewId() const { return _viewId; }
+	void SetViewId(const int viewId) { _viewId = viewId; }
+
+	// Exchanges what the host knows a webview by, and where it is shown, with another webview
+	// of the same window; see WebViewStack::Swap. The incoming one is shown before the outgoing
+	// one is hidden so the window never paints without a page.
+	void SwapIdentity(WebViewBase* other) {
+		std::swap(_registryHandle, other->_registryHandle);
+		std::swap(_viewId, other->_viewId);
+		std::swap(_onCreated, other->_onCreated);
+		std::swap(_onResourceRequested, other->_onResourceRequested);
+		std::swap(_fillWindow, other->_fillWindow);
+		std::swap(_bounds, other->_bounds);
+		ApplyBounds();
+		other->ApplyBounds();
+
+		const auto suspendDelay = GetSuspendDelay();
+		SetSuspendDelay(other->GetSuspendDelay());
+		other->SetSuspendDelay(suspendDelay);
+
+		const auto visible = _visible;
+		const auto otherVisible = other->_visible;
+		if (otherVisible) {
+			SetVisible(true);
+			other->SetVisible(visible);
+		}
+		else {
+			other->SetVisible(visible);
+			SetVisible(false);
+		}
+	}
+
 	virtual bool GetContextMenuEnabled() = 0;
 	virtual void SetContextMenuEnabled(bool enabled) = 0;
 
@@ -45,16 +183,145 @@ public:
 	virtual autostr GetUserAgent() = 0;
 	virtual void SetUserAgent(autostr userAgent) = 0;
 
+	[[nodiscard]] bool GetGrantPermissions() const { return _grantPermissions; }
+
+	[[nodiscard]] WebViewHandle GetRegistryHandle() const { return _registryHandle; }
+	void SetRegistryHandle(const WebViewHandle handle) { _registryHandle = handle; }
+
+	// Run once on the webview's thread: when the native webview has been created (or failed to),
+	// and when its first navigation has committed.
+	void SetReadyHandler(std::function<void()> handler) { _readyHandler = std::move(handler); }
+	void SetFirstCommitHandler(std::function<void()> handler) { _firstCommitHandler = std::move(handler); }
+
+	// Serves requests under the prefix from the handler. Backends that only see requests for
+	// schemes they have registered pick up the prefix's scheme here.
+	void Mount(const std::string& prefix, ResourceHandler* handler) {
+		_resourceRouter.Mount(prefix, handler);
+		OnMount(prefix);
+	}
+
+	ResourceRouter* GetResourceRouter() { return &_resourceRouter; }
+	FileTokens* GetFileTokens() { return &_fileTokens; }
+	Prefetcher* GetPrefetcher() { return &_prefetcher; }
+
 protected:
-	autostr _startUrl;
-	autostr _startContent;
-	autostr _userAgent;
+	WebViewHandle _registryHandle = 0;
+	autostr _startUrl = nullptr;
+	autostr _startContent = nullptr;
+	autostr _userAgent = nullptr;
+
+	ResourceRouter _resourceRouter;
+	FileTokens _fileTokens;
+	Prefetcher _prefetcher;
+
+	WindowBase* _host = nullptr;
+	std::shared_ptr<bool> _alive = std::make_shared<bool>(true);
+	int _viewId = 0;
+	bool _visible = true;
+	bool _fillWindow = true;
+	Rect _bounds = {};
+
+	bool _contextMenuEnabled;
+	bool _devToolsEnabled;
+	bool _grantPermissions;
+
+	ThrottlePolicy _throttle;
+	ThrottleLevel _windowThrottleLevel = ThrottleLevel::Active;
+	std::atomic<ThrottleLevel> _throttleLevel = ThrottleLevel::Active;
+	int _throttleTimer = 0;
+	std::deque<std::basic_string<std::remove_pointer_t<autostr>>> _heldMessages;
+	size_t _heldBytes = 0;
+
+	std::function<void()> _readyHandler;
+	std::function<void()> _firstCommitHandler;
 
 	Delegate _onCreated;
-	StringDelegate _onNavigationStart;
-	Delegate _onNavigationEnd;
-	StringDelegate _onMessageReceived;
 	WebResourceDelegate _onResourceRequested;
+
+	virtual void SendWebMessage(autostr message) = 0;
+	virtual void ApplyThrottleLevel(ThrottleLevel level) = 0;
+	virtual void ApplyVisible(bool visible) = 0;
+	virtual void ApplyBounds() = 0;
+	virtual void ApplySettings() {}
+	virtual void OnMount([[maybe_unused]] const std::string& prefix) {}
+
+	// Reports Created and loads the start page once the native webview exists (or failed to).
+	// The ready and first commit handlers run here too when there is nothing to load.
+	void Start() {
+		_host->FlushEvents();
+		if (_onCreated)
+			_onCreated();
+
+		if (_startUrl)
+			Navigate(_startUrl);
+		else if (_startContent)
+			NativateToString(_startContent);
+		ApplyBounds();
+
+		NotifyReady();
+		if (!_startUrl && !_startContent)
+			NotifyFirstCommit();
+	}
+
+	// Starts on a later turn of the window's loop, unless the webview is closed by then.
+	void StartOnLoop() {
+		_host->Dispatch([this, alive = std::weak_ptr(_alive)] {
+			if (alive.lock())
+				Start();
+		});
+	}
+
+	void NotifyReady() {
+		if (const auto handler = std::exchange(_readyHandler, nullptr))
+			handler();
+	}
+
+	void NotifyFirstCommit() {
+		if (const auto handler = std::exchange(_firstCommitHandler, nullptr))
+			handler();
+	}
+
+private:
+	void UpdateThrottleLevel() {
+		const auto now = ThrottlePolicy::Clock::now();
+		_throttle.Update(now);
+
+		// The suspend deadline runs on a window timer, so it waits while the window is throttled.
+		if (_host) {
+			if (_throttleTimer)
+				_host->StopTimer(std::exchange(_throttleTimer, 0));
+			if (const auto deadline = _throttle.GetDeadline()) {
+				_throttleTimer = _host->StartTimer(*deadline - now, {}, [this] {
+					_throttleTimer = 0;
+					UpdateThrottleLevel();
+				});
+			}
+		}
+
+		const auto level = std::max(_windowThrottleLevel, _throttle.GetLevel());
+		if (level == _throttleLevel)
+			return;
+
+		_throttleLevel = level;
+		ApplyThrottleLevel(level);
+		if (level == ThrottleLevel::Active) {
+			_heldBytes = 0;
+			for (auto& message : std::exchange(_heldMessages, {}))
+				SendWebMessage(message.data());
+		}
+	}
+
+	void HoldMessage(const autostr message) {
+		if (!_heldMessages.empty() && _heldMessages.back() == message)
+			return;
+
+		const auto& held = _heldMessages.emplace_back(message);
+		_heldBytes += held.size() * sizeof(held[0]);
+		while (_heldMessages.size() > MaxHeldMessages || (_heldBytes > MaxHeldBytes && _heldMessages.size() > 1)) {
+			_heldBytes -= _heldMessages.front().size() * sizeof(held[0]);
+			_heldMessages.pop_front();
+		}
+	}
 };
 
 }
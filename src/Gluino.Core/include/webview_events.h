@@ -9,9 +9,6 @@ namespace Gluino {
 
 struct WebViewEvents {
 	Delegate* OnCreated;
-	StringDelegate* OnNavigationStart;
-	Delegate* OnNavigationEnd;
-	StringDelegate* OnMessageReceived;
 	WebResourceDelegate* OnResourceRequested;
 };
 
@@ -15,6 +15,7 @@ struct WebViewOptions {
 	wchar_t* UserAgentW;
 	char* UserAgentA;
 	bool GrantPermissions;
+	int SuspendDelay;
 };
 
 }
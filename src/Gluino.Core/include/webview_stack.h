@@ -0,0 +1,42 @@
+#pragma once
+
+#ifndef GLUINO_WEBVIEW_STACK_H
+#define GLUINO_WEBVIEW_STACK_H
+
+#include "throttle_policy.h"
+
+#include <vector>
+
+namespace Gluino {
+
+class WebViewBase;
+
+// The webviews hosted by one window, back to front. The first one added, with id 0, is the
+// window's primary webview. Each webview is given an id that is unique within the window and tags
+// the events it posts. Owned and driven by the window thread.
+class WebViewStack {
+public:
+	int Add(WebViewBase* webView);
+	bool Remove(WebViewBase* webView);
+
+	[[nodiscard]] WebViewBase* Find(int viewId) const;
+	[[nodiscard]] WebViewBase* GetPrimary() const { return Find(0); }
+	[[nodiscard]] const std::vector<WebViewBase*>& GetAll() const { return _webViews; }
+
+	[[nodiscard]] int GetIndex(const WebViewBase* webView) const;
+	bool Move(WebViewBase* webView, int index);
+
+	// Puts one webview in the place of another: they exchange handles, ids, placement and
+	// stack positions, so whoever holds the first handle now talks to the second webview.
+	bool Swap(WebViewBase* current, WebViewBase* replacement);
+
+	void SetWindowThrottleLevel(ThrottleLevel level) const;
+
+private:
+	std::vector<WebViewBase*> _webViews;
+	int _nextId = 0;
+};
+
+}
+
+#endif // !GLUINO_WEBVIEW_STACK_H
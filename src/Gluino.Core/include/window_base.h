@@ -5,6 +5,23 @@
 
 #include "window_events.h"
 #include "window_options.h"
+#include "window_snapshot.h"
+#include "window_change_set.h"
+#include "webview_options.h"
+#include "webview_events.h"
+#include "invoke_queue.h"
+#include "seqlock.h"
+#include "timer_wheel.h"
+#include "event_ring.h"
+#include "registry.h"
+#include "throttle_policy.h"
+#include "webview_stack.h"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <utility>
 
 namespace Gluino {
 
@@ -14,6 +31,7 @@ class WindowBase {
 public:
 	explicit WindowBase(WindowOptions* options, const WindowEvents* events) {
 		_isMain = options->IsMain;
+		_threadId = std::this_thread::get_id();
 #ifdef _WIN32
 		_title = CopyStr(options->TitleW);
 #else
@@ -24,31 +42,180 @@ public:
 		_borderStyle = options->BorderStyle;
 		_theme = options->Theme;
 
-		_onShown = (Delegate)events->OnShown;
-		_onHidden = (Delegate)events->OnHidden;
-		_onResize = (SizeDelegate)events->OnResize;
-		_onResizeStart = (SizeDelegate)events->OnResizeStart;
-		_onResizeEnd = (SizeDelegate)events->OnResizeEnd;
-		_onLocationChanged = (PointDelegate)events->OnLocationChanged;
-		_onWindowStateChanged = (IntDelegate)events->OnWindowStateChanged;
-		_onFocusIn = (Delegate)events->OnFocusIn;
-		_onFocusOut = (Delegate)events->OnFocusOut;
 		_onClosing = (Predicate)events->OnClosing;
 		_onClosed = (Delegate)events->OnClosed;
+		_onEvents = (EventBatchDelegate)events->OnEvents;
+		_eventMask = events->Subscriptions;
 	}
 
 	virtual ~WindowBase() {
 		delete[] _title;
 	}
 
+	// Applies the options and events of a newly spawned window to a pooled one that was created
+	// hidden with placeholder options.
+	virtual void Adopt(WindowOptions* options, const WindowEvents* events) {
+		_isMain = options->IsMain;
+		delete[] _title;
+#ifdef _WIN32
+		_title = CopyStr(options->TitleW);
+#else
+		_title = CopyStr(options->TitleA);
+#endif
+		_icon = options->Icon;
+		_iconSize = options->IconSize;
+		_borderStyle = options->BorderStyle;
+		_theme = options->Theme;
+
+		_onClosing = (Predicate)events->OnClosing;
+		_onClosed = (Delegate)events->OnClosed;
+		_onEvents = (EventBatchDelegate)events->OnEvents;
+		_eventMask = events->Subscriptions;
+	}
+
+	[[nodiscard]] WindowHandle GetRegistryHandle() const { return _registryHandle; }
+	void SetRegistryHandle(const WindowHandle handle) { _registryHandle = handle; }
+
 	[[nodiscard]] bool IsMain() const { return _isMain; }
+	[[nodiscard]] bool IsCurrentThread() const { return std::this_thread::get_id() == _threadId; }
 
 	virtual void Show() = 0;
 	virtual void Hide() = 0;
 	virtual void Close() = 0;
 	virtual void Center() = 0;
 	virtual void DragMove() = 0;
-	virtual void Invoke(Delegate action) = 0;
+
+	void Invoke(const Delegate action) {
+		if (IsCurrentThread()) {
+			action();
+			return;
+		}
+
+		std::promise<void> promise;
+		const auto future = promise.get_future();
+		Dispatch([action, &promise] {
+			action();
+			promise.set_value();
+		});
+		future.wait();
+	}
+
+	void BeginInvoke(const PtrDelegate action, void* context) {
+		Dispatch([action, context] { action(context); });
+	}
+
+	void InvokeAsync(const PtrDelegate action, void* context, const PtrDelegate callback) {
+		Dispatch([action, context, callback] {
+			action(context);
+			callback(context);
+		});
+	}
+
+	void Dispatch(std::function<void()> task) {
+		if (_invokeQueue.Push(std::move(task)))
+			Wake();
+	}
+
+	void DrainInvokeQueue() {
+		if (_invokeQueue.Drain())
+			Wake();
+	}
+
+	// Events are queued and handed to the host in one batch from the window's loop.
+	// Events that need an answer are delivered synchronously, after any queued ones.
+	void PostEvent(const EventType type, const int x = 0, const int y = 0, const autostr text = nullptr) {
+		if (!IsSubscribed(type))
+			return;
+
+		bool wasEmpty;
+		if (!_events.Push(type, x, y, text, &wasEmpty)) {
+			FlushEvents();
+			_events.Push(type, x, y, text, &wasEmpty);
+		}
+
+		// While throttled, events stay in the ring, where repeated ones coalesce, until the
+		// window becomes active again. A full ring is still flushed rather than dropped.
+		if (wasEmpty && _throttleLevel == ThrottleLevel::Active) {
+			Dispatch([this] {
+				if (_throttleLevel == ThrottleLevel::Active)
+					FlushEvents();
+			});
+		}
+	}
+
+	void FlushEvents() {
+		std::vector<EventRecord> records;
+		if (_events.Drain(&records) == 0)
+			return;
+
+		if (_onEvents)
+			_onEvents(records.data(), (int)records.size());
+		EventRing::Release(&records);
+	}
+
+	// One bit per EventType; events the host does not listen to are never queued or delivered.
+	void SetEventMask(const unsigned int mask) { _eventMask.store(mask, std::memory_order_relaxed); }
+	[[nodiscard]] bool IsSubscribed(const EventType type) const {
+		return _eventMask.load(std::memory_order_relaxed) & 1u << (int)type;
+	}
+
+	// Timers fire on the loop that owns the window and are cancelled when it is destroyed.
+	void SetTimerWheel(TimerWheel* timerWheel) { _timerWheel = timerWheel; }
+
+	int StartTimer(const TimerWheel::Clock::duration due, const TimerWheel::Clock::duration period, std::function<void()> callback) {
+		return _timerWheel ? _timerWheel->Schedule(due, std::move(callback), period, this) : 0;
+	}
+
+	bool StopTimer(const int id) { return _timerWheel && _timerWheel->Cancel(id); }
+
+	void StopTimers() {
+		if (_timerWheel) {
+			_timerWheel->CancelAll(this);
+			_timerWheel->CancelAll(&_throttle);
+		}
+	}
+
+	// A hidden or minimized window is throttled: its timers are suspended, its events are held
+	// and its webviews are told they are in the background. Becoming visible again resumes all of
+	// it before anything else runs on the loop.
+	[[nodiscard]] ThrottleLevel GetThrottleLevel() const { return _throttleLevel; }
+
+	[[nodiscard]] bool GetBackgroundThrottling() const { return _throttle.GetEnabled(); }
+	void SetBackgroundThrottling(const bool enabled) {
+		_throttle.SetEnabled(enabled, ThrottlePolicy::Clock::now());
+		UpdateThrottle();
+	}
+
+	// Milliseconds a throttled window waits before its browser is suspended; negative for never.
+	[[nodiscard]] int GetBrowserSuspendDelay() const {
+		return (int)std::chrono::duration_cast<std::chrono::milliseconds>(_throttle.GetSuspendDelay()).count();
+	}
+	void SetBrowserSuspendDelay(const int delay) {
+		_throttle.SetSuspendDelay(std::chrono::milliseconds(std::max(delay, -1)), ThrottlePolicy::Clock::now());
+		UpdateThrottle();
+	}
+
+	// Additional webviews are stacked above the primary one and share its environment.
+	virtual WebViewBase* AddWebView(WebViewOptions* options, const WebViewEvents* events) = 0;
+	virtual bool RemoveWebView(WebViewBase* webView) = 0;
+
+	[[nodiscard]] const WebViewStack& GetWebViews() const { return _webViews; }
+	[[nodiscard]] int GetWebViewZIndex(const WebViewBase* webView) const { return _webViews.GetIndex(webView); }
+	void SetWebViewZIndex(WebViewBase* webView, const int index) {
+		if (_webViews.Move(webView, index))
+			RestackWebViews();
+	}
+
+	// Shows a webview, typically one prerendered while hidden, in place of another of this
+	// window; the host keeps using the same handle, which now refers to the replacement.
+	bool SwapWebViews(WebViewBase* current, WebViewBase* replacement) {
+		if (!_webViews.Swap(current, replacement))
+			return false;
+		RestackWebViews();
+		return true;
+	}
+
+	[[nodiscard]] WindowSnapshot GetSnapshot() const { return _snapshot.Load(); }
 
 	virtual void GetBounds(Rect* bounds) = 0;
 	virtual bool GetIsDarkMode() = 0;
@@ -89,25 +256,107 @@ public:
 	virtual bool GetTopMost() = 0;
 	virtual void SetTopMost(bool topMost) = 0;
 
+	virtual void ApplyChanges(const WindowChangeSet& changes) = 0;
+
 protected:
+	InvokeQueue _invokeQueue;
+	SeqLock<WindowSnapshot> _snapshot;
+	TimerWheel* _timerWheel = nullptr;
+	EventRing _events;
+	std::atomic<unsigned int> _eventMask;
+	WebViewStack _webViews;
+
+	WindowHandle _registryHandle = 0;
 	bool _isMain;
+	std::thread::id _threadId;
 	autostr _title;
 	void* _icon;
 	int _iconSize;
 	WindowBorderStyle _borderStyle;
 	WindowTheme _theme;
 
-	Delegate _onShown;
-	Delegate _onHidden;
-	SizeDelegate _onResize;
-	SizeDelegate _onResizeStart;
-	SizeDelegate _onResizeEnd;
-	PointDelegate _onLocationChanged;
-	IntDelegate _onWindowStateChanged;
-	Delegate _onFocusIn;
-	Delegate _onFocusOut;
 	Predicate _onClosing;
 	Delegate _onClosed;
+	EventBatchDelegate _onEvents;
+
+	virtual void Wake() = 0;
+	virtual void RestackWebViews() = 0;
+
+	// Unregisters a removed webview. It is closed on this window's loop, and only once no call
+	// from another thread still holds it pinned.
+	void RetireWebView(const WebViewHandle handle, std::function<void()> close) {
+		WebViewRegistry.Remove(handle, [this, close = std::move(close)] {
+			if (IsCurrentThread())
+				close();
+			else
+				Dispatch(close);
+		});
+	}
+
+	void TrackVisibility(const bool visible) {
+		_throttle.SetVisible(visible, ThrottlePolicy::Clock::now());
+		UpdateThrottle();
+	}
+
+	void TrackMinimized(const bool minimized) {
+		_throttle.SetMinimized(minimized, ThrottlePolicy::Clock::now());
+		UpdateThrottle();
+	}
+
+	void PublishSnapshot(WindowSnapshot snapshot) {
+		const auto current = _snapshot.Load();
+		if (memcmp(&current.Bounds, &snapshot.Bounds, sizeof(Rect)) == 0 &&
+			current.WindowState == snapshot.WindowState &&
+			current.IsDarkMode == snapshot.IsDarkMode)
+			return;
+
+		snapshot.Version = current.Version + 1;
+		_snapshot.Store(snapshot);
+	}
+
+private:
+	ThrottlePolicy _throttle;
+	std::atomic<ThrottleLevel> _throttleLevel = ThrottleLevel::Active;
+	int _throttleTimer = 0;
+
+	void UpdateThrottle() {
+		const auto now = ThrottlePolicy::Clock::now();
+		const auto level = _throttle.Update(now);
+
+		// The suspend deadline is kept on a timer of its own so it still fires while the
+		// window's timers are suspended.
+		if (_timerWheel) {
+			if (_throttleTimer)
+				_timerWheel->Cancel(std::exchange(_throttleTimer, 0));
+			if (const auto deadline = _throttle.GetDeadline()) {
+				_throttleTimer = _timerWheel->Schedule(*deadline - now, [this] {
+					_throttleTimer = 0;
+					UpdateThrottle();
+				}, {}, &_throttle);
+			}
+		}
+
+		if (level == _throttleLevel)
+			return;
+
+		const auto previous = _throttleLevel.exchange(level);
+		if (previous == ThrottleLevel::Active) {
+			// Deliver what happened up to now, including the transition itself, then hold.
+			FlushEvents();
+			if (_timerWheel)
+				_timerWheel->Suspend(this);
+			_webViews.SetWindowThrottleLevel(level);
+		}
+		else if (level == ThrottleLevel::Active) {
+			_webViews.SetWindowThrottleLevel(level);
+			if (_timerWheel)
+				_timerWheel->Resume(this);
+			FlushEvents();
+		}
+		else {
+			_webViews.SetWindowThrottleLevel(level);
+		}
+	}
 };
 
 }
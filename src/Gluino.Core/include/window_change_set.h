@@ -0,0 +1,42 @@
+#pragma once
+
+#ifndef GLUINO_WINDOW_CHANGE_SET_H
+#define GLUINO_WINDOW_CHANGE_SET_H
+
+#include "common.h"
+
+namespace Gluino {
+
+enum class WindowChange : unsigned int {
+	None            = 0,
+	Size            = 1 << 0,
+	Location        = 1 << 1,
+	WindowState     = 1 << 2,
+	BorderStyle     = 1 << 3,
+	TopMost         = 1 << 4,
+	MinimizeEnabled = 1 << 5,
+	MaximizeEnabled = 1 << 6,
+	MinimumSize     = 1 << 7,
+	MaximumSize     = 1 << 8,
+	Theme           = 1 << 9
+};
+
+struct WindowChangeSet {
+	unsigned int Changes;
+	Gluino::Size Size;
+	Point Location;
+	Gluino::WindowState WindowState;
+	WindowBorderStyle BorderStyle;
+	WindowTheme Theme;
+	Gluino::Size MinimumSize;
+	Gluino::Size MaximumSize;
+	bool TopMost;
+	bool MinimizeEnabled;
+	bool MaximizeEnabled;
+
+	[[nodiscard]] bool Has(WindowChange change) const { return (Changes & (unsigned int)change) != 0; }
+};
+
+}
+
+#endif // !GLUINO_WINDOW_CHANGE_SET_H
@@ -4,21 +4,15 @@
 #define GLUINO_WINDOW_EVENTS_H
 
 #include "common.h"
+#include "event_ring.h"
 
 namespace Gluino {
 
 struct WindowEvents {
-	Delegate* OnShown;
-	Delegate* OnHidden;
-	SizeDelegate* OnResize;
-	SizeDelegate* OnResizeStart;
-	SizeDelegate* OnResizeEnd;
-	PointDelegate* OnLocationChanged;
-	IntDelegate* OnWindowStateChanged;
-	Delegate* OnFocusIn;
-	Delegate* OnFocusOut;
 	Predicate* OnClosing;
 	Delegate* OnClosed;
+	EventBatchDelegate* OnEvents;
+	unsigned int Subscriptions;
 };
 
 }
@@ -14,16 +14,19 @@ struct WindowOptions {
 	void* Icon;
 	int IconSize;
 	WindowBorderStyle BorderStyle;
-	WindowState WindowState;
+	Gluino::WindowState WindowState;
 	WindowStartupLocation StartupLocation;
 	WindowTheme Theme;
-	Size MinimumSize;
-	Size MaximumSize;
-	Size Size;
+	Gluino::Size MinimumSize;
+	Gluino::Size MaximumSize;
+	Gluino::Size Size;
 	Point Location;
 	bool MinimizeEnabled;
 	bool MaximizeEnabled;
 	bool TopMost;
+	int GeometryEventInterval;
+	bool BackgroundThrottling;
+	int BrowserSuspendDelay;
 };
 
 }
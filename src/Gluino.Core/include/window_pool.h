@@ -0,0 +1,47 @@
+#pragma once
+
+#ifndef GLUINO_WINDOW_POOL_H
+#define GLUINO_WINDOW_POOL_H
+
+#include "registry.h"
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace Gluino {
+
+// Bookkeeping for hidden window and webview pairs created ahead of time, so that spawning a
+// window only has to apply its options. Entries are warming until their webview is ready and
+// are handed out oldest first. A webview that fails to initialise stops further refills until
+// the capacity is set again.
+class WindowPool {
+public:
+	struct Entry {
+		WindowHandle Window;
+		WebViewHandle WebView;
+	};
+
+	void SetCapacity(int capacity);
+	[[nodiscard]] int GetCapacity() const;
+
+	void AddWarming(const Entry& entry);
+	bool MarkReady(WindowHandle window, bool created);
+	bool Acquire(Entry* entry);
+
+	[[nodiscard]] int GetReadyCount() const;
+	[[nodiscard]] int GetDeficit() const;
+
+	std::vector<Entry> Trim();
+
+private:
+	mutable std::mutex _mutex;
+	std::vector<Entry> _warming;
+	std::deque<Entry> _ready;
+	int _capacity = 0;
+	bool _failed = false;
+};
+
+}
+
+#endif // !GLUINO_WINDOW_POOL_H
@@ -0,0 +1,19 @@
+#pragma once
+
+#ifndef GLUINO_WINDOW_SNAPSHOT_H
+#define GLUINO_WINDOW_SNAPSHOT_H
+
+#include "common.h"
+
+namespace Gluino {
+
+struct WindowSnapshot {
+	unsigned int Version;
+	Rect Bounds;
+	Gluino::WindowState WindowState;
+	bool IsDarkMode;
+};
+
+}
+
+#endif // !GLUINO_WINDOW_SNAPSHOT_H
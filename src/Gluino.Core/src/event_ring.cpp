@@ -0,0 +1,48 @@
+#include "event_ring.h"
+
+using namespace Gluino;
+
+EventRing::EventRing(const size_t capacity) : _records(capacity) {}
+
+EventRing::~EventRing() {
+	std::vector<EventRecord> records;
+	Drain(&records);
+	Release(&records);
+}
+
+bool EventRing::Push(const EventType type, const int x, const int y, const autostr text, bool* wasEmpty) {
+	std::lock_guard lock(_mutex);
+	*wasEmpty = _count == 0;
+
+	if (_count > 0 && (type == EventType::Resize || type == EventType::LocationChanged)) {
+		if (auto& last = _records[(_head + _count - 1) % _records.size()]; last.Type == type) {
+			last.X = x;
+			last.Y = y;
+			return true;
+		}
+	}
+
+	if (_count == _records.size())
+		return false;
+
+	_records[(_head + _count) % _records.size()] = { type, x, y, text ? CopyStr(text) : nullptr };
+	++_count;
+	return true;
+}
+
+size_t EventRing::Drain(std::vector<EventRecord>* records) {
+	std::lock_guard lock(_mutex);
+	const auto count = _count;
+	for (; _count > 0; --_count) {
+		records->push_back(_records[_head]);
+		_head = (_head + 1) % _records.size();
+	}
+	_head = 0;
+	return count;
+}
+
+void EventRing::Release(std::vector<EventRecord>* records) {
+	for (const auto& record : *records)
+		delete[] record.Text;
+	records->clear();
+}
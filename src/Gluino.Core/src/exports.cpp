@@ -1,91 +1,280 @@
 #include "app.h"
 #include "window.h"
 #include "webview.h"
+#include "vfs.h"
+#include "hot_reload.h"
+#include "plugin.h"
+#include "loopback_server.h"
+#include "registry.h"
 
 using namespace Gluino;
 
+// Each call holds its window or webview pinned, so one closed on its own thread meanwhile is
+// not freed until the call returns.
+static auto GetWindow(const WindowHandle handle) { return WindowRegistry.Pin<Window>(handle); }
+static auto GetWebView(const WebViewHandle handle) { return WebViewRegistry.Pin<WebView>(handle); }
+
 extern "C" {
 #ifdef _WIN32
 	EXPORT WindowsOSVersion Gluino_GetWindowsOSVersion() { return GetWindowsOSVersion(); }
 	EXPORT App* Gluino_App_Create(const HINSTANCE hInstance, const autostr appId) { return new App(hInstance, appId); }
-	EXPORT HWND Gluino_Window_GetHandle(const Window* window) { return window->GetHandle(); }
+	EXPORT HWND Gluino_Window_GetHandle(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetHandle() : nullptr; }
 #else
-	//TODO: EXPORT App* Gluino_App_Create() { return new App(); }
+	EXPORT App* Gluino_App_Create(void*, const autostr appId) { return App::Initialize(appId) ? new App(appId) : nullptr; }
+#endif
+
+#ifdef GLUINO_HEADLESS
+	EXPORT void Gluino_Headless_SetFocused(const WindowHandle handle, const bool focused) { if (const auto window = GetWindow(handle)) window->SetFocused(focused); }
+	EXPORT void Gluino_Headless_PostMessage(const WebViewHandle handle, const autostr message) { if (const auto webView = GetWebView(handle)) webView->PagePostMessage(message); }
+	EXPORT int Gluino_Headless_Fetch(const WebViewHandle handle, const autostr url, const autostr method, int* statusCode) {
+		const auto webView = GetWebView(handle);
+		if (ResourceResult result; webView && webView->PageFetch({ ToUtf8(url), method ? ToUtf8(method) : "GET", {}, {} }, &result)) {
+			*statusCode = result.StatusCode;
+			return (int)result.Length;
+		}
+		return -1;
+	}
+	EXPORT void Gluino_Headless_SetPageHandler(const WebViewHandle handle, const StringDelegate handler) {
+		if (const auto webView = GetWebView(handle))
+			webView->SetPageHandler(handler ? [handler](const std::string& message) { handler((autostr)message.c_str()); } : WebView::PageHandler());
+	}
 #endif
 
 	EXPORT void Gluino_App_Destroy(const App* app) { delete app; }
 	EXPORT void Gluino_App_SpawnWindow(App* app, 
 		WindowOptions* windowOptions, WindowEvents* windowEvents, 
 		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents, 
-		WindowBase** window, WebViewBase** webView) {
-		app->SpawnWindow(windowOptions, windowEvents, webViewOptions, webViewEvents, window, webView);
+		UiThreadBase* thread, WindowHandle* window, WebViewHandle* webView) {
+		WindowBase* windowInstance = nullptr;
+		WebViewBase* webViewInstance = nullptr;
+		app->SpawnWindow(windowOptions, windowEvents, webViewOptions, webViewEvents, thread, &windowInstance, &webViewInstance);
+		*window = windowInstance ? windowInstance->GetRegistryHandle() : 0;
+		*webView = webViewInstance ? webViewInstance->GetRegistryHandle() : 0;
+	}
+	EXPORT void Gluino_App_SpawnWindowAsync(App* app,
+		WindowOptions* windowOptions, WindowEvents* windowEvents,
+		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+		UiThreadBase* thread, const SpawnDelegate callback, void* context) {
+		app->SpawnWindowAsync(windowOptions, windowEvents, webViewOptions, webViewEvents, thread, callback, context);
 	}
-	EXPORT void Gluino_App_DespawnWindow(App* app, Window* window) { app->DespawnWindow(window); }
+	EXPORT void Gluino_App_DespawnWindow(App* app, const WindowHandle handle) { if (const auto window = GetWindow(handle)) app->DespawnWindow(window); }
 	EXPORT void Gluino_App_Run(App* app) { app->Run(); }
+	EXPORT bool Gluino_App_RunOnce(App* app, const int timeout) { return app->RunOnce(timeout); }
+	EXPORT bool Gluino_App_HasPendingWork(App* app) { return app->HasPendingWork(); }
+	EXPORT intptr_t Gluino_App_GetWakeHandle(const App* app) { return app->GetWakeHandle(); }
+	EXPORT void Gluino_App_Wake(App* app) { app->Wake(); }
+	EXPORT int Gluino_App_PostIdle(App* app, const IdleDelegate task, void* context) {
+		return app->PostIdle([task, context](const IdleScheduler::Clock::time_point deadline) {
+			const auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(deadline - IdleScheduler::Clock::now());
+			return task(context, (int)std::max<long long>(remaining.count(), 0));
+		});
+	}
+	EXPORT bool Gluino_App_CancelIdle(App* app, const int id) { return app->CancelIdle(id); }
+	EXPORT int Gluino_App_GetIdleBudget(App* app) { return (int)std::chrono::duration_cast<std::chrono::microseconds>(app->GetIdleScheduler()->GetBudget()).count(); }
+	EXPORT void Gluino_App_SetIdleBudget(App* app, const int budget) { app->GetIdleScheduler()->SetBudget(std::chrono::microseconds(budget)); }
+	EXPORT int Gluino_App_GetTimerSlack(App* app) { return (int)std::chrono::duration_cast<std::chrono::microseconds>(app->GetTimerWheel()->GetSlack()).count(); }
+	EXPORT void Gluino_App_SetTimerSlack(App* app, const int slack) { app->GetTimerWheel()->SetSlack(std::chrono::microseconds(slack)); }
+	EXPORT bool Gluino_App_RequestSingleInstance(App* app, const autostr* args, const int count, const ArgumentsDelegate callback) {
+		std::vector<std::string> arguments;
+		arguments.reserve(count);
+		for (int i = 0; i < count; ++i) arguments.push_back(ToUtf8(args[i]));
+		return app->RequestSingleInstance(ToUtf8(app->GetAppId()), arguments, callback);
+	}
+	EXPORT int Gluino_App_GetWindowPoolSize(const App* app) { return app->GetWindowPoolSize(); }
+	EXPORT void Gluino_App_SetWindowPoolSize(App* app, const int size) { app->SetWindowPoolSize(size); }
 	EXPORT void Gluino_App_Exit(App* app) { app->Exit(); }
+	EXPORT UiThreadBase* Gluino_App_CreateUiThread(App* app) { return app->CreateUiThread(); }
+	EXPORT void Gluino_App_DestroyUiThread(App* app, UiThreadBase* thread) { app->DestroyUiThread(thread); }
+	EXPORT int Gluino_UiThread_GetTimerSlack(UiThreadBase* thread) { return (int)std::chrono::duration_cast<std::chrono::microseconds>(thread->GetTimerWheel()->GetSlack()).count(); }
+	EXPORT void Gluino_UiThread_SetTimerSlack(UiThreadBase* thread, const int slack) { thread->GetTimerWheel()->SetSlack(std::chrono::microseconds(slack)); }
+
+
+	EXPORT void Gluino_Window_Show(const WindowHandle handle) { if (const auto window = GetWindow(handle)) window->Show(); }
+	EXPORT void Gluino_Window_Hide(const WindowHandle handle) { if (const auto window = GetWindow(handle)) window->Hide(); }
+	EXPORT void Gluino_Window_Close(const WindowHandle handle) { if (const auto window = GetWindow(handle)) window->Close(); }
+	EXPORT void Gluino_Window_Center(const WindowHandle handle) { if (const auto window = GetWindow(handle)) window->Center(); }
+	EXPORT void Gluino_Window_DragMove(const WindowHandle handle) { if (const auto window = GetWindow(handle)) window->DragMove(); }
+	EXPORT void Gluino_Window_Invoke(const WindowHandle handle, const Delegate action) { if (const auto window = GetWindow(handle)) window->Invoke(action); }
+	EXPORT void Gluino_Window_BeginInvoke(const WindowHandle handle, const PtrDelegate action, void* context) { if (const auto window = GetWindow(handle)) window->BeginInvoke(action, context); }
+	EXPORT void Gluino_Window_InvokeAsync(const WindowHandle handle, const PtrDelegate action, void* context, const PtrDelegate callback) { if (const auto window = GetWindow(handle)) window->InvokeAsync(action, context, callback); }
+	EXPORT int Gluino_Window_StartTimer(const WindowHandle handle, const int64_t due, const int64_t period, const PtrDelegate callback, void* context) {
+		const auto window = GetWindow(handle);
+		if (!window) return 0;
+		return window->StartTimer(std::chrono::microseconds(due), std::chrono::microseconds(period), [callback, context] { callback(context); });
+	}
+	EXPORT bool Gluino_Window_StopTimer(const WindowHandle handle, const int id) { const auto window = GetWindow(handle); return window && window->StopTimer(id); }
+	EXPORT void Gluino_Window_FlushEvents(const WindowHandle handle) { if (const auto window = GetWindow(handle)) window->FlushEvents(); }
+	EXPORT void Gluino_Window_SetEventMask(const WindowHandle handle, const unsigned int mask) { if (const auto window = GetWindow(handle)) window->SetEventMask(mask); }
+
+	EXPORT void Gluino_Window_GetBounds(const WindowHandle handle, Rect* bounds) { if (const auto window = GetWindow(handle)) window->GetBounds(bounds); }
+	EXPORT void Gluino_Window_GetSnapshot(const WindowHandle handle, WindowSnapshot* snapshot) { if (const auto window = GetWindow(handle)) *snapshot = window->GetSnapshot(); }
+
+	EXPORT bool Gluino_Window_GetIsDarkMode(const WindowHandle handle) { const auto window = GetWindow(handle); return window && window->GetIsDarkMode(); }
+
+	EXPORT autostr Gluino_Window_GetTitle(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetTitle() : nullptr; }
+	EXPORT void Gluino_Window_SetTitle(const WindowHandle handle, const autostr title) { if (const auto window = GetWindow(handle)) window->SetTitle(title); }
+
+	EXPORT void Gluino_Window_GetIcon(const WindowHandle handle, void** data, int* size) { if (const auto window = GetWindow(handle)) window->GetIcon(data, size); }
+	EXPORT void Gluino_Window_SetIcon(const WindowHandle handle, void* data, const int size) { if (const auto window = GetWindow(handle)) window->SetIcon(data, size); }
 
+	EXPORT WindowBorderStyle Gluino_Window_GetBorderStyle(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetBorderStyle() : WindowBorderStyle{}; }
+	EXPORT void Gluino_Window_SetBorderStyle(const WindowHandle handle, const WindowBorderStyle style) { if (const auto window = GetWindow(handle)) window->SetBorderStyle(style); }
 
-	EXPORT void Gluino_Window_Show(Window* window) { window->Show(); }
-	EXPORT void Gluino_Window_Hide(Window* window) { window->Hide(); }
-	EXPORT void Gluino_Window_Close(Window* window) { window->Close(); }
-	EXPORT void Gluino_Window_Center(Window* window) { window->Center(); }
-	EXPORT void Gluino_Window_DragMove(Window* window) { window->DragMove(); }
-	EXPORT void Gluino_Window_Invoke(Window* window, const Delegate action) { window->Invoke(action); }
+	EXPORT WindowState Gluino_Window_GetWindowState(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetWindowState() : WindowState{}; }
+	EXPORT void Gluino_Window_SetWindowState(const WindowHandle handle, const WindowState state) { if (const auto window = GetWindow(handle)) window->SetWindowState(state); }
 
-	EXPORT void Gluino_Window_GetBounds(Window* window, Rect* bounds) { window->GetBounds(bounds); }
+	EXPORT WindowTheme Gluino_Window_GetTheme(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetTheme() : WindowTheme{}; }
+	EXPORT void Gluino_Window_SetTheme(const WindowHandle handle, const WindowTheme theme) { if (const auto window = GetWindow(handle)) window->SetTheme(theme); }
 
-	EXPORT bool Gluino_Window_GetIsDarkMode(Window* window) { return window->GetIsDarkMode(); }
+	EXPORT Size Gluino_Window_GetMinimumSize(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetMinimumSize() : Size{}; }
+	EXPORT void Gluino_Window_SetMinimumSize(const WindowHandle handle, Size size) { if (const auto window = GetWindow(handle)) window->SetMinimumSize(size); }
 
-	EXPORT autostr Gluino_Window_GetTitle(Window* window) { return window->GetTitle(); }
-	EXPORT void Gluino_Window_SetTitle(Window* window, const autostr title) { window->SetTitle(title); }
+	EXPORT Size Gluino_Window_GetMaximumSize(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetMaximumSize() : Size{}; }
+	EXPORT void Gluino_Window_SetMaximumSize(const WindowHandle handle, Size size) { if (const auto window = GetWindow(handle)) window->SetMaximumSize(size); }
 
-	EXPORT void Gluino_Window_GetIcon(Window* window, void** data, int* size) { window->GetIcon(data, size); }
-	EXPORT void Gluino_Window_SetIcon(Window* window, void* data, const int size) { window->SetIcon(data, size); }
+	EXPORT Size Gluino_Window_GetSize(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetSize() : Size{}; }
+	EXPORT void Gluino_Window_SetSize(const WindowHandle handle, Size size) { if (const auto window = GetWindow(handle)) window->SetSize(size); }
 
-	EXPORT WindowBorderStyle Gluino_Window_GetBorderStyle(Window* window) { return window->GetBorderStyle(); }
-	EXPORT void Gluino_Window_SetBorderStyle(Window* window, const WindowBorderStyle style) { window->SetBorderStyle(style); }
+	EXPORT Point Gluino_Window_GetLocation(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetLocation() : Point{}; }
+	EXPORT void Gluino_Window_SetLocation(const WindowHandle handle, Point location) { if (const auto window = GetWindow(handle)) window->SetLocation(location); }
 
-	EXPORT WindowState Gluino_Window_GetWindowState(Window* window) { return window->GetWindowState(); }
-	EXPORT void Gluino_Window_SetWindowState(Window* window, const WindowState state) { window->SetWindowState(state); }
+	EXPORT bool Gluino_Window_GetMinimizeEnabled(const WindowHandle handle) { const auto window = GetWindow(handle); return window && window->GetMinimizeEnabled(); }
+	EXPORT void Gluino_Window_SetMinimizeEnabled(const WindowHandle handle, const bool enabled) { if (const auto window = GetWindow(handle)) window->SetMinimizeEnabled(enabled); }
 
-	EXPORT WindowTheme Gluino_Window_GetTheme(Window* window) { return window->GetTheme(); }
-	EXPORT void Gluino_Window_SetTheme(Window* window, const WindowTheme theme) { window->SetTheme(theme); }
+	EXPORT bool Gluino_Window_GetMaximizeEnabled(const WindowHandle handle) { const auto window = GetWindow(handle); return window && window->GetMaximizeEnabled(); }
+	EXPORT void Gluino_Window_SetMaximizeEnabled(const WindowHandle handle, const bool enabled) { if (const auto window = GetWindow(handle)) window->SetMaximizeEnabled(enabled); }
 
-	EXPORT Size Gluino_Window_GetMinimumSize(Window* window) { return window->GetMinimumSize(); }
-	EXPORT void Gluino_Window_SetMinimumSize(Window* window, Size size) { window->SetMinimumSize(size); }
+	EXPORT bool Gluino_Window_GetTopMost(const WindowHandle handle) { const auto window = GetWindow(handle); return window && window->GetTopMost(); }
+	EXPORT void Gluino_Window_SetTopMost(const WindowHandle handle, const bool topMost) { if (const auto window = GetWindow(handle)) window->SetTopMost(topMost); }
 
-	EXPORT Size Gluino_Window_GetMaximumSize(Window* window) { return window->GetMaximumSize(); }
-	EXPORT void Gluino_Window_SetMaximumSize(Window* window, Size size) { window->SetMaximumSize(size); }
+	EXPORT void Gluino_Window_ApplyChanges(const WindowHandle handle, const WindowChangeSet* changes) { if (const auto window = GetWindow(handle)) window->ApplyChanges(*changes); }
 
-	EXPORT Size Gluino_Window_GetSize(Window* window) { return window->GetSize(); }
-	EXPORT void Gluino_Window_SetSize(Window* window, Size size) { window->SetSize(size); }
+	EXPORT int Gluino_Window_GetGeometryEventInterval(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetGeometryEventInterval() : 0; }
+	EXPORT void Gluino_Window_SetGeometryEventInterval(const WindowHandle handle, const int interval) { if (const auto window = GetWindow(handle)) window->SetGeometryEventInterval(interval); }
+	EXPORT bool Gluino_Window_GetBackgroundThrottling(const WindowHandle handle) { const auto window = GetWindow(handle); return window && window->GetBackgroundThrottling(); }
+	EXPORT void Gluino_Window_SetBackgroundThrottling(const WindowHandle handle, const bool enabled) { if (const auto window = GetWindow(handle)) window->SetBackgroundThrottling(enabled); }
+	EXPORT int Gluino_Window_GetBrowserSuspendDelay(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetBrowserSuspendDelay() : -1; }
+	EXPORT void Gluino_Window_SetBrowserSuspendDelay(const WindowHandle handle, const int delay) { if (const auto window = GetWindow(handle)) window->SetBrowserSuspendDelay(delay); }
+	EXPORT ThrottleLevel Gluino_Window_GetThrottleLevel(const WindowHandle handle) { const auto window = GetWindow(handle); return window ? window->GetThrottleLevel() : ThrottleLevel{}; }
+	EXPORT WebViewHandle Gluino_Window_AddWebView(const WindowHandle handle, WebViewOptions* options, WebViewEvents* events, int* viewId) {
+		const auto window = GetWindow(handle);
+		const auto webView = window ? window->AddWebView(options, events) : nullptr;
+		if (!webView)
+			return 0;
+		*viewId = webView->GetViewId();
+		return webView->GetRegistryHandle();
+	}
+	EXPORT bool Gluino_Window_RemoveWebView(const WindowHandle handle, const WebViewHandle webView) {
+		const auto window = GetWindow(handle);
+		const auto instance = GetWebView(webView);
+		return window && instance && window->RemoveWebView(instance);
+	}
+	EXPORT int Gluino_Window_GetWebViewZIndex(const WindowHandle handle, const WebViewHandle webView) { const auto window = GetWindow(handle); return window ? window->GetWebViewZIndex(GetWebView(webView)) : -1; }
+	EXPORT void Gluino_Window_SetWebViewZIndex(const WindowHandle handle, const WebViewHandle webView, const int index) { const auto window = GetWindow(handle); if (const auto instance = GetWebView(webView); window && instance) window->SetWebViewZIndex(instance, index); }
+	EXPORT bool Gluino_Window_SwapWebViews(const WindowHandle handle, const WebViewHandle current, const WebViewHandle replacement) { const auto window = GetWindow(handle); const auto a = GetWebView(current); const auto b = GetWebView(replacement); return window && a && b && window->SwapWebViews(a, b); }
+
+
+	EXPORT void Gluino_WebView_Navigate(const WebViewHandle handle, const autostr url) { if (const auto webView = GetWebView(handle)) webView->Navigate(url); }
+	EXPORT void Gluino_WebView_NativateToString(const WebViewHandle handle, const autostr str) { if (const auto webView = GetWebView(handle)) webView->NativateToString(str); }
+	EXPORT void Gluino_WebView_PostWebMessage(const WebViewHandle handle, const autostr message) { if (const auto webView = GetWebView(handle)) webView->PostWebMessage(message); }
+	EXPORT void Gluino_WebView_InjectScript(const WebViewHandle handle, const autostr script, const bool onDocumentCreated) { if (const auto webView = GetWebView(handle)) webView->InjectScript(script, onDocumentCreated); }
 
-	EXPORT Point Gluino_Window_GetLocation(Window* window) { return window->GetLocation(); }
-	EXPORT void Gluino_Window_SetLocation(Window* window, Point location) { window->SetLocation(location); }
+	EXPORT bool Gluino_WebView_GetGrantPermissions(const WebViewHandle handle) { const auto webView = GetWebView(handle); return webView && webView->GetGrantPermissions(); }
 
-	EXPORT bool Gluino_Window_GetMinimizeEnabled(Window* window) { return window->GetMinimizeEnabled(); }
-	EXPORT void Gluino_Window_SetMinimizeEnabled(Window* window, const bool enabled) { window->SetMinimizeEnabled(enabled); }
+	EXPORT bool Gluino_WebView_GetContextMenuEnabled(const WebViewHandle handle) { const auto webView = GetWebView(handle); return webView && webView->GetContextMenuEnabled(); }
+	EXPORT void Gluino_WebView_SetContextMenuEnabled(const WebViewHandle handle, const bool enabled) { if (const auto webView = GetWebView(handle)) webView->SetContextMenuEnabled(enabled); }
 
-	EXPORT bool Gluino_Window_GetMaximizeEnabled(Window* window) { return window->GetMaximizeEnabled(); }
-	EXPORT void Gluino_Window_SetMaximizeEnabled(Window* window, const bool enabled) { window->SetMaximizeEnabled(enabled); }
+	EXPORT bool Gluino_WebView_GetDevToolsEnabled(const WebViewHandle handle) { const auto webView = GetWebView(handle); return webView && webView->GetDevToolsEnabled(); }
+	EXPORT void Gluino_WebView_SetDevToolsEnabled(const WebViewHandle handle, const bool enabled) { if (const auto webView = GetWebView(handle)) webView->SetDevToolsEnabled(enabled); }
 
-	EXPORT bool Gluino_Window_GetTopMost(Window* window) { return window->GetTopMost(); }
-	EXPORT void Gluino_Window_SetTopMost(Window* window, const bool topMost) { window->SetTopMost(topMost); }
+	EXPORT autostr Gluino_WebView_GetUserAgent(const WebViewHandle handle) { const auto webView = GetWebView(handle); return webView ? webView->GetUserAgent() : nullptr; }
+	EXPORT void Gluino_WebView_SetUserAgent(const WebViewHandle handle, const autostr userAgent) { if (const auto webView = GetWebView(handle)) webView->SetUserAgent(userAgent); }
 
+	EXPORT void Gluino_WebView_MountVfs(const WebViewHandle handle, const autostr prefix, Vfs* vfs) { if (const auto webView = GetWebView(handle)) webView->Mount(ToUtf8(prefix), vfs); }
+	EXPORT void Gluino_WebView_MountPlugin(const WebViewHandle handle, const autostr prefix, Plugin* plugin) { if (const auto webView = GetWebView(handle)) webView->Mount(ToUtf8(prefix), plugin); }
+	EXPORT void Gluino_WebView_Unmount(const WebViewHandle handle, const autostr prefix) { if (const auto webView = GetWebView(handle)) webView->GetResourceRouter()->Unmount(ToUtf8(prefix)); }
 
-	EXPORT void Gluino_WebView_Navigate(WebView* webView, const autostr url) { webView->Navigate(url); }
-	EXPORT void Gluino_WebView_NativateToString(WebView* webView, const autostr str) { webView->NativateToString(str); }
-	EXPORT void Gluino_WebView_PostWebMessage(WebView* webView, const autostr message) { webView->PostWebMessage(message); }
-	EXPORT void Gluino_WebView_InjectScript(WebView* webView, const autostr script, const bool onDocumentCreated) { webView->InjectScript(script, onDocumentCreated); }
+	EXPORT bool Gluino_WebView_RegisterFile(const WebViewHandle handle, const autostr path, const autostr contentType, autostr url, const int urlSize) {
+		const auto webView = GetWebView(handle);
+		if (!webView) return false;
+		const auto str = ToAutoStr(webView->GetFileTokens()->Register(ToUtf8(path), ToUtf8(contentType)));
+		if (str.empty() || str.size() >= (size_t)urlSize) return false;
+		memcpy(url, str.c_str(), (str.size() + 1) * sizeof(*url));
+		return true;
+	}
+	EXPORT bool Gluino_WebView_RevokeFile(const WebViewHandle handle, const autostr url) { const auto webView = GetWebView(handle); return webView && webView->GetFileTokens()->Revoke(ToUtf8(url)); }
+
+	EXPORT void Gluino_WebView_SetPrefetchManifest(const WebViewHandle handle, const autostr route, const autostr* urls, const int count) {
+		const auto webView = GetWebView(handle);
+		if (!webView) return;
+		std::vector<std::string> manifest;
+		manifest.reserve(count);
+		for (int i = 0; i < count; ++i) manifest.push_back(ToUtf8(urls[i]));
+		webView->GetPrefetcher()->SetManifest(ToUtf8(route), std::move(manifest));
+	}
+	EXPORT void Gluino_WebView_RemovePrefetchManifest(const WebViewHandle handle, const autostr route) { if (const auto webView = GetWebView(handle)) webView->GetPrefetcher()->RemoveManifest(ToUtf8(route)); }
+	EXPORT void Gluino_WebView_Prefetch(const WebViewHandle handle, const autostr url) { if (const auto webView = GetWebView(handle)) webView->GetPrefetcher()->Prefetch(ToUtf8(url)); }
 
-	EXPORT bool Gluino_WebView_GetGrantPermissions(const WebView* webView) { return webView->GetGrantPermissions(); }
+	EXPORT void Gluino_WebView_SetBounds(const WebViewHandle handle, const Rect* bounds) { if (const auto webView = GetWebView(handle)) webView->SetBounds(bounds); }
+	EXPORT bool Gluino_WebView_GetVisible(const WebViewHandle handle) { const auto webView = GetWebView(handle); return webView && webView->GetVisible(); }
+	EXPORT void Gluino_WebView_SetVisible(const WebViewHandle handle, const bool visible) { if (const auto webView = GetWebView(handle)) webView->SetVisible(visible); }
+	EXPORT int Gluino_WebView_GetSuspendDelay(const WebViewHandle handle) { const auto webView = GetWebView(handle); return webView ? webView->GetSuspendDelay() : -1; }
+	EXPORT void Gluino_WebView_SetSuspendDelay(const WebViewHandle handle, const int delay) { if (const auto webView = GetWebView(handle)) webView->SetSuspendDelay(delay); }
+	EXPORT ThrottleLevel Gluino_WebView_GetThrottleLevel(const WebViewHandle handle) { const auto webView = GetWebView(handle); return webView ? webView->GetThrottleLevel() : ThrottleLevel{}; }
 
-	EXPORT bool Gluino_WebView_GetContextMenuEnabled(WebView* webView) { return webView->GetContextMenuEnabled(); }
-	EXPORT void Gluino_WebView_SetContextMenuEnabled(WebView* webView, const bool enabled) { webView->SetContextMenuEnabled(enabled); }
 
-	EXPORT bool Gluino_WebView_GetDevToolsEnabled(WebView* webView) { return webView->GetDevToolsEnabled(); }
-	EXPORT void Gluino_WebView_SetDevToolsEnabled(WebView* webView, const bool enabled) { webView->SetDevToolsEnabled(enabled); }
+	EXPORT Vfs* Gluino_Vfs_Create() { return new Vfs(); }
+	EXPORT void Gluino_Vfs_Destroy(const Vfs* vfs) { delete vfs; }
+	EXPORT VfsLayer* Gluino_Vfs_AddDirectory(Vfs* vfs, const autostr path, const int priority) { return vfs->AddLayer(std::make_unique<DirectoryLayer>(ToUtf8(path)), priority); }
+	EXPORT VfsLayer* Gluino_Vfs_AddZip(Vfs* vfs, const autostr path, const int priority) { return vfs->AddLayer(ZipLayer::Load(MappedFile::Open(ToUtf8(path))), priority); }
+	EXPORT VfsLayer* Gluino_Vfs_AddPack(Vfs* vfs, const autostr path, const int priority) { return vfs->AddLayer(PackLayer::Load(MappedFile::Open(ToUtf8(path))), priority); }
+	EXPORT VfsLayer* Gluino_Vfs_AddOverlay(Vfs* vfs, const int priority) { return vfs->AddLayer(std::make_unique<OverlayLayer>(), priority); }
+	EXPORT void Gluino_Vfs_RemoveLayer(Vfs* vfs, const VfsLayer* layer) { vfs->RemoveLayer(layer); }
+	EXPORT void Gluino_Vfs_Invalidate(Vfs* vfs, const autostr path) { vfs->Invalidate(ToUtf8(path)); }
+	EXPORT bool Gluino_Vfs_BuildPack(const autostr directory, const autostr output) { return PackLayer::Build(ToUtf8(directory), ToUtf8(output)); }
 
-	EXPORT autostr Gluino_WebView_GetUserAgent(WebView* webView) { return webView->GetUserAgent(); }
-	EXPORT void Gluino_WebView_SetUserAgent(WebView* webView, const autostr userAgent) { webView->SetUserAgent(userAgent); }
+	EXPORT bool Gluino_VfsOverlay_Put(VfsLayer* layer, const autostr path, const void* data, const int size) {
+		const auto overlay = dynamic_cast<OverlayLayer*>(layer);
+		if (overlay) overlay->Put(ToUtf8(path), data, size);
+		return overlay != nullptr;
+	}
+	EXPORT bool Gluino_VfsOverlay_Remove(VfsLayer* layer, const autostr path) {
+		const auto overlay = dynamic_cast<OverlayLayer*>(layer);
+		if (overlay) overlay->Remove(ToUtf8(path));
+		return overlay != nullptr;
+	}
+
+	EXPORT Plugin* Gluino_Plugin_Load(const autostr path, const autostr options) { return Plugin::Load(ToUtf8(path), ToUtf8(options)).release(); }
+	EXPORT void Gluino_Plugin_Destroy(const Plugin* plugin) { delete plugin; }
+
+	EXPORT LoopbackServer* Gluino_Loopback_Create(const LoopbackServerEvents* events) { return new LoopbackServer(events); }
+	EXPORT void Gluino_Loopback_Destroy(const LoopbackServer* server) { delete server; }
+	EXPORT bool Gluino_Loopback_Start(LoopbackServer* server) { return server->Start(); }
+	EXPORT void Gluino_Loopback_Stop(LoopbackServer* server) { server->Stop(); }
+	EXPORT int Gluino_Loopback_GetPort(const LoopbackServer* server) { return server->GetPort(); }
+	EXPORT bool Gluino_Loopback_GetBaseUrl(const LoopbackServer* server, autostr url, const int urlSize) {
+		const auto str = ToAutoStr(server->GetBaseUrl());
+		if (str.size() >= (size_t)urlSize) return false;
+		memcpy(url, str.c_str(), (str.size() + 1) * sizeof(*url));
+		return true;
+	}
+	EXPORT void Gluino_Loopback_MountVfs(LoopbackServer* server, const autostr prefix, Vfs* vfs) { server->GetResourceRouter()->Mount(ToUtf8(prefix), vfs); }
+	EXPORT void Gluino_Loopback_Unmount(LoopbackServer* server, const autostr prefix) { server->GetResourceRouter()->Unmount(ToUtf8(prefix)); }
+	EXPORT bool Gluino_Loopback_Send(LoopbackServer* server, const int connectionId, const void* data, const int size, const bool binary) { return server->Send(connectionId, data, size, binary); }
+	EXPORT void Gluino_Loopback_Close(LoopbackServer* server, const int connectionId) { server->Close(connectionId); }
+	EXPORT void Gluino_Loopback_Respond(LoopbackResponse* response, const int statusCode, const autostr contentType, const void* data, const int size) {
+		response->StatusCode = statusCode;
+		response->ContentType = ToUtf8(contentType);
+		response->Body.assign((const char*)data, (const char*)data + size);
+	}
+
+	EXPORT HotReload* Gluino_HotReload_Create(Vfs* vfs, const VfsLayer* layer) {
+		const auto directory = dynamic_cast<const DirectoryLayer*>(layer);
+		return directory ? new HotReload(vfs, directory) : nullptr;
+	}
+	EXPORT void Gluino_HotReload_Destroy(const HotReload* hotReload) { delete hotReload; }
+	EXPORT bool Gluino_HotReload_Start(HotReload* hotReload) { return hotReload->Start(); }
+	EXPORT void Gluino_HotReload_Stop(HotReload* hotReload) { hotReload->Stop(); }
+	EXPORT void Gluino_HotReload_Subscribe(HotReload* hotReload, const WindowHandle window, const WebViewHandle webView) { if (GetWebView(webView)) hotReload->Subscribe(window, webView); }
+	EXPORT void Gluino_HotReload_Unsubscribe(HotReload* hotReload, const WebViewHandle webView) { hotReload->Unsubscribe(webView); }
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "file_tokens.h"
+
+using namespace Gluino;
+
+namespace {
+
+std::string_view GetToken(std::string_view path) {
+	if (path.starts_with(FileTokens::Prefix))
+		path.remove_prefix(std::char_traits<char>::length(FileTokens::Prefix));
+	return path.substr(0, path.find('/'));
+}
+
+std::string_view GetFileName(const std::string& path) {
+	const auto slash = path.find_last_of("/\\");
+	return slash == std::string::npos ? path : std::string_view(path).substr(slash + 1);
+}
+
+}
+
+std::string FileTokens::Register(const std::string& path, const std::string& contentType) {
+	auto file = FileBlob::Open(path);
+	if (!file)
+		return {};
+
+	const auto name = GetFileName(path);
+	Entry entry{ std::move(file), contentType.empty() ? GetMimeType(name) : contentType, path };
+
+	std::lock_guard lock(_mutex);
+
+	auto token = GenerateToken(TokenLength);
+	while (_entries.contains(token))
+		token = GenerateToken(TokenLength);
+	_entries.emplace(token, std::move(entry));
+
+	std::string url = Prefix;
+	url.append(token).append("/").append(name);
+	return url;
+}
+
+bool FileTokens::Revoke(const std::string_view url) {
+	std::lock_guard lock(_mutex);
+	return _entries.erase(std::string(GetToken(url))) > 0;
+}
+
+void FileTokens::RevokeAll() {
+	std::lock_guard lock(_mutex);
+	_entries.clear();
+}
+
+bool FileTokens::HandleRequest(const ResourceQuery& query, const std::string_view path, ResourceResult* result) {
+	if (query.Method != "GET" && query.Method != "HEAD")
+		return false;
+
+	std::shared_ptr<FileBlob> file;
+	{
+		std::lock_guard lock(_mutex);
+		const auto it = _entries.find(std::string(GetToken(path)));
+		if (it == _entries.end())
+			return false;
+		// A file that shrank or grew is opened again so the response has its current length.
+		// Changes while a response is streamed only cut it short.
+		if (it->second.File->IsResized()) {
+			auto reopened = FileBlob::Open(it->second.Path);
+			if (!reopened)
+				return false;
+			it->second.File = std::move(reopened);
+		}
+
+		file = it->second.File;
+		result->ContentType = it->second.ContentType;
+	}
+
+	result->StatusCode = 200;
+	SetResourceContent(query, std::move(file), result);
+	return true;
+}
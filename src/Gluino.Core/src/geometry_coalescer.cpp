@@ -0,0 +1,46 @@
+#include "geometry_coalescer.h"
+
+using namespace Gluino;
+
+GeometryCoalescer::GeometryCoalescer(const Clock::duration interval) : _interval(interval.count()) {}
+
+void GeometryCoalescer::SetInterval(const Clock::duration interval) {
+	_interval.store(interval.count(), std::memory_order_relaxed);
+}
+
+GeometryCoalescer::Clock::duration GeometryCoalescer::GetInterval() const {
+	return Clock::duration(_interval.load(std::memory_order_relaxed));
+}
+
+bool GeometryCoalescer::Resize(const Size& size, const Clock::time_point now) {
+	_pending.Resized = true;
+	_pending.Size = size;
+	return IsDue(now);
+}
+
+bool GeometryCoalescer::Move(const Point& location, const Clock::time_point now) {
+	_pending.Moved = true;
+	_pending.Location = location;
+	return IsDue(now);
+}
+
+bool GeometryCoalescer::Poll(const Clock::time_point now, GeometryUpdate* update) {
+	if (!IsDue(now))
+		return false;
+
+	_lastDelivery = now;
+	return Flush(update);
+}
+
+bool GeometryCoalescer::Flush(GeometryUpdate* update) {
+	if (!HasPending())
+		return false;
+
+	*update = _pending;
+	_pending = {};
+	return true;
+}
+
+bool GeometryCoalescer::IsDue(const Clock::time_point now) const {
+	return HasPending() && now >= GetDeadline();
+}
@@ -0,0 +1,161 @@
+#include "hot_reload.h"
+#include "webview_base.h"
+#include "window_base.h"
+
+#include <algorithm>
+
+using namespace Gluino;
+
+namespace {
+
+// Guards the links between file systems and the hot reloads watching them. Held while a
+// watcher starts or stops, so a linked file system outlives the watcher thread.
+std::mutex linkMutex;
+
+constexpr auto MessagePrefix = "gluino:changed:";
+
+constexpr auto ClientScript = R"((function () {
+  const prefix = 'gluino:changed:';
+  window.gluino.addListener(function (e) {
+    if (typeof e !== 'string' || !e.startsWith(prefix)) return;
+    const paths = JSON.parse(e.slice(prefix.length));
+    if (!paths) {
+      location.reload();
+      return;
+    }
+    const links = Array.from(document.querySelectorAll('link[rel="stylesheet"]'));
+    let reload = false;
+    for (const path of paths) {
+      if (!path.endsWith('.css')) {
+        reload = true;
+        break;
+      }
+      for (const link of links) {
+        const href = link.href.split(/[?#]/)[0];
+        if (href.endsWith('/' + path)) link.href = href + '?v=' + Date.now();
+      }
+    }
+    if (reload) location.reload();
+  });
+})();)";
+
+std::string ToJsonArray(const std::vector<std::string>& values) {
+	std::string json = "[";
+	for (const auto& value : values) {
+		if (json.size() > 1) json.push_back(',');
+		json.push_back('"');
+		for (const char c : value) {
+			switch (c) {
+				case '"':  json += "\\\""; break;
+				case '\\': json += "\\\\"; break;
+				case '\n': json += "\\n"; break;
+				case '\r': json += "\\r"; break;
+				case '\t': json += "\\t"; break;
+				default:
+					if ((unsigned char)c < 0x20) {
+						char escaped[8];
+						snprintf(escaped, sizeof escaped, "\\u%04x", c);
+						json += escaped;
+					}
+					else {
+						json.push_back(c);
+					}
+					break;
+			}
+		}
+		json.push_back('"');
+	}
+	json.push_back(']');
+	return json;
+}
+
+}
+
+HotReload::HotReload(Vfs* vfs, const DirectoryLayer* layer)
+	: _vfs(vfs), _layer(layer), _watcher(layer->GetRoot(), [this](const auto& paths, const bool overflow) { OnChanged(paths, overflow); }) {
+	std::lock_guard lock(linkMutex);
+	_vfs->_hotReloads.push_back(this);
+}
+
+HotReload::~HotReload() {
+	std::lock_guard lock(linkMutex);
+	_watcher.Stop();
+	if (_vfs)
+		std::erase(_vfs->_hotReloads, this);
+}
+
+bool HotReload::Start() {
+	std::lock_guard lock(linkMutex);
+	return _vfs && _watcher.Start();
+}
+
+void HotReload::Stop() {
+	std::lock_guard lock(linkMutex);
+	_watcher.Stop();
+}
+
+void HotReload::Release(Vfs* vfs, const VfsLayer* layer) {
+	std::lock_guard lock(linkMutex);
+	std::erase_if(vfs->_hotReloads, [layer](HotReload* hotReload) {
+		if (layer && hotReload->_layer != layer)
+			return false;
+
+		hotReload->_watcher.Stop();
+		hotReload->_vfs = nullptr;
+		hotReload->_layer = nullptr;
+		return true;
+	});
+}
+
+void HotReload::Subscribe(const WindowHandle window, const WebViewHandle webView) {
+	const auto instance = WindowRegistry.Pin(window);
+	if (!instance)
+		return;
+
+	{
+		std::lock_guard lock(_mutex);
+		_subscribers.push_back({ window, webView });
+	}
+
+	instance->Dispatch([webView] {
+		const auto target = WebViewRegistry.Pin(webView);
+		if (!target)
+			return;
+
+		auto script = ToAutoStr(ClientScript);
+		target->InjectScript(script.data(), true);
+		target->InjectScript(script.data(), false);
+	});
+}
+
+void HotReload::Unsubscribe(const WebViewHandle webView) {
+	std::lock_guard lock(_mutex);
+	std::erase_if(_subscribers, [&](const Subscriber& s) { return s.WebView == webView; });
+}
+
+void HotReload::OnChanged(const std::vector<std::string>& paths, const bool overflow) {
+	// When the watcher lost track of what changed, everything is treated as changed.
+	if (overflow)
+		_vfs->InvalidateAll();
+	else
+		for (const auto& path : paths)
+			_vfs->Invalidate(path);
+
+	const auto message = MessagePrefix + (overflow ? std::string("null") : ToJsonArray(paths));
+
+	std::lock_guard lock(_mutex);
+	std::erase_if(_subscribers, [&](const Subscriber& subscriber) {
+		const auto window = WindowRegistry.Pin(subscriber.Window);
+		if (!window || !WebViewRegistry.Get(subscriber.WebView))
+			return true;
+
+		// The webview may still close before the message is delivered.
+		window->Dispatch([webView = subscriber.WebView, message] {
+			if (const auto target = WebViewRegistry.Pin(webView)) {
+				auto str = ToAutoStr(message);
+				target->PostWebMessage(str.data());
+			}
+		});
+		return false;
+	});
+}
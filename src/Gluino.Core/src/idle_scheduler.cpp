@@ -0,0 +1,69 @@
+#include "idle_scheduler.h"
+
+#include <algorithm>
+
+using namespace Gluino;
+
+int IdleScheduler::Post(Task task) {
+	std::lock_guard lock(_mutex);
+	const auto id = _nextId++;
+	_tasks.push_back({ id, std::move(task) });
+	_count.fetch_add(1, std::memory_order_release);
+	return id;
+}
+
+bool IdleScheduler::Cancel(const int id) {
+	std::lock_guard lock(_mutex);
+	if (id == _runningId) {
+		_runningCancelled = true;
+		return true;
+	}
+
+	const auto it = std::find_if(_tasks.begin(), _tasks.end(), [id](const Entry& entry) { return entry.Id == id; });
+	if (it == _tasks.end())
+		return false;
+
+	_tasks.erase(it);
+	_count.fetch_sub(1, std::memory_order_release);
+	return true;
+}
+
+bool IdleScheduler::RunSlice(const std::function<bool()>& shouldYield) {
+	const auto deadline = Clock::now() + GetBudget();
+
+	while (Clock::now() < deadline && !(shouldYield && shouldYield())) {
+		Entry entry;
+		{
+			std::lock_guard lock(_mutex);
+			if (_tasks.empty())
+				break;
+
+			entry = std::move(_tasks.front());
+			_tasks.pop_front();
+			_runningId = entry.Id;
+			_runningCancelled = false;
+		}
+
+		const auto more = entry.Run(deadline);
+
+		std::lock_guard lock(_mutex);
+		_runningId = 0;
+		if (more && !_runningCancelled) {
+			// Round-robin so one long task cannot starve the others.
+			_tasks.push_back(std::move(entry));
+		}
+		else {
+			_count.fetch_sub(1, std::memory_order_release);
+		}
+	}
+
+	return HasWork();
+}
+
+void IdleScheduler::SetBudget(const Clock::duration budget) {
+	_budget.store(budget.count(), std::memory_order_relaxed);
+}
+
+IdleScheduler::Clock::duration IdleScheduler::GetBudget() const {
+	return Clock::duration(_budget.load(std::memory_order_relaxed));
+}
@@ -0,0 +1,238 @@
+#include "inflate.h"
+
+#include <cstdint>
+
+using namespace Gluino;
+
+namespace {
+
+struct Tree {
+	uint16_t Counts[16];
+	uint16_t Symbols[288];
+};
+
+struct State {
+	const uint8_t* Src;
+	const uint8_t* End;
+	uint32_t Tag;
+	int BitCount;
+	bool Error;
+	size_t Limit;
+	std::vector<char>* Out;
+};
+
+constexpr uint16_t LengthBase[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+constexpr uint8_t LengthBits[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+constexpr uint16_t DistBase[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+constexpr uint8_t DistBits[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+constexpr uint8_t CodeLengthOrder[] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+void BuildTree(Tree& tree, const uint8_t* lengths, const unsigned count) {
+	uint16_t offsets[16];
+
+	for (auto& c : tree.Counts) c = 0;
+	for (unsigned i = 0; i < count; ++i) tree.Counts[lengths[i]]++;
+	tree.Counts[0] = 0;
+
+	for (unsigned i = 0, sum = 0; i < 16; ++i) {
+		offsets[i] = (uint16_t)sum;
+		sum += tree.Counts[i];
+	}
+
+	for (unsigned i = 0; i < count; ++i) {
+		if (lengths[i]) tree.Symbols[offsets[lengths[i]]++] = (uint16_t)i;
+	}
+}
+
+void BuildFixedTrees(Tree& lit, Tree& dist) {
+	uint8_t lengths[288];
+	for (int i = 0; i < 144; ++i) lengths[i] = 8;
+	for (int i = 144; i < 256; ++i) lengths[i] = 9;
+	for (int i = 256; i < 280; ++i) lengths[i] = 7;
+	for (int i = 280; i < 288; ++i) lengths[i] = 8;
+	BuildTree(lit, lengths, 288);
+
+	for (int i = 0; i < 30; ++i) lengths[i] = 5;
+	BuildTree(dist, lengths, 30);
+}
+
+unsigned GetBit(State& s) {
+	if (s.BitCount-- == 0) {
+		if (s.Src >= s.End) {
+			s.Error = true;
+			return 0;
+		}
+		s.Tag = *s.Src++;
+		s.BitCount = 7;
+	}
+
+	const unsigned bit = s.Tag & 1;
+	s.Tag >>= 1;
+	return bit;
+}
+
+unsigned ReadBits(State& s, const int count, const unsigned base) {
+	unsigned value = 0;
+	for (int i = 0; i < count; ++i)
+		value |= GetBit(s) << i;
+	return value + base;
+}
+
+int DecodeSymbol(State& s, const Tree& tree) {
+	int sum = 0, cur = 0, len = 0;
+
+	do {
+		cur = 2 * cur + (int)GetBit(s);
+		if (++len > 15) {
+			s.Error = true;
+			return 0;
+		}
+		sum += tree.Counts[len];
+		cur -= tree.Counts[len];
+	} while (cur >= 0 && !s.Error);
+
+	return s.Error ? 0 : tree.Symbols[sum + cur];
+}
+
+bool DecodeDynamicTrees(State& s, Tree& lit, Tree& dist) {
+	uint8_t lengths[288 + 32] = {};
+	Tree codeTree;
+
+	const unsigned hlit = ReadBits(s, 5, 257);
+	const unsigned hdist = ReadBits(s, 5, 1);
+	const unsigned hclen = ReadBits(s, 4, 4);
+	if (hlit > 286 || hdist > 30)
+		return false;
+
+	for (unsigned i = 0; i < hclen; ++i)
+		lengths[CodeLengthOrder[i]] = (uint8_t)ReadBits(s, 3, 0);
+	BuildTree(codeTree, lengths, 19);
+
+	for (unsigned i = 0; i < hlit + hdist;) {
+		const int sym = DecodeSymbol(s, codeTree);
+		if (s.Error)
+			return false;
+
+		unsigned repeat;
+		uint8_t value = 0;
+		switch (sym) {
+			case 16:
+				if (i == 0) return false;
+				value = lengths[i - 1];
+				repeat = ReadBits(s, 2, 3);
+				break;
+			case 17:
+				repeat = ReadBits(s, 3, 3);
+				break;
+			case 18:
+				repeat = ReadBits(s, 7, 11);
+				break;
+			default:
+				value = (uint8_t)sym;
+				repeat = 1;
+				break;
+		}
+
+		if (i + repeat > hlit + hdist)
+			return false;
+		while (repeat--) lengths[i++] = value;
+	}
+
+	BuildTree(lit, lengths, hlit);
+	BuildTree(dist, lengths + hlit, hdist);
+	return !s.Error;
+}
+
+bool InflateBlock(State& s, const Tree& lit, const Tree& dist) {
+	auto& out = *s.Out;
+
+	for (;;) {
+		if (out.size() > s.Limit)
+			return false;
+
+		const int sym = DecodeSymbol(s, lit);
+		if (s.Error)
+			return false;
+
+		if (sym < 256) {
+			out.push_back((char)sym);
+			continue;
+		}
+		if (sym == 256)
+			return true;
+
+		const int lengthIndex = sym - 257;
+		if (lengthIndex >= 29)
+			return false;
+		const unsigned length = ReadBits(s, LengthBits[lengthIndex], LengthBase[lengthIndex]);
+
+		const int distIndex = DecodeSymbol(s, dist);
+		if (s.Error || distIndex >= 30)
+			return false;
+		const unsigned offset = ReadBits(s, DistBits[distIndex], DistBase[distIndex]);
+		if (s.Error || offset > out.size())
+			return false;
+
+		const size_t start = out.size() - offset;
+		for (unsigned i = 0; i < length; ++i)
+			out.push_back(out[start + i]);
+	}
+}
+
+bool InflateStored(State& s) {
+	s.BitCount = 0;
+
+	if (s.End - s.Src < 4)
+		return false;
+	const unsigned length = s.Src[0] | s.Src[1] << 8;
+	const unsigned inverse = s.Src[2] | s.Src[3] << 8;
+	if (length != (~inverse & 0xFFFF))
+		return false;
+	s.Src += 4;
+
+	if ((size_t)(s.End - s.Src) < length)
+		return false;
+	s.Out->insert(s.Out->end(), (const char*)s.Src, (const char*)s.Src + length);
+	s.Src += length;
+	return true;
+}
+
+}
+
+bool Gluino::Inflate(const char* data, const size_t size, const size_t expectedSize, std::vector<char>* output) {
+	State s{ (const uint8_t*)data, (const uint8_t*)data + size, 0, 0, false, expectedSize, output };
+	Tree lit, dist;
+
+	output->clear();
+	output->reserve(expectedSize);
+
+	unsigned final;
+	do {
+		final = GetBit(s);
+		const unsigned type = ReadBits(s, 2, 0);
+		if (s.Error)
+			return false;
+
+		bool ok;
+		switch (type) {
+			case 0:
+				ok = InflateStored(s);
+				break;
+			case 1:
+				BuildFixedTrees(lit, dist);
+				ok = InflateBlock(s, lit, dist);
+				break;
+			case 2:
+				ok = DecodeDynamicTrees(s, lit, dist) && InflateBlock(s, lit, dist);
+				break;
+			default:
+				ok = false;
+				break;
+		}
+
+		if (!ok || output->size() > expectedSize)
+			return false;
+	} while (!final);
+
+	return output->size() == expectedSize;
+}
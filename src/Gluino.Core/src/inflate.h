@@ -0,0 +1,15 @@
+#pragma once
+
+#ifndef GLUINO_INFLATE_H
+#define GLUINO_INFLATE_H
+
+#include <cstddef>
+#include <vector>
+
+namespace Gluino {
+
+bool Inflate(const char* data, size_t size, size_t expectedSize, std::vector<char>* output);
+
+}
+
+#endif // !GLUINO_INFLATE_H
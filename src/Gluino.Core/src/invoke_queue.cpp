@@ -0,0 +1,81 @@
+#include "invoke_queue.h"
+
+#include <memory>
+
+using namespace Gluino;
+
+InvokeQueue::InvokeQueue() : _head(&_stub), _tail(&_stub) {}
+
+InvokeQueue::~InvokeQueue() {
+	while (const auto node = Dequeue())
+		delete node;
+}
+
+bool InvokeQueue::Push(std::function<void()> task) {
+	const auto node = new Node();
+	node->Task = std::move(task);
+	_pending.fetch_add(1, std::memory_order_relaxed);
+	Enqueue(node);
+
+	return !_wakePending.exchange(true, std::memory_order_acq_rel);
+}
+
+bool InvokeQueue::Drain(const size_t limit) {
+	_wakePending.store(false, std::memory_order_release);
+
+	for (size_t i = 0; i < limit; ++i) {
+		const auto node = Dequeue();
+		if (!node)
+			return false;
+
+		const std::unique_ptr<Node> owner(node);
+		owner->Task();
+		_pending.fetch_sub(1, std::memory_order_release);
+	}
+
+	if (IsEmpty())
+		return false;
+
+	return !_wakePending.exchange(true, std::memory_order_acq_rel);
+}
+
+bool InvokeQueue::IsEmpty() const {
+	return _pending.load(std::memory_order_acquire) == 0;
+}
+
+void InvokeQueue::Enqueue(Node* node) {
+	node->Next.store(nullptr, std::memory_order_relaxed);
+	const auto previous = _head.exchange(node, std::memory_order_acq_rel);
+	previous->Next.store(node, std::memory_order_release);
+}
+
+InvokeQueue::Node* InvokeQueue::Dequeue() {
+	auto tail = _tail;
+	auto next = tail->Next.load(std::memory_order_acquire);
+
+	if (tail == &_stub) {
+		if (!next)
+			return nullptr;
+		_tail = next;
+		tail = next;
+		next = next->Next.load(std::memory_order_acquire);
+	}
+
+	if (next) {
+		_tail = next;
+		return tail;
+	}
+
+	if (tail != _head.load(std::memory_order_acquire))
+		return nullptr;
+
+	Enqueue(&_stub);
+
+	next = tail->Next.load(std::memory_order_acquire);
+	if (next) {
+		_tail = next;
+		return tail;
+	}
+
+	return nullptr;
+}
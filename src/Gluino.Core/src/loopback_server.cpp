@@ -0,0 +1,541 @@
+#include "loopback_server.h"
+#include "websocket.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#include <WinSock2.h>
+#include <WS2tcpip.h>
+
+#pragma comment(lib, "Ws2_32.lib")
+
+#define SHUT_RDWR SD_BOTH
+#define MSG_NOSIGNAL 0
+
+typedef SOCKET SocketHandle;
+typedef int socklen_t;
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define closesocket close
+
+typedef int SocketHandle;
+#endif
+
+using namespace Gluino;
+
+namespace {
+
+constexpr size_t TokenLength = 32;
+constexpr size_t ReceiveBufferSize = 64 * 1024;
+
+bool EqualsIgnoreCase(const std::string_view a, const std::string_view b) {
+	return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](const char x, const char y) {
+		return std::tolower((unsigned char)x) == std::tolower((unsigned char)y);
+	});
+}
+
+bool ContainsToken(const std::string_view value, const std::string_view token) {
+	size_t start = 0;
+	while (start <= value.size()) {
+		auto end = value.find(',', start);
+		if (end == std::string_view::npos)
+			end = value.size();
+
+		auto item = value.substr(start, end - start);
+		while (!item.empty() && item.front() == ' ') item.remove_prefix(1);
+		while (!item.empty() && item.back() == ' ') item.remove_suffix(1);
+		if (EqualsIgnoreCase(item, token))
+			return true;
+
+		start = end + 1;
+	}
+	return false;
+}
+
+bool Receive(const intptr_t socket, std::string* buffer) {
+	char chunk[ReceiveBufferSize];
+	const auto received = recv((SocketHandle)socket, chunk, (int)sizeof chunk, 0);
+	if (received <= 0)
+		return false;
+	buffer->append(chunk, (size_t)received);
+	return true;
+}
+
+bool ReceiveAtLeast(const intptr_t socket, std::string* buffer, const size_t size) {
+	while (buffer->size() < size) {
+		if (!Receive(socket, buffer))
+			return false;
+	}
+	return true;
+}
+
+const char* GetHttpReasonPhrase(const int statusCode) {
+	switch (statusCode) {
+		case 101: return "Switching Protocols";
+		case 411: return "Length Required";
+		case 413: return "Content Too Large";
+		case 426: return "Upgrade Required";
+		case 431: return "Request Header Fields Too Large";
+		case 501: return "Not Implemented";
+		default:  return GetReasonPhrase(statusCode);
+	}
+}
+
+}
+
+struct LoopbackServer::HttpRequest {
+	std::string Method;
+	std::string Path;
+	std::string Version;
+	std::string HeaderBlock;
+	std::vector<std::pair<std::string, std::string>> Headers;
+	std::string Body;
+
+	[[nodiscard]] std::string_view GetHeader(const std::string_view name) const {
+		for (const auto& [key, value] : Headers) {
+			if (EqualsIgnoreCase(key, name))
+				return value;
+		}
+		return {};
+	}
+
+	[[nodiscard]] bool KeepAlive() const {
+		const auto connection = GetHeader("Connection");
+		return Version == "HTTP/1.1" ? !ContainsToken(connection, "close") : ContainsToken(connection, "keep-alive");
+	}
+
+	[[nodiscard]] std::string GetCorsHeaders() const {
+		const auto origin = GetHeader("Origin");
+		std::string headers = "Access-Control-Allow-Origin: ";
+		headers.append(origin.empty() ? "*" : origin).append("\r\nVary: Origin\r\n");
+		return headers;
+	}
+};
+
+LoopbackServer::LoopbackServer(const LoopbackServerEvents* events) {
+	_onRequest = (LoopbackRequestDelegate)events->OnRequest;
+	_onSocketOpen = (LoopbackSocketDelegate)events->OnSocketOpen;
+	_onSocketMessage = (LoopbackMessageDelegate)events->OnSocketMessage;
+	_onSocketClose = (LoopbackCloseDelegate)events->OnSocketClose;
+
+#ifdef _WIN32
+	WSADATA wsaData;
+	WSAStartup(MAKEWORD(2, 2), &wsaData);
+#endif
+}
+
+LoopbackServer::~LoopbackServer() {
+	Stop();
+
+#ifdef _WIN32
+	WSACleanup();
+#endif
+}
+
+bool LoopbackServer::Start() {
+	if (_running) return true;
+
+	const auto listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (listenSocket == (SocketHandle)-1)
+		return false;
+
+	sockaddr_in address{};
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = 0;
+
+	socklen_t addressLength = sizeof address;
+	if (bind(listenSocket, (sockaddr*)&address, sizeof address) != 0 ||
+		listen(listenSocket, SOMAXCONN) != 0 ||
+		getsockname(listenSocket, (sockaddr*)&address, &addressLength) != 0) {
+		closesocket(listenSocket);
+		return false;
+	}
+
+	_listenSocket = (intptr_t)listenSocket;
+	_port = ntohs(address.sin_port);
+	_token = GenerateToken(TokenLength);
+	_running = true;
+	_acceptThread = std::thread(&LoopbackServer::Accept, this, _listenSocket);
+	return true;
+}
+
+void LoopbackServer::Stop() {
+	if (!_running.exchange(false))
+		return;
+
+	// Shutting the socket down wakes a blocked accept on POSIX, where it is closed only once the
+	// thread is gone so its descriptor cannot be reused under it; Windows needs it closed.
+	const auto listenSocket = (SocketHandle)std::exchange(_listenSocket, -1);
+	shutdown(listenSocket, SHUT_RDWR);
+#ifdef _WIN32
+	closesocket(listenSocket);
+	_acceptThread.join();
+#else
+	_acceptThread.join();
+	closesocket(listenSocket);
+#endif
+
+	std::unique_lock lock(_mutex);
+	for (const auto& [_, connection] : _connections)
+		shutdown((SocketHandle)connection->Socket, SHUT_RDWR);
+	_cv.wait(lock, [this] { return _activeConnections == 0; });
+}
+
+std::string LoopbackServer::GetBaseUrl() const {
+	return "http://127.0.0.1:" + std::to_string(_port) + "/" + _token + "/";
+}
+
+bool LoopbackServer::Send(const int connectionId, const void* data, const size_t size, const bool binary) {
+	std::shared_ptr<Connection> connection;
+	{
+		std::lock_guard lock(_mutex);
+		const auto it = _connections.find(connectionId);
+		if (it == _connections.end() || !it->second->IsWebSocket)
+			return false;
+		connection = it->second;
+	}
+
+	const auto header = EncodeWebSocketHeader(binary ? WebSocketOpcode::Binary : WebSocketOpcode::Text, size);
+
+	std::lock_guard lock(connection->SendMutex);
+	return SendAll(*connection, header.data(), header.size()) &&
+		SendAll(*connection, (const char*)data, size);
+}
+
+void LoopbackServer::Close(const int connectionId) {
+	std::lock_guard lock(_mutex);
+	if (const auto it = _connections.find(connectionId); it != _connections.end())
+		shutdown((SocketHandle)it->second->Socket, SHUT_RDWR);
+}
+
+void LoopbackServer::Accept(const intptr_t listenSocket) {
+	while (_running) {
+		const auto socket = accept((SocketHandle)listenSocket, nullptr, nullptr);
+		if (socket == (SocketHandle)-1) {
+			if (!_running) break;
+			continue;
+		}
+
+		constexpr int noDelay = 1;
+		setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, (const char*)&noDelay, sizeof noDelay);
+
+		auto connection = std::make_shared<Connection>();
+		connection->Socket = (intptr_t)socket;
+
+		int connectionId;
+		{
+			std::lock_guard lock(_mutex);
+			if (!_running) {
+				closesocket(socket);
+				break;
+			}
+			if (_activeConnections >= MaxConnections) {
+				constexpr char response[] = "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+				send(socket, response, sizeof response - 1, MSG_NOSIGNAL);
+				closesocket(socket);
+				continue;
+			}
+			connectionId = _nextConnectionId++;
+			_connections.emplace(connectionId, connection);
+			++_activeConnections;
+		}
+
+		std::thread(&LoopbackServer::Serve, this, connectionId, std::move(connection)).detach();
+	}
+}
+
+void LoopbackServer::Serve(const int connectionId, std::shared_ptr<Connection> connection) {
+	std::string buffer;
+	while (_running && ServeRequest(connectionId, *connection, buffer)) {}
+
+	std::lock_guard lock(_mutex);
+	{
+		std::lock_guard sendLock(connection->SendMutex);
+		closesocket((SocketHandle)connection->Socket);
+		connection->Socket = -1;
+	}
+	_connections.erase(connectionId);
+	--_activeConnections;
+	_cv.notify_all();
+}
+
+bool LoopbackServer::ServeRequest(const int connectionId, Connection& connection, std::string& buffer) {
+	const auto sendStatus = [&](const int statusCode) {
+		const auto response = "HTTP/1.1 " + std::to_string(statusCode) + " " + GetHttpReasonPhrase(statusCode) +
+			"\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+		SendAll(connection, response.data(), response.size());
+		return false;
+	};
+
+	size_t headerEnd;
+	while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+		if (buffer.size() > MaxHeaderSize)
+			return sendStatus(431);
+		if (!Receive(connection.Socket, &buffer))
+			return false;
+	}
+
+	HttpRequest request;
+	const std::string_view head(buffer.data(), headerEnd);
+	const auto lineEnd = head.find("\r\n");
+	const auto requestLine = head.substr(0, lineEnd);
+
+	const auto methodEnd = requestLine.find(' ');
+	const auto targetEnd = requestLine.find(' ', methodEnd + 1);
+	if (methodEnd == std::string_view::npos || targetEnd == std::string_view::npos)
+		return sendStatus(400);
+
+	request.Method = requestLine.substr(0, methodEnd);
+	request.Path = requestLine.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+	request.Version = requestLine.substr(targetEnd + 1);
+
+	for (size_t lineStart = lineEnd == std::string_view::npos ? head.size() : lineEnd + 2; lineStart < head.size();) {
+		auto end = head.find("\r\n", lineStart);
+		if (end == std::string_view::npos)
+			end = head.size();
+
+		const auto line = head.substr(lineStart, end - lineStart);
+		if (const auto colon = line.find(':'); colon != std::string_view::npos) {
+			auto value = line.substr(colon + 1);
+			while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+			request.Headers.emplace_back(line.substr(0, colon), value);
+			request.HeaderBlock.append(line).append("\r\n");
+		}
+
+		lineStart = end + 2;
+	}
+	buffer.erase(0, headerEnd + 4);
+
+	// Unauthorized requests are rejected before their body is read.
+	const auto port = std::to_string(_port);
+	if (const auto host = request.GetHeader("Host"); host != "127.0.0.1:" + port && host != "localhost:" + port)
+		return sendStatus(403);
+
+	const auto tokenPrefix = "/" + _token;
+	if (request.Path.compare(0, tokenPrefix.size(), tokenPrefix) != 0 ||
+		(request.Path.size() > tokenPrefix.size() && request.Path[tokenPrefix.size()] != '/' && request.Path[tokenPrefix.size()] != '?'))
+		return sendStatus(403);
+	request.Path.erase(0, std::min(tokenPrefix.size() + 1, request.Path.size()));
+
+	if (!request.GetHeader("Transfer-Encoding").empty())
+		return sendStatus(501);
+
+	if (const auto contentLength = request.GetHeader("Content-Length"); !contentLength.empty()) {
+		size_t length = 0;
+		if (std::from_chars(contentLength.data(), contentLength.data() + contentLength.size(), length).ec != std::errc())
+			return sendStatus(400);
+		if (length > MaxBodySize)
+			return sendStatus(413);
+		if (!ReceiveAtLeast(connection.Socket, &buffer, length))
+			return false;
+
+		request.Body = buffer.substr(0, length);
+		buffer.erase(0, length);
+	}
+
+	if (ContainsToken(request.GetHeader("Upgrade"), "websocket")) {
+		ServeWebSocket(connectionId, connection, request, std::move(buffer));
+		return false;
+	}
+
+	return ServeHttp(connection, request) && request.KeepAlive();
+}
+
+bool LoopbackServer::ServeHttp(Connection& connection, const HttpRequest& request) {
+	const auto keepAlive = request.KeepAlive();
+	std::string head;
+	const auto writeHead = [&](const int statusCode, const std::string& headers, const size_t contentLength) {
+		head = "HTTP/1.1 " + std::to_string(statusCode) + " " + GetHttpReasonPhrase(statusCode) + "\r\n";
+		head.append(headers).append(request.GetCorsHeaders());
+		head.append("Content-Length: ").append(std::to_string(contentLength)).append("\r\n");
+		head.append(keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n");
+	};
+
+	if (request.Method == "OPTIONS") {
+		std::string headers =
+			"Access-Control-Allow-Methods: GET, HEAD, POST, PUT, DELETE, OPTIONS\r\n"
+			"Access-Control-Allow-Private-Network: true\r\n"
+			"Access-Control-Max-Age: 600\r\n";
+		if (const auto requested = request.GetHeader("Access-Control-Request-Headers"); !requested.empty())
+			headers.append("Access-Control-Allow-Headers: ").append(requested).append("\r\n");
+
+		writeHead(204, headers, 0);
+		return SendAll(connection, head.data(), head.size());
+	}
+
+	const ResourceQuery query{ request.Path, request.Method, std::string(request.GetHeader("Range")), request.HeaderBlock };
+	if (ResourceResult result; _resourceRouter.Route(query, &result)) {
+		writeHead(result.StatusCode, result.GetHeaders(), result.Length);
+		if (!SendAll(connection, head.data(), head.size()))
+			return false;
+		return request.Method == "HEAD" || SendContent(connection, result);
+	}
+
+	LoopbackResponse response;
+	if (_onRequest) {
+		const LoopbackRequest nativeRequest{
+			request.Method.c_str(),
+			request.Path.c_str(),
+			request.HeaderBlock.c_str(),
+			request.Body.data(),
+			(int)request.Body.size()
+		};
+		_onRequest(&nativeRequest, &response);
+	}
+
+	std::string headers;
+	if (!response.ContentType.empty())
+		headers.append("Content-Type: ").append(response.ContentType).append("\r\n");
+
+	writeHead(response.StatusCode, headers, response.Body.size());
+	if (!SendAll(connection, head.data(), head.size()))
+		return false;
+	return request.Method == "HEAD" || SendAll(connection, response.Body.data(), response.Body.size());
+}
+
+void LoopbackServer::ServeWebSocket(const int connectionId, Connection& connection, const HttpRequest& request, std::string buffer) {
+	const auto key = request.GetHeader("Sec-WebSocket-Key");
+	if (request.Method != "GET" || key.empty() || request.GetHeader("Sec-WebSocket-Version") != "13") {
+		const std::string response = "HTTP/1.1 426 Upgrade Required\r\nSec-WebSocket-Version: 13\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+		SendAll(connection, response.data(), response.size());
+		return;
+	}
+
+	const auto response =
+		"HTTP/1.1 101 Switching Protocols\r\n"
+		"Upgrade: websocket\r\n"
+		"Connection: Upgrade\r\n"
+		"Sec-WebSocket-Accept: " + ComputeWebSocketAccept(key) + "\r\n\r\n";
+	if (!SendAll(connection, response.data(), response.size()))
+		return;
+
+	connection.IsWebSocket = true;
+	if (_onSocketOpen) _onSocketOpen(connectionId, request.Path.c_str());
+
+	const auto sendControl = [&](const WebSocketOpcode opcode, const std::string& payload) {
+		const auto header = EncodeWebSocketHeader(opcode, payload.size());
+		std::lock_guard lock(connection.SendMutex);
+		return SendAll(connection, header.data(), header.size()) && SendAll(connection, payload.data(), payload.size());
+	};
+
+	std::string message;
+	auto messageOpcode = WebSocketOpcode::Continuation;
+
+	for (auto open = true; open && _running;) {
+		if (!ReceiveAtLeast(connection.Socket, &buffer, 2))
+			break;
+
+		const auto fin = (buffer[0] & 0x80) != 0;
+		const auto opcode = (WebSocketOpcode)(buffer[0] & 0x0F);
+		const auto masked = (buffer[1] & 0x80) != 0;
+		uint64_t length = buffer[1] & 0x7F;
+		size_t offset = 2;
+
+		if (length == 126) {
+			if (!ReceiveAtLeast(connection.Socket, &buffer, 4))
+				break;
+			length = (uint64_t)(uint8_t)buffer[2] << 8 | (uint8_t)buffer[3];
+			offset = 4;
+		}
+		else if (length == 127) {
+			if (!ReceiveAtLeast(connection.Socket, &buffer, 10))
+				break;
+			length = 0;
+			for (int i = 2; i < 10; ++i)
+				length = length << 8 | (uint8_t)buffer[i];
+			offset = 10;
+		}
+
+		if (!masked || length > MaxBodySize || message.size() + length > MaxBodySize)
+			break;
+
+		if (!ReceiveAtLeast(connection.Socket, &buffer, offset + 4 + (size_t)length))
+			break;
+
+		const auto mask = buffer.data() + offset;
+		auto payload = buffer.substr(offset + 4, (size_t)length);
+		for (size_t i = 0; i < payload.size(); ++i)
+			payload[i] ^= mask[i % 4];
+		buffer.erase(0, offset + 4 + (size_t)length);
+
+		switch (opcode) {
+			case WebSocketOpcode::Ping:
+				sendControl(WebSocketOpcode::Pong, payload);
+				continue;
+			case WebSocketOpcode::Pong:
+				continue;
+			case WebSocketOpcode::Close:
+				sendControl(WebSocketOpcode::Close, payload.substr(0, 2));
+				open = false;
+				continue;
+			case WebSocketOpcode::Text:
+			case WebSocketOpcode::Binary:
+				messageOpcode = opcode;
+				message = std::move(payload);
+				break;
+			case WebSocketOpcode::Continuation:
+				if (messageOpcode == WebSocketOpcode::Continuation) {
+					open = false;
+					continue;
+				}
+				message.append(payload);
+				break;
+			default:
+				open = false;
+				continue;
+		}
+
+		if (fin) {
+			if (_onSocketMessage)
+				_onSocketMessage(connectionId, message.data(), (int)message.size(), messageOpcode == WebSocketOpcode::Binary);
+			message.clear();
+			messageOpcode = WebSocketOpcode::Continuation;
+		}
+	}
+
+	connection.IsWebSocket = false;
+	if (_onSocketClose) _onSocketClose(connectionId);
+}
+
+bool LoopbackServer::SendContent(Connection& connection, const ResourceResult& result) {
+	if (!result.Blob)
+		return result.Length == 0;
+	if (const auto data = result.Blob->GetData())
+		return SendAll(connection, data + result.Offset, result.Length);
+
+	// Blobs read on demand are sent in chunks. One that comes up short, as a file truncated
+	// while it is served does, fails the send so the connection is closed mid-body.
+	std::vector<char> buffer(std::min(result.Length, ReceiveBufferSize));
+	for (size_t sent = 0; sent < result.Length;) {
+		const auto count = result.Blob->Read(result.Offset + sent, buffer.data(), std::min(buffer.size(), result.Length - sent));
+		if (count == 0 || !SendAll(connection, buffer.data(), count))
+			return false;
+		sent += count;
+	}
+	return true;
+}
+
+bool LoopbackServer::SendAll(Connection& connection, const char* data, size_t size) {
+	if (connection.Socket == -1)
+		return false;
+
+	while (size > 0) {
+		const auto chunk = (int)std::min<size_t>(size, 1 << 30);
+		const auto sent = send((SocketHandle)connection.Socket, data, chunk, MSG_NOSIGNAL);
+		if (sent <= 0)
+			return false;
+		data += sent;
+		size -= (size_t)sent;
+	}
+	return true;
+}
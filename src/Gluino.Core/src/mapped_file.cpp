@@ -0,0 +1,171 @@
+#include "mapped_file.h"
+
+#ifdef _WIN32
+#include "common.h"
+
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+
+using namespace Gluino;
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+	if (_data) UnmapViewOfFile(_data);
+	if (_hMapping) CloseHandle(_hMapping);
+	if (_hFile && _hFile != INVALID_HANDLE_VALUE) CloseHandle(_hFile);
+#else
+	if (_data && _copy.empty()) munmap((void*)_data, _size);
+	if (_fd >= 0) close(_fd);
+#endif
+}
+
+std::shared_ptr<MappedFile> MappedFile::Open(const std::string& path) {
+	std::shared_ptr<MappedFile> file(new MappedFile());
+
+#ifdef _WIN32
+	file->_hFile = CreateFileW(ToWide(path).c_str(), GENERIC_READ,
+		FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file->_hFile == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file->_hFile, &size))
+		return nullptr;
+	file->_size = (size_t)size.QuadPart;
+	if (file->_size == 0)
+		return file;
+
+	file->_hMapping = CreateFileMappingW(file->_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!file->_hMapping)
+		return nullptr;
+
+	file->_data = (const char*)MapViewOfFile(file->_hMapping, FILE_MAP_READ, 0, 0, 0);
+	if (!file->_data)
+		return nullptr;
+#else
+	file->_fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (file->_fd < 0)
+		return nullptr;
+
+	struct stat st {};
+	if (fstat(file->_fd, &st) != 0 || !S_ISREG(st.st_mode))
+		return nullptr;
+	file->_size = (size_t)st.st_size;
+	if (file->_size == 0)
+		return file;
+
+	// Touching a shared mapping past the end of a file truncated under it raises SIGBUS. Smaller
+	// files are read once, so they are served as they were when opened; files that may change
+	// while they are served are read through a FileBlob instead.
+	if (file->_size <= CopyThreshold) {
+		file->_copy.resize(file->_size);
+		size_t offset = 0;
+		while (offset < file->_size) {
+			const auto count = pread(file->_fd, file->_copy.data() + offset, file->_size - offset, (off_t)offset);
+			if (count < 0 && errno == EINTR)
+				continue;
+			if (count <= 0)
+				break;
+			offset += (size_t)count;
+		}
+
+		file->_copy.resize(offset);
+		file->_size = offset;
+		file->_data = offset ? file->_copy.data() : nullptr;
+		close(std::exchange(file->_fd, -1));
+		return file;
+	}
+
+	void* data = mmap(nullptr, file->_size, PROT_READ, MAP_SHARED, file->_fd, 0);
+	if (data == MAP_FAILED)
+		return nullptr;
+	file->_data = (const char*)data;
+#endif
+
+	return file;
+}
+
+FileBlob::~FileBlob() {
+#ifdef _WIN32
+	if (_hFile && _hFile != INVALID_HANDLE_VALUE) CloseHandle(_hFile);
+#else
+	if (_fd >= 0) close(_fd);
+#endif
+}
+
+std::shared_ptr<FileBlob> FileBlob::Open(const std::string& path) {
+	std::shared_ptr<FileBlob> blob(new FileBlob());
+
+#ifdef _WIN32
+	blob->_hFile = CreateFileW(ToWide(path).c_str(), GENERIC_READ,
+		FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (blob->_hFile == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(blob->_hFile, &size))
+		return nullptr;
+	blob->_size = (size_t)size.QuadPart;
+#else
+	blob->_fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (blob->_fd < 0)
+		return nullptr;
+
+	struct stat st {};
+	if (fstat(blob->_fd, &st) != 0 || !S_ISREG(st.st_mode))
+		return nullptr;
+	blob->_size = (size_t)st.st_size;
+#endif
+
+	return blob;
+}
+
+size_t FileBlob::Read(const size_t offset, char* buffer, const size_t count) const {
+	if (offset >= _size)
+		return 0;
+
+	const auto total = std::min<size_t>(count, _size - offset);
+	size_t read = 0;
+	while (read < total) {
+#ifdef _WIN32
+		OVERLAPPED overlapped{};
+		const auto position = (ULONGLONG)(offset + read);
+		overlapped.Offset = (DWORD)position;
+		overlapped.OffsetHigh = (DWORD)(position >> 32);
+
+		DWORD chunk = 0;
+		if (!ReadFile(_hFile, buffer + read, (DWORD)std::min<size_t>(total - read, 1 << 30), &chunk, &overlapped) || chunk == 0)
+			break;
+#else
+		const auto chunk = pread(_fd, buffer + read, total - read, (off_t)(offset + read));
+		if (chunk < 0 && errno == EINTR)
+			continue;
+		if (chunk <= 0)
+			break;
+#endif
+		read += (size_t)chunk;
+	}
+
+	return read;
+}
+
+bool FileBlob::IsResized() const {
+#ifdef _WIN32
+	LARGE_INTEGER size;
+	return !GetFileSizeEx(_hFile, &size) || (size_t)size.QuadPart != _size;
+#else
+	struct stat st {};
+	return fstat(_fd, &st) != 0 || (size_t)st.st_size != _size;
+#endif
+}
@@ -0,0 +1,83 @@
+#include "app.h"
+#include "loop_wait.h"
+
+using namespace Gluino;
+
+App* app{};
+
+App::App(char* appId) {
+	_appId = CopyStr(appId);
+
+	app = this;
+}
+
+App::~App() {
+	DestroyUiThreads();
+	delete[] _appId;
+}
+
+WindowBase* App::NewWindowPair(
+	WindowOptions* windowOptions, WindowEvents* windowEvents,
+	WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+	UiThreadBase* thread, WebViewBase** webView) {
+	// A window's queue is drained by a task on the loop it belongs to.
+	Window::LoopDispatch dispatch;
+	if (thread)
+		dispatch = [thread](std::function<void()> task) { thread->Dispatch(std::move(task)); };
+	else
+		dispatch = [this](std::function<void()> task) { Dispatch(std::move(task)); };
+
+	const auto wv = new WebView(webViewOptions, webViewEvents);
+	*webView = wv;
+	return new Window(windowOptions, windowEvents, wv, std::move(dispatch));
+}
+
+void App::OnWindowCreated(WindowBase* window, UiThreadBase* thread) {
+	if (thread)
+		((UiThread*)thread)->AddWindow(window->GetRegistryHandle());
+}
+
+std::unique_ptr<UiThreadBase> App::NewUiThread() {
+	return std::make_unique<UiThread>();
+}
+
+void App::Run() {
+	while (RunOnce(-1)) {}
+}
+
+bool App::RunOnce(int timeout) {
+	if (_exiting)
+		return false;
+
+	_wakeHandle.Reset();
+
+	if (_invokeQueue.IsEmpty()) {
+		// Idle work only runs while no invokes are queued.
+		if (_idleScheduler.HasWork() &&
+			_idleScheduler.RunSlice([this] { return HasPendingWork(); }))
+			timeout = 0;
+
+		WaitForWork(_wakeHandle, &_timerWheel, timeout);
+		_wakeHandle.Reset();
+	}
+
+	if (_invokeQueue.Drain())
+		Wake();
+	_timerWheel.Advance(TimerWheel::Clock::now());
+	return !_exiting;
+}
+
+void App::Exit() {
+	StopUiThreads();
+	_exiting = true;
+	Wake();
+}
+
+bool App::HasPendingWork() {
+	return !_invokeQueue.IsEmpty();
+}
+
+void App::NotifyDestroy(Window* window) {
+	if (app)
+		app->DespawnWindow(window);
+}
@@ -0,0 +1,33 @@
+#include "loop_wait.h"
+
+#include <algorithm>
+#include <poll.h>
+
+using namespace Gluino;
+
+void Gluino::WaitForWork(const WakeHandle& wakeHandle, TimerWheel* timerWheel, const int timeout) {
+	auto wait = timeout < 0
+		? TimerWheel::Clock::duration::max()
+		: std::chrono::duration_cast<TimerWheel::Clock::duration>(std::chrono::milliseconds(timeout));
+
+	if (const auto deadline = timerWheel ? timerWheel->GetNextDeadline() : std::nullopt) {
+		const auto remaining = *deadline - TimerWheel::Clock::now();
+		if (remaining <= TimerWheel::Clock::duration::zero())
+			return;
+		wait = std::min(wait, remaining);
+	}
+
+	pollfd fd = { (int)wakeHandle.GetNative(), POLLIN, 0 };
+	if (wait == TimerWheel::Clock::duration::max()) {
+		poll(&fd, 1, -1);
+		return;
+	}
+
+#ifdef __linux__
+	const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count();
+	const timespec ts = { (time_t)(ns / 1000000000), (long)(ns % 1000000000) };
+	ppoll(&fd, 1, &ts, nullptr);
+#else
+	poll(&fd, 1, (int)std::chrono::ceil<std::chrono::milliseconds>(wait).count());
+#endif
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#ifndef GLUINO_LOOP_WAIT_H
+#define GLUINO_LOOP_WAIT_H
+
+#include "wake_handle.h"
+#include "timer_wheel.h"
+
+namespace Gluino {
+
+// Waits until the wake handle is signalled, the next timer wheel deadline comes due or the
+// timeout in milliseconds elapses; a negative timeout waits indefinitely. Deadlines are waited
+// for with nanosecond precision where the platform allows, so they are not rounded to 1 ms.
+void WaitForWork(const WakeHandle& wakeHandle, TimerWheel* timerWheel, int timeout);
+
+}
+
+#endif // !GLUINO_LOOP_WAIT_H
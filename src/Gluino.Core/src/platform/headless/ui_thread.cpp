@@ -0,0 +1,57 @@
+#include "ui_thread.h"
+#include "window.h"
+#include "loop_wait.h"
+
+using namespace Gluino;
+
+UiThread::UiThread() {
+	std::promise<void> ready;
+	const auto future = ready.get_future();
+	_thread = std::thread(&UiThread::Run, this, &ready);
+	future.wait();
+}
+
+UiThread::~UiThread() {
+	Stop();
+	if (_thread.joinable())
+		_thread.join();
+}
+
+void UiThread::Stop() {
+	if (_stopping.exchange(true))
+		return;
+
+	// Windows still owned by the thread are destroyed on it before its loop exits.
+	Dispatch([this] {
+		for (const auto handle : std::exchange(_windows, {})) {
+			if (const auto window = WindowRegistry.Get(handle))
+				((Window*)window)->Destroy();
+		}
+		_running = false;
+	});
+}
+
+void UiThread::AddWindow(const WindowHandle window) {
+	_windows.push_back(window);
+}
+
+void UiThread::Wake() {
+	_wakeHandle.Signal();
+}
+
+void UiThread::Run(std::promise<void>* ready) {
+	_threadId = std::this_thread::get_id();
+	ready->set_value();
+
+	while (_running) {
+		_wakeHandle.Reset();
+		if (_invokeQueue.IsEmpty()) {
+			WaitForWork(_wakeHandle, &_timerWheel, -1);
+			_wakeHandle.Reset();
+		}
+
+		DrainInvokeQueue();
+		if (_running)
+			_timerWheel.Advance(TimerWheel::Clock::now());
+	}
+}
@@ -0,0 +1,145 @@
+#include "app.h"
+#include "webview.h"
+
+#include <cstdlib>
+#include <utility>
+
+using namespace Gluino;
+
+namespace {
+
+// Content answered by the host, which allocates it with the C allocator and hands it over.
+class HostBlob final : public ResourceBlob {
+public:
+	HostBlob(void* data, const size_t size) : _data(data), _size(size) {}
+	~HostBlob() override { free(_data); }
+
+	[[nodiscard]] const char* GetData() const override { return (const char*)_data; }
+	[[nodiscard]] size_t GetSize() const override { return _size; }
+
+private:
+	void* _data;
+	size_t _size;
+};
+
+}
+
+WebView::~WebView() {
+	delete[] _userAgent;
+}
+
+void WebView::Close() {
+	delete this;
+}
+
+void WebView::Attach(WindowBase* window) {
+	_host = window;
+	_window = (Window*)window;
+	StartOnLoop();
+}
+
+void WebView::Navigate(const autostr url) {
+	if (_window == nullptr) return;
+	Load(url, true);
+}
+
+void WebView::NativateToString(autostr) {
+	if (_window == nullptr) return;
+	Load("about:blank", false);
+}
+
+void WebView::InjectScript(autostr, bool) {
+	// There is no script engine; the page is scripted through the Page calls instead.
+}
+
+void WebView::SendWebMessage(const autostr message) {
+	if (_window == nullptr) return;
+
+	// Like a browser, the page receives the message on a later turn of the loop.
+	_window->Dispatch([this, alive = std::weak_ptr(_alive), message = std::string(message)] {
+		if (alive.lock() && _pageHandler)
+			_pageHandler(message);
+	});
+}
+
+void WebView::PagePostMessage(std::string message) {
+	if (_window == nullptr || !_window->IsSubscribed(EventType::MessageReceived))
+		return;
+	_window->PostEvent(EventType::MessageReceived, _viewId, 0, message.data());
+}
+
+bool WebView::PageFetch(const ResourceQuery& query, ResourceResult* result) {
+	if (_resourceRouter.Route(query, result))
+		return true;
+	if (!_onResourceRequested)
+		return false;
+
+	auto url = query.Url;
+	auto method = query.Method;
+	const WebResourceRequest req{
+		nullptr,
+		url.data(),
+		nullptr,
+		method.data()
+	};
+	WebResourceResponse res{};
+	_window->FlushEvents();
+	_onResourceRequested(req, &res);
+
+	if (res.Content == nullptr)
+		return false;
+
+	result->StatusCode = res.StatusCode;
+	result->ContentType = res.ContentTypeA ? res.ContentTypeA : "application/octet-stream";
+	result->Blob = std::make_shared<HostBlob>(res.Content, (size_t)res.ContentLength);
+	result->Offset = 0;
+	result->Length = (size_t)res.ContentLength;
+	return true;
+}
+
+bool WebView::GetContextMenuEnabled() {
+	return _contextMenuEnabled;
+}
+
+void WebView::SetContextMenuEnabled(const bool enabled) {
+	_contextMenuEnabled = enabled;
+}
+
+bool WebView::GetDevToolsEnabled() {
+	return _devToolsEnabled;
+}
+
+void WebView::SetDevToolsEnabled(const bool enabled) {
+	_devToolsEnabled = enabled;
+}
+
+autostr WebView::GetUserAgent() {
+	return CopyStr(_userAgent ? _userAgent : (autostr)DefaultUserAgent);
+}
+
+void WebView::SetUserAgent(const autostr userAgent) {
+	delete[] _userAgent;
+	_userAgent = CopyStr(userAgent);
+}
+
+void WebView::Load(std::string url, const bool fetch) {
+	const auto navigationId = ++_navigationId;
+	_prefetcher.Prefetch(url);
+	_window->PostEvent(EventType::NavigationStart, _viewId, 0, url.data());
+
+	// The document is requested and committed on a later turn of the loop, as a browser would;
+	// a newer navigation supersedes this one.
+	_window->Dispatch([this, alive = std::weak_ptr(_alive), navigationId, url = std::move(url), fetch] {
+		if (!alive.lock() || navigationId != _navigationId)
+			return;
+
+		if (fetch) {
+			ResourceResult result;
+			PageFetch({ url, "GET", {}, {} }, &result);
+		}
+
+		_pageUrl = url;
+		NotifyFirstCommit();
+		_window->PostEvent(EventType::NavigationEnd, _viewId);
+	});
+}
@@ -0,0 +1,443 @@
+#include "app.h"
+#include "window.h"
+
+#include <algorithm>
+#include <future>
+
+using namespace Gluino;
+
+Window::Window(WindowOptions* options, const WindowEvents* events, WebView* webView, LoopDispatch dispatch) : WindowBase(options, events) {
+	_dispatch = std::move(dispatch);
+	_windowState = WindowState::Normal;
+	_startState = options->WindowState;
+	_minSize = options->MinimumSize;
+	_maxSize = options->MaximumSize;
+	_minimizeEnabled = options->MinimizeEnabled;
+	_maximizeEnabled = options->MaximizeEnabled;
+	_topMost = options->TopMost;
+	_visible = false;
+	_focused = false;
+	_destroyed = false;
+	_geometryEventInterval = options->GeometryEventInterval;
+	_geometryTimer = 0;
+	_deferEvents = false;
+
+	_normalBounds = {
+		options->StartupLocation == WindowStartupLocation::Default ? WorkArea.x : options->Location.x,
+		options->StartupLocation == WindowStartupLocation::Default ? WorkArea.y : options->Location.y,
+		options->Size.width,
+		options->Size.height
+	};
+	SetNormalBounds(_normalBounds);
+	if (options->StartupLocation == WindowStartupLocation::CenterScreen)
+		Center();
+
+	SetGeometryEventInterval(_geometryEventInterval);
+	SetBackgroundThrottling(options->BackgroundThrottling);
+	SetBrowserSuspendDelay(options->BrowserSuspendDelay);
+
+	_webViews.Add(webView);
+	webView->Attach(this);
+
+	UpdateSnapshot();
+}
+
+Window::~Window() {
+	Destroy();
+}
+
+void Window::Adopt(WindowOptions* options, const WindowEvents* events) {
+	WindowBase::Adopt(options, events);
+	_startState = options->WindowState;
+	_minSize = options->MinimumSize;
+	_maxSize = options->MaximumSize;
+	_minimizeEnabled = options->MinimizeEnabled;
+	_maximizeEnabled = options->MaximizeEnabled;
+	_topMost = options->TopMost;
+	SetGeometryEventInterval(options->GeometryEventInterval);
+	SetBackgroundThrottling(options->BackgroundThrottling);
+	SetBrowserSuspendDelay(options->BrowserSuspendDelay);
+
+	SetNormalBounds({
+		options->StartupLocation == WindowStartupLocation::Default ? _normalBounds.x : options->Location.x,
+		options->StartupLocation == WindowStartupLocation::Default ? _normalBounds.y : options->Location.y,
+		options->Size.width,
+		options->Size.height
+	});
+	if (options->StartupLocation == WindowStartupLocation::CenterScreen)
+		Center();
+
+	UpdateSnapshot();
+}
+
+void Window::Show() {
+	if (Forward([&] { Show(); }))
+		return;
+
+	if (_destroyed || _visible)
+		return;
+
+	_visible = true;
+	PostEvent(EventType::Shown);
+	TrackVisibility(true);
+
+	if (const auto state = std::exchange(_startState, WindowState::Normal); state != WindowState::Normal)
+		SetWindowState(state);
+}
+
+void Window::Hide() {
+	if (Forward([&] { Hide(); }))
+		return;
+
+	if (_destroyed || !_visible)
+		return;
+
+	_visible = false;
+	PostEvent(EventType::Hidden);
+	TrackVisibility(false);
+}
+
+void Window::Close() {
+	// Like a click on the close button, the host is asked from the window's loop.
+	Dispatch([this] {
+		if (_destroyed)
+			return;
+
+		FlushEvents();
+		if (const auto cancel = IsSubscribed(EventType::Closing) && _onClosing(); !cancel)
+			Destroy();
+	});
+}
+
+void Window::Destroy() {
+	if (_destroyed.exchange(true))
+		return;
+
+	App::NotifyDestroy(this);
+
+	for (const auto webView : _webViews.GetAll())
+		webView->GetFileTokens()->RevokeAll();
+	StopTimers();
+	if (_timerWheel)
+		_timerWheel->CancelAll(&_geometry);
+	_geometryTimer = 0;
+	FlushEvents();
+}
+
+void Window::Center() {
+	Point loc = {
+		WorkArea.x + (WorkArea.width - _normalBounds.width) / 2,
+		WorkArea.y + (WorkArea.height - _normalBounds.height) / 2
+	};
+
+	SetLocation(loc);
+}
+
+void Window::DragMove() {
+	// There is no pointer to follow.
+}
+
+void Window::SetFocused(const bool focused) {
+	if (Forward([&] { SetFocused(focused); }))
+		return;
+
+	if (_destroyed || focused == _focused)
+		return;
+
+	_focused = focused;
+	if (focused) {
+		if (const auto webView = GetWebView())
+			webView->Focus();
+		PostEvent(EventType::FocusIn);
+	}
+	else {
+		PostEvent(EventType::FocusOut);
+	}
+}
+
+void Window::SetGeometryEventInterval(const int interval) {
+	_geometryEventInterval = std::max(interval, 0);
+	_geometry.SetInterval(_geometryEventInterval > 0
+		? std::chrono::milliseconds(_geometryEventInterval)
+		: GeometryCoalescer::DefaultInterval);
+}
+
+// A native window hands changes from other threads to its owner and waits, as SetWindowPos
+// does; the geometry timers and throttle state here belong to the owning loop in the same way.
+bool Window::Forward(const std::function<void()>& task) {
+	if (IsCurrentThread() || _destroyed)
+		return false;
+
+	std::promise<void> promise;
+	const auto future = promise.get_future();
+	Dispatch([this, &task, &promise] {
+		if (!_destroyed)
+			task();
+		promise.set_value();
+	});
+	future.wait();
+	return true;
+}
+
+void Window::SetNormalBounds(Rect bounds) {
+	bounds.width = std::max(std::clamp(bounds.width, _minSize.width, std::max(_minSize.width, _maxSize.width)), 0);
+	bounds.height = std::max(std::clamp(bounds.height, _minSize.height, std::max(_minSize.height, _maxSize.height)), 0);
+
+	_normalBounds = bounds;
+	UpdateSnapshot();
+}
+
+void Window::UpdateState(const WindowState state) {
+	if (Forward([&] { UpdateState(state); }))
+		return;
+
+	if (state == _windowState)
+		return;
+
+	const auto previous = std::exchange(_windowState, state);
+	UpdateSnapshot();
+	if ((previous == WindowState::Minimized) != (state == WindowState::Minimized))
+		TrackMinimized(state == WindowState::Minimized);
+
+	if (!_deferEvents)
+		PostEvent(EventType::WindowStateChanged, (int)state);
+}
+
+void Window::UpdateSnapshot() {
+	if (Forward([&] { UpdateSnapshot(); }))
+		return;
+
+	const auto current = GetSnapshot();
+
+	WindowSnapshot snapshot = {};
+	snapshot.Bounds = _windowState == WindowState::Maximized ? WorkArea : _normalBounds;
+	snapshot.WindowState = _windowState;
+	snapshot.IsDarkMode = _theme == WindowTheme::Dark;
+	PublishSnapshot(snapshot);
+
+	// The window's initial geometry is not reported as a change.
+	if (current.Version == 0)
+		return;
+
+	const auto& previous = current.Bounds;
+	const auto& bounds = snapshot.Bounds;
+	if (IsSubscribed(EventType::Resize) && (bounds.width != previous.width || bounds.height != previous.height))
+		QueueGeometry(_geometry.Resize({ bounds.width, bounds.height }, GeometryCoalescer::Clock::now()));
+	if (IsSubscribed(EventType::LocationChanged) && (bounds.x != previous.x || bounds.y != previous.y))
+		QueueGeometry(_geometry.Move({ bounds.x, bounds.y }, GeometryCoalescer::Clock::now()));
+}
+
+void Window::QueueGeometry(const bool due) {
+	if (_deferEvents || _destroyed)
+		return;
+
+	if (due) {
+		if (GeometryUpdate update; _geometry.Poll(GeometryCoalescer::Clock::now(), &update))
+			DeliverGeometry(update);
+	}
+
+	if (!_geometry.HasPending()) {
+		if (_geometryTimer)
+			_timerWheel->Cancel(std::exchange(_geometryTimer, 0));
+		return;
+	}
+
+	if (_geometryTimer || !_timerWheel)
+		return;
+
+	// Kept off the window's own timers so that a throttled window still reports its geometry.
+	_geometryTimer = _timerWheel->Schedule(_geometry.GetDeadline() - GeometryCoalescer::Clock::now(), [this] {
+		_geometryTimer = 0;
+		if (GeometryUpdate update; _geometry.Poll(GeometryCoalescer::Clock::now(), &update))
+			DeliverGeometry(update);
+		QueueGeometry(false);
+	}, {}, &_geometry);
+}
+
+void Window::DeliverGeometry(const GeometryUpdate& update) {
+	if (update.Resized)
+		PostEvent(EventType::Resize, update.Size.width, update.Size.height);
+	if (update.Moved)
+		PostEvent(EventType::LocationChanged, update.Location.x, update.Location.y);
+}
+
+void Window::Wake() {
+	_dispatch([this] { DrainInvokeQueue(); });
+}
+
+WebViewBase* Window::AddWebView(WebViewOptions* options, const WebViewEvents* events) {
+	const auto webView = new WebView(options, events);
+	webView->SetRegistryHandle(WebViewRegistry.Add(webView));
+	_webViews.Add(webView);
+	webView->Attach(this);
+	webView->SetWindowThrottleLevel(GetThrottleLevel());
+	return webView;
+}
+
+bool Window::RemoveWebView(WebViewBase* webView) {
+	if (webView == _webViews.GetPrimary() || !_webViews.Remove(webView))
+		return false;
+
+	webView->GetFileTokens()->RevokeAll();
+	RetireWebView(webView->GetRegistryHandle(), [webView] { ((WebView*)webView)->Close(); });
+	return true;
+}
+
+void Window::GetBounds(Rect* bounds) {
+	*bounds = GetSnapshot().Bounds;
+}
+
+bool Window::GetIsDarkMode() {
+	return GetSnapshot().IsDarkMode;
+}
+
+autostr Window::GetTitle() {
+	return CopyStr(_title);
+}
+
+void Window::SetTitle(const autostr title) {
+	delete[] _title;
+	_title = CopyStr(title);
+}
+
+void Window::GetIcon(void** data, int* size) {
+	*data = _icon;
+	*size = _iconSize;
+}
+
+void Window::SetIcon(void* data, const int size) {
+	_icon = data;
+	_iconSize = size;
+}
+
+WindowBorderStyle Window::GetBorderStyle() {
+	return _borderStyle;
+}
+
+void Window::SetBorderStyle(const WindowBorderStyle style) {
+	_borderStyle = style;
+}
+
+WindowState Window::GetWindowState() {
+	return GetSnapshot().WindowState;
+}
+
+void Window::SetWindowState(const WindowState state) {
+	UpdateState(state);
+}
+
+WindowTheme Window::GetTheme() {
+	return _theme;
+}
+
+void Window::SetTheme(const WindowTheme theme) {
+	// There is no system preference to follow; System is light.
+	_theme = theme;
+	UpdateSnapshot();
+}
+
+Size Window::GetMinimumSize() {
+	return _minSize;
+}
+
+void Window::SetMinimumSize(Size& size) {
+	_minSize = size;
+	SetNormalBounds(_normalBounds);
+}
+
+Size Window::GetMaximumSize() {
+	return _maxSize;
+}
+
+void Window::SetMaximumSize(Size& size) {
+	_maxSize = size;
+	SetNormalBounds(_normalBounds);
+}
+
+Size Window::GetSize() {
+	const auto bounds = GetSnapshot().Bounds;
+	return { bounds.width, bounds.height };
+}
+
+void Window::SetSize(Size& size) {
+	SetNormalBounds({ _normalBounds.x, _normalBounds.y, size.width, size.height });
+}
+
+Point Window::GetLocation() {
+	const auto bounds = GetSnapshot().Bounds;
+	return { bounds.x, bounds.y };
+}
+
+void Window::SetLocation(Point& location) {
+	SetNormalBounds({ location.x, location.y, _normalBounds.width, _normalBounds.height });
+}
+
+bool Window::GetMinimizeEnabled() {
+	return _minimizeEnabled;
+}
+
+void Window::SetMinimizeEnabled(const bool enabled) {
+	_minimizeEnabled = enabled;
+}
+
+bool Window::GetMaximizeEnabled() {
+	return _maximizeEnabled;
+}
+
+void Window::SetMaximizeEnabled(const bool enabled) {
+	_maximizeEnabled = enabled;
+}
+
+bool Window::GetTopMost() {
+	return _topMost;
+}
+
+void Window::SetTopMost(const bool topMost) {
+	_topMost = topMost;
+}
+
+void Window::ApplyChanges(const WindowChangeSet& changes) {
+	if (Forward([&] { ApplyChanges(changes); }))
+		return;
+
+	const auto previousState = _windowState;
+	_deferEvents = true;
+
+	if (changes.Has(WindowChange::Theme) && changes.Theme != _theme)
+		SetTheme(changes.Theme);
+	if (changes.Has(WindowChange::BorderStyle))
+		_borderStyle = changes.BorderStyle;
+	if (changes.Has(WindowChange::MinimizeEnabled))
+		_minimizeEnabled = changes.MinimizeEnabled;
+	if (changes.Has(WindowChange::MaximizeEnabled))
+		_maximizeEnabled = changes.MaximizeEnabled;
+	if (changes.Has(WindowChange::MinimumSize))
+		_minSize = changes.MinimumSize;
+	if (changes.Has(WindowChange::MaximumSize))
+		_maxSize = changes.MaximumSize;
+	if (changes.Has(WindowChange::TopMost))
+		_topMost = changes.TopMost;
+
+	auto bounds = _normalBounds;
+	if (changes.Has(WindowChange::Location)) {
+		bounds.x = changes.Location.x;
+		bounds.y = changes.Location.y;
+	}
+	if (changes.Has(WindowChange::Size)) {
+		bounds.width = changes.Size.width;
+		bounds.height = changes.Size.height;
+	}
+	SetNormalBounds(bounds);
+
+	if (changes.Has(WindowChange::WindowState))
+		UpdateState(changes.WindowState);
+
+	_deferEvents = false;
+
+	if (GeometryUpdate update; _geometry.Flush(&update))
+		DeliverGeometry(update);
+	QueueGeometry(false);
+
+	if (_windowState != previousState)
+		PostEvent(EventType::WindowStateChanged, (int)_windowState);
+}
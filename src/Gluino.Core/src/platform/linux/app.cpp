@@ -0,0 +1,124 @@
+#include "app.h"
+
+#include <cstdlib>
+
+using namespace Gluino;
+
+App* app{};
+
+App::App(char* appId) {
+	_appId = CopyStr(appId);
+	_threadId = std::this_thread::get_id();
+
+	g_set_application_name(_appId);
+	_loopSource = std::make_unique<LoopSource>(&_wakeHandle, &_timerWheel, [this] {
+		if (_invokeQueue.Drain())
+			Wake();
+	});
+
+	app = this;
+}
+
+App::~App() {
+	DestroyUiThreads();
+	_loopSource.reset();
+	delete[] _appId;
+}
+
+bool App::Initialize(const char* appId) {
+	// Without a GPU, as under Xvfb, WebKit is kept off its accelerated compositing path, which
+	// would otherwise fail or fall back to a blank view.
+	if (g_getenv("GLUINO_SOFTWARE_RENDERING")) {
+		g_setenv("WEBKIT_DISABLE_COMPOSITING_MODE", "1", FALSE);
+		g_setenv("LIBGL_ALWAYS_SOFTWARE", "1", FALSE);
+	}
+
+	g_set_prgname(appId);
+	return gtk_init_check(nullptr, nullptr);
+}
+
+WindowBase* App::NewWindowPair(
+	WindowOptions* windowOptions, WindowEvents* windowEvents,
+	WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+	UiThreadBase*, WebViewBase** webView) {
+	const auto wv = new WebView(webViewOptions, webViewEvents);
+	*webView = wv;
+	return new Window(windowOptions, windowEvents, wv);
+}
+
+void App::OnWindowCreated(WindowBase* window, UiThreadBase* thread) {
+	if (thread)
+		((UiThread*)thread)->AddWindow(window->GetRegistryHandle());
+}
+
+std::unique_ptr<UiThreadBase> App::NewUiThread() {
+	return std::make_unique<UiThread>(_threadId);
+}
+
+void App::ReleaseUiThread(std::unique_ptr<UiThreadBase> thread) {
+	// UI threads run on the GTK thread, so even one destroyed from elsewhere may be draining the
+	// very task that destroys it; it is released from the GTK loop once that task has returned.
+	thread->Stop();
+	g_idle_add([](const gpointer data) -> gboolean {
+		delete (UiThread*)data;
+		return G_SOURCE_REMOVE;
+	}, thread.release());
+}
+
+void App::Run() {
+	while (RunOnce(-1)) {}
+}
+
+bool App::RunOnce(int timeout) {
+	if (_exiting)
+		return false;
+
+	const auto context = g_main_context_default();
+	if (!g_main_context_pending(context) && _invokeQueue.IsEmpty()) {
+		// Idle work only runs while no events or invokes are queued.
+		if (_idleScheduler.HasWork() &&
+			_idleScheduler.RunSlice([this] { return HasPendingWork(); }))
+			timeout = 0;
+
+		if (timeout != 0) {
+			// The loop source wakes the wait for posted work and timer deadlines; a bounded wait
+			// adds a timeout source of its own for the duration of the iteration.
+			GSource* timeoutSource = nullptr;
+			if (timeout > 0) {
+				timeoutSource = g_timeout_source_new((guint)timeout);
+				g_source_set_callback(timeoutSource, [](gpointer) -> gboolean { return G_SOURCE_REMOVE; }, nullptr, nullptr);
+				g_source_attach(timeoutSource, context);
+			}
+
+			g_main_context_iteration(context, TRUE);
+
+			if (timeoutSource) {
+				g_source_destroy(timeoutSource);
+				g_source_unref(timeoutSource);
+			}
+		}
+	}
+
+	for (auto i = 0; i < MaxEventsPerRun && g_main_context_iteration(context, FALSE); ++i) {}
+
+	return !_exiting;
+}
+
+void App::Exit() {
+	StopUiThreads();
+	_exiting = true;
+	Wake();
+}
+
+bool App::HasPendingWork() {
+	// The main context can only be checked by the thread that runs it.
+	if (std::this_thread::get_id() != _threadId)
+		return !_invokeQueue.IsEmpty();
+
+	return g_main_context_pending(g_main_context_default()) || !_invokeQueue.IsEmpty();
+}
+
+void App::NotifyDestroy(Window* window) {
+	if (app)
+		app->DespawnWindow(window);
+}
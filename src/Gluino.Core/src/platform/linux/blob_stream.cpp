@@ -0,0 +1,69 @@
+#include "blob_stream.h"
+
+#include <algorithm>
+
+using namespace Gluino;
+
+namespace {
+
+// A stream over a blob that has no content in memory. GIO runs the reads of a stream like this
+// on a worker thread, so reading from disk never blocks the UI loop.
+struct BlobInputStream {
+	GInputStream Parent;
+	std::shared_ptr<const ResourceBlob>* Blob;
+	size_t Offset;
+	size_t Length;
+	size_t Position;
+};
+
+struct BlobInputStreamClass {
+	GInputStreamClass ParentClass;
+};
+
+G_DEFINE_TYPE(BlobInputStream, blob_input_stream, G_TYPE_INPUT_STREAM)
+
+gssize blob_input_stream_read(GInputStream* stream, void* buffer, const gsize count, GCancellable*, GError**) {
+	const auto self = (BlobInputStream*)stream;
+	const auto wanted = std::min<size_t>(count, self->Length - self->Position);
+	const auto read = wanted > 0 ? (*self->Blob)->Read(self->Offset + self->Position, (char*)buffer, wanted) : 0;
+	self->Position += read;
+
+	// A blob read from a file truncated under it comes up short; the stream ends there.
+	if (read < wanted)
+		self->Length = self->Position;
+	return (gssize)read;
+}
+
+void blob_input_stream_finalize(GObject* object) {
+	delete ((BlobInputStream*)object)->Blob;
+	G_OBJECT_CLASS(blob_input_stream_parent_class)->finalize(object);
+}
+
+void blob_input_stream_init(BlobInputStream*) {}
+
+void blob_input_stream_class_init(BlobInputStreamClass* klass) {
+	G_OBJECT_CLASS(klass)->finalize = blob_input_stream_finalize;
+	G_INPUT_STREAM_CLASS(klass)->read_fn = blob_input_stream_read;
+}
+
+}
+
+GInputStream* Gluino::CreateBlobStream(std::shared_ptr<const ResourceBlob> blob, const size_t offset, const size_t length) {
+	if (blob && !blob->GetData()) {
+		const auto stream = (BlobInputStream*)g_object_new(blob_input_stream_get_type(), nullptr);
+		stream->Blob = new std::shared_ptr<const ResourceBlob>(std::move(blob));
+		stream->Offset = offset;
+		stream->Length = length;
+		return (GInputStream*)stream;
+	}
+
+	const auto data = blob ? blob->GetData() + offset : nullptr;
+	const auto owner = new std::shared_ptr<const ResourceBlob>(std::move(blob));
+
+	const auto bytes = g_bytes_new_with_free_func(data, *owner ? length : 0, [](const gpointer p) {
+		delete (std::shared_ptr<const ResourceBlob>*)p;
+	}, owner);
+	const auto stream = g_memory_input_stream_new_from_bytes(bytes);
+	g_bytes_unref(bytes);
+	return stream;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#ifndef GLUINO_BLOB_STREAM_H
+#define GLUINO_BLOB_STREAM_H
+
+#include "resource.h"
+
+#include <gio/gio.h>
+
+namespace Gluino {
+
+// Wraps a slice of a blob in a GInputStream without copying it. WebKit reads the stream as the
+// page consumes the response, and the blob is released once the stream is finalized. Blobs read
+// on demand are read in the chunks WebKit asks for.
+GInputStream* CreateBlobStream(std::shared_ptr<const ResourceBlob> blob, size_t offset, size_t length);
+
+}
+
+#endif // !GLUINO_BLOB_STREAM_H
@@ -0,0 +1,143 @@
+#include "file_watcher.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <filesystem>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <utility>
+
+using namespace Gluino;
+
+namespace {
+
+constexpr uint32_t WatchMask =
+	IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_CREATE | IN_ATTRIB;
+
+}
+
+FileWatcher::FileWatcher(std::string root, ChangeCallback callback)
+	: _root(std::move(root)), _callback(std::move(callback)) {}
+
+FileWatcher::~FileWatcher() {
+	Stop();
+}
+
+bool FileWatcher::Start() {
+	if (_running) return true;
+
+	_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	_stopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (_fd < 0 || _stopFd < 0) {
+		Stop();
+		return false;
+	}
+
+	AddWatches(_root);
+	if (_watches.empty()) {
+		Stop();
+		return false;
+	}
+
+	_running = true;
+	_thread = std::thread(&FileWatcher::Run, this);
+	return true;
+}
+
+void FileWatcher::Stop() {
+	if (_running.exchange(false)) {
+		constexpr uint64_t value = 1;
+		write(_stopFd, &value, sizeof value);
+		_thread.join();
+	}
+
+	if (_fd >= 0) close(_fd);
+	if (_stopFd >= 0) close(_stopFd);
+	_fd = _stopFd = -1;
+	_watches.clear();
+}
+
+void FileWatcher::AddWatches(const std::string& directory) {
+	if (const auto wd = inotify_add_watch(_fd, directory.c_str(), WatchMask | IN_ONLYDIR); wd >= 0)
+		_watches[wd] = directory;
+	else
+		return;
+
+	std::error_code ec;
+	for (std::filesystem::recursive_directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+		if (it->is_directory(ec)) {
+			const auto path = it->path().string();
+			if (const auto wd = inotify_add_watch(_fd, path.c_str(), WatchMask | IN_ONLYDIR); wd >= 0)
+				_watches[wd] = path;
+		}
+	}
+}
+
+void FileWatcher::Run() {
+	alignas(inotify_event) char buffer[16 * (sizeof(inotify_event) + NAME_MAX + 1)];
+	std::vector<std::string> pending;
+	bool overflow = false;
+
+	pollfd fds[2] = { { _fd, POLLIN, 0 }, { _stopFd, POLLIN, 0 } };
+
+	while (_running) {
+		const int timeout = pending.empty() && !overflow ? -1 : (int)DebounceInterval.count();
+		const int ready = poll(fds, 2, timeout);
+		if (ready < 0) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+
+		if (fds[1].revents & POLLIN)
+			break;
+
+		if (ready == 0) {
+			// Directories created while events were being dropped have no watch yet.
+			if (overflow)
+				AddWatches(_root);
+
+			std::sort(pending.begin(), pending.end());
+			pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+			_callback(pending, std::exchange(overflow, false));
+			pending.clear();
+			continue;
+		}
+
+		ssize_t length;
+		while ((length = read(_fd, buffer, sizeof buffer)) > 0) {
+			for (char* ptr = buffer; ptr < buffer + length;) {
+				const auto event = (const inotify_event*)ptr;
+				ptr += sizeof(inotify_event) + event->len;
+
+				if (event->mask & IN_Q_OVERFLOW) {
+					overflow = true;
+					continue;
+				}
+				if (event->mask & IN_IGNORED) {
+					_watches.erase(event->wd);
+					continue;
+				}
+
+				const auto dir = _watches.find(event->wd);
+				if (dir == _watches.end() || event->len == 0)
+					continue;
+
+				const auto fullPath = dir->second + "/" + event->name;
+				if (event->mask & IN_ISDIR) {
+					if (event->mask & (IN_CREATE | IN_MOVED_TO))
+						AddWatches(fullPath);
+					// The files of a directory moved in, moved out or removed are not reported one by one.
+					if (!(event->mask & IN_CREATE))
+						overflow = true;
+					continue;
+				}
+
+				pending.push_back(std::filesystem::path(fullPath).lexically_relative(_root).generic_string());
+			}
+		}
+	}
+}
@@ -0,0 +1,65 @@
+#include "loop_source.h"
+
+#include <algorithm>
+
+using namespace Gluino;
+
+GSourceFuncs LoopSource::Funcs = { Prepare, Check, Dispatch, nullptr, nullptr, nullptr };
+
+LoopSource::LoopSource(WakeHandle* wakeHandle, TimerWheel* timerWheel, std::function<void()> dispatch) {
+	_wakeHandle = wakeHandle;
+	_timerWheel = timerWheel;
+	_dispatch = std::move(dispatch);
+
+	_source = (Source*)g_source_new(&Funcs, sizeof(Source));
+	_source->Owner = this;
+	_tag = g_source_add_unix_fd(&_source->Base, (gint)_wakeHandle->GetNative(), G_IO_IN);
+	g_source_set_priority(&_source->Base, G_PRIORITY_DEFAULT);
+	g_source_attach(&_source->Base, nullptr);
+}
+
+LoopSource::~LoopSource() {
+	g_source_destroy(&_source->Base);
+	g_source_unref(&_source->Base);
+}
+
+gboolean LoopSource::Prepare(GSource* source, gint* timeout) {
+	const auto owner = ((Source*)source)->Owner;
+	*timeout = -1;
+
+	if (owner->_timerWheel) {
+		if (const auto deadline = owner->_timerWheel->GetNextDeadline()) {
+			const auto remaining = *deadline - TimerWheel::Clock::now();
+			if (remaining <= TimerWheel::Clock::duration::zero())
+				return TRUE;
+			*timeout = (gint)std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+		}
+	}
+
+	return FALSE;
+}
+
+gboolean LoopSource::Check(GSource* source) {
+	const auto owner = ((Source*)source)->Owner;
+	if (g_source_query_unix_fd(source, owner->_tag) & G_IO_IN)
+		return TRUE;
+
+	const auto deadline = owner->_timerWheel ? owner->_timerWheel->GetNextDeadline() : std::nullopt;
+	return deadline && *deadline <= TimerWheel::Clock::now();
+}
+
+gboolean LoopSource::Dispatch(GSource* source, GSourceFunc, gpointer) {
+	const auto owner = ((Source*)source)->Owner;
+
+	// Reset before draining so that work posted while it runs wakes the loop again.
+	owner->_wakeHandle->Reset();
+	if (owner->_dispatch)
+		owner->_dispatch();
+
+	// The drained work may have destroyed the loop's owner, and with it this source.
+	if (g_source_is_destroyed(source))
+		return G_SOURCE_REMOVE;
+	if (owner->_timerWheel)
+		owner->_timerWheel->Advance(TimerWheel::Clock::now());
+	return G_SOURCE_CONTINUE;
+}
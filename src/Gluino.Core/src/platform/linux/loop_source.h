@@ -0,0 +1,46 @@
+#pragma once
+
+#ifndef GLUINO_LOOP_SOURCE_H
+#define GLUINO_LOOP_SOURCE_H
+
+#include "wake_handle.h"
+#include "timer_wheel.h"
+
+#include <functional>
+#include <glib.h>
+
+namespace Gluino {
+
+// GLib source that wakes the GTK main context when a wake handle is signalled and when the
+// next timer wheel deadline comes due. Posted work is drained in one dispatch, so a burst of
+// invokes costs a single wakeup of the loop.
+class LoopSource {
+public:
+	LoopSource(WakeHandle* wakeHandle, TimerWheel* timerWheel, std::function<void()> dispatch);
+	~LoopSource();
+
+	LoopSource(const LoopSource&) = delete;
+	LoopSource& operator=(const LoopSource&) = delete;
+
+private:
+	struct Source {
+		GSource Base;
+		LoopSource* Owner;
+	};
+
+	Source* _source;
+	gpointer _tag;
+	WakeHandle* _wakeHandle;
+	TimerWheel* _timerWheel;
+	std::function<void()> _dispatch;
+
+	static GSourceFuncs Funcs;
+
+	static gboolean Prepare(GSource* source, gint* timeout);
+	static gboolean Check(GSource* source);
+	static gboolean Dispatch(GSource* source, GSourceFunc, gpointer);
+};
+
+}
+
+#endif // !GLUINO_LOOP_SOURCE_H
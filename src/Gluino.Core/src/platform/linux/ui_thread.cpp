@@ -0,0 +1,44 @@
+#include "ui_thread.h"
+#include "window.h"
+
+using namespace Gluino;
+
+UiThread::UiThread(const std::thread::id threadId) {
+	_threadId = threadId;
+	_loopSource = std::make_unique<LoopSource>(&_wakeHandle, &_timerWheel, [this] { DrainInvokeQueue(); });
+}
+
+UiThread::~UiThread() {
+	Stop();
+
+	// The app releases threads on the GTK thread, where windows a pending Stop did not reach yet
+	// can still be destroyed.
+	if (IsCurrent())
+		DestroyWindows();
+}
+
+void UiThread::Stop() {
+	if (_stopping.exchange(true))
+		return;
+
+	// Windows still owned by the thread are destroyed on the GTK thread before it is released.
+	if (IsCurrent())
+		DestroyWindows();
+	else
+		Dispatch([this] { DestroyWindows(); });
+}
+
+void UiThread::AddWindow(const WindowHandle window) {
+	_windows.push_back(window);
+}
+
+void UiThread::DestroyWindows() {
+	for (const auto handle : std::exchange(_windows, {})) {
+		if (const auto window = WindowRegistry.Get(handle))
+			((Window*)window)->Destroy();
+	}
+}
+
+void UiThread::Wake() {
+	_wakeHandle.Signal();
+}
@@ -0,0 +1,436 @@
+#include "app.h"
+#include "webview.h"
+#include "blob_stream.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+using namespace Gluino;
+
+namespace {
+
+constexpr auto WebViewKey = "gluino-webview";
+
+// Every webview of the app shares one web context, and with it one network process, one data
+// directory and one set of URI schemes. A scheme routes each request to the webview that made it.
+struct SharedContext {
+	WebKitWebContext* Context = nullptr;
+	std::unordered_set<std::string> Schemes;
+};
+
+SharedContext sharedContext;
+
+bool IsSoftwareRendering() {
+	return g_getenv("GLUINO_SOFTWARE_RENDERING") != nullptr;
+}
+
+bool IsBuiltInScheme(const std::string& scheme) {
+	// WebKit loads these itself and does not let them be registered.
+	static const std::unordered_set<std::string> builtIn = {
+		"about", "blob", "data", "file", "ftp", "http", "https", "ws", "wss"
+	};
+	return builtIn.contains(scheme);
+}
+
+void AppendJsString(std::string* script, const char* str) {
+	script->push_back('"');
+	for (auto p = str; *p; ++p) {
+		const auto c = (unsigned char)*p;
+		switch (c) {
+			case '"':  script->append("\\\""); break;
+			case '\\': script->append("\\\\"); break;
+			case '\n': script->append("\\n"); break;
+			case '\r': script->append("\\r"); break;
+			case '\t': script->append("\\t"); break;
+			default:
+				if (c < 0x20) {
+					char escaped[8];
+					snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+					script->append(escaped);
+				}
+				// U+2028 and U+2029 end a line in older engines, even inside a string literal.
+				else if (c == 0xE2 && (unsigned char)p[1] == 0x80 && ((unsigned char)p[2] == 0xA8 || (unsigned char)p[2] == 0xA9)) {
+					script->append((unsigned char)p[2] == 0xA8 ? "\\u2028" : "\\u2029");
+					p += 2;
+				}
+				else {
+					script->push_back((char)c);
+				}
+				break;
+		}
+	}
+	script->push_back('"');
+}
+
+void FinishRequest(WebKitURISchemeRequest* request, GInputStream* stream, const gint64 length, const int statusCode,
+	const char* contentType, const std::vector<std::pair<std::string, std::string>>& headers) {
+#if WEBKIT_CHECK_VERSION(2, 36, 0)
+	const auto response = webkit_uri_scheme_response_new(stream, length);
+	webkit_uri_scheme_response_set_status(response, statusCode, GetReasonPhrase(statusCode));
+	webkit_uri_scheme_response_set_content_type(response, contentType);
+	if (!headers.empty()) {
+		const auto httpHeaders = soup_message_headers_new(SOUP_MESSAGE_HEADERS_RESPONSE);
+		for (const auto& [name, value] : headers)
+			soup_message_headers_append(httpHeaders, name.c_str(), value.c_str());
+		webkit_uri_scheme_response_set_http_headers(response, httpHeaders);
+	}
+	webkit_uri_scheme_request_finish_with_response(request, response);
+	g_object_unref(response);
+#else
+	// Older WebKitGTK can only answer with a body; status and headers are implied.
+	webkit_uri_scheme_request_finish(request, stream, length, contentType);
+#endif
+	g_object_unref(stream);
+}
+
+void FinishRequestWithError(WebKitURISchemeRequest* request) {
+	const auto error = g_error_new_literal(G_IO_ERROR, G_IO_ERROR_NOT_FOUND, GetReasonPhrase(404));
+	webkit_uri_scheme_request_finish_error(request, error);
+	g_error_free(error);
+}
+
+}
+
+WebView::~WebView() {
+	if (_webview) g_object_unref(_webview);
+	if (_contentManager) g_object_unref(_contentManager);
+	delete[] _userAgent;
+}
+
+WebKitWebContext* WebView::GetWebContext() {
+	if (sharedContext.Context)
+		return sharedContext.Context;
+
+	const auto name = g_get_prgname() ? g_get_prgname() : "gluino";
+	const auto dataDir = g_build_filename(g_get_user_data_dir(), name, nullptr);
+	const auto cacheDir = g_build_filename(g_get_user_cache_dir(), name, nullptr);
+	const auto dataManager = webkit_website_data_manager_new(
+		"base-data-directory", dataDir,
+		"base-cache-directory", cacheDir,
+		nullptr);
+	sharedContext.Context = webkit_web_context_new_with_website_data_manager(dataManager);
+	g_object_unref(dataManager);
+	g_free(dataDir);
+	g_free(cacheDir);
+
+	RegisterScheme(FileTokens::Prefix);
+	return sharedContext.Context;
+}
+
+void WebView::RegisterScheme(const char* url) {
+	const auto parsed = g_uri_parse_scheme(url);
+	if (!parsed)
+		return;
+
+	const std::string scheme = parsed;
+	g_free(parsed);
+	if (IsBuiltInScheme(scheme) || !sharedContext.Schemes.insert(scheme).second)
+		return;
+
+	const auto context = GetWebContext();
+	webkit_web_context_register_uri_scheme(context, scheme.c_str(), OnSchemeRequest, nullptr, nullptr);
+
+	const auto security = webkit_web_context_get_security_manager(context);
+	webkit_security_manager_register_uri_scheme_as_secure(security, scheme.c_str());
+	webkit_security_manager_register_uri_scheme_as_cors_enabled(security, scheme.c_str());
+}
+
+void WebView::Focus() const {
+	if (!_webview) return;
+	gtk_widget_grab_focus(GetWidget());
+}
+
+void WebView::Close() {
+	if (_webview) {
+		g_signal_handlers_disconnect_by_data(_webview, this);
+		g_signal_handlers_disconnect_by_data(_contentManager, this);
+		g_object_set_data(G_OBJECT(_webview), WebViewKey, nullptr);
+		gtk_widget_destroy(GetWidget());
+	}
+	delete this;
+}
+
+void WebView::Attach(WindowBase* window) {
+	_host = window;
+	_window = (Window*)window;
+
+	_contentManager = webkit_user_content_manager_new();
+	_webview = WEBKIT_WEB_VIEW(g_object_new(WEBKIT_TYPE_WEB_VIEW,
+		"web-context", GetWebContext(),
+		"user-content-manager", _contentManager,
+		nullptr));
+	g_object_ref_sink(_webview);
+	g_object_set_data(G_OBJECT(_webview), WebViewKey, this);
+
+	_settings = webkit_web_view_get_settings(_webview);
+	webkit_settings_set_javascript_can_access_clipboard(_settings, TRUE);
+	ApplySettings();
+	if (IsSoftwareRendering())
+		webkit_settings_set_hardware_acceleration_policy(_settings, WEBKIT_HARDWARE_ACCELERATION_POLICY_NEVER);
+
+	constexpr GdkRGBA transparent = { 0, 0, 0, 0 };
+	webkit_web_view_set_background_color(_webview, &transparent);
+
+	const auto bootstrap = webkit_user_script_new(
+		R"(window.gluino = (function() {
+  const listeners = new Set();
+
+  return {
+    sendMessage: function(message) {
+      window.webkit.messageHandlers.gluino.postMessage(message);
+    },
+    addListener: function(callback) {
+      listeners.add(callback);
+    },
+    removeListener: function(callback) {
+      listeners.delete(callback);
+    },
+    __dispatch: function(message) {
+      listeners.forEach(function(callback) { callback(message); });
+    }
+  };
+})();)",
+		WEBKIT_USER_CONTENT_INJECT_TOP_FRAME,
+		WEBKIT_USER_SCRIPT_INJECT_AT_DOCUMENT_START,
+		nullptr, nullptr);
+	webkit_user_content_manager_add_script(_contentManager, bootstrap);
+	webkit_user_script_unref(bootstrap);
+
+	g_signal_connect(_contentManager, "script-message-received::gluino", G_CALLBACK(OnScriptMessage), this);
+	webkit_user_content_manager_register_script_message_handler(_contentManager, "gluino");
+
+	g_signal_connect(_webview, "load-changed", G_CALLBACK(OnLoadChanged), this);
+	g_signal_connect(_webview, "context-menu", G_CALLBACK(OnContextMenu), this);
+	g_signal_connect(_webview, "permission-request", G_CALLBACK(OnPermissionRequest), this);
+
+	// Each webview is an overlay of the window, which carries its bounds, visibility and place
+	// in the window's stack.
+	gtk_overlay_add_overlay(_window->GetOverlay(), GetWidget());
+	ApplyBounds();
+	gtk_widget_set_visible(GetWidget(), _visible);
+
+	if (_throttleLevel != ThrottleLevel::Active)
+		ApplyThrottleLevel(_throttleLevel);
+
+	// WebKit creates the view synchronously, but Created is still reported from the window's
+	// loop so the host has the handles first.
+	StartOnLoop();
+}
+
+void WebView::Navigate(const autostr url) {
+	if (_webview == nullptr) return;
+	RegisterScheme(url);
+	webkit_web_view_load_uri(_webview, url);
+}
+
+void WebView::NativateToString(const autostr content) {
+	if (_webview == nullptr) return;
+	webkit_web_view_load_html(_webview, content, nullptr);
+}
+
+void WebView::SendWebMessage(const autostr message) {
+	if (_webview == nullptr) return;
+
+	std::string script = "window.gluino.__dispatch(";
+	AppendJsString(&script, message);
+	script.append(");");
+	webkit_web_view_run_javascript(_webview, script.c_str(), nullptr, nullptr, nullptr);
+}
+
+void WebView::ApplyThrottleLevel(const ThrottleLevel level) {
+	if (_webview == nullptr) return;
+
+	// WebKitGTK has no public suspend; it already throttles pages whose view is hidden or whose
+	// window is iconified. A suspended page still gives back what JavaScript memory it can.
+	if (level == ThrottleLevel::Suspended)
+		webkit_web_context_garbage_collect_javascript_objects(GetWebContext());
+}
+
+void WebView::ApplyVisible(const bool visible) {
+	if (_webview == nullptr) return;
+	gtk_widget_set_visible(GetWidget(), visible);
+}
+
+void WebView::ApplyBounds() {
+	if (_webview == nullptr) return;
+
+	const auto widget = GetWidget();
+	if (_fillWindow) {
+		gtk_widget_set_halign(widget, GTK_ALIGN_FILL);
+		gtk_widget_set_valign(widget, GTK_ALIGN_FILL);
+		gtk_widget_set_margin_start(widget, 0);
+		gtk_widget_set_margin_top(widget, 0);
+		gtk_widget_set_size_request(widget, -1, -1);
+	}
+	else {
+		gtk_widget_set_halign(widget, GTK_ALIGN_START);
+		gtk_widget_set_valign(widget, GTK_ALIGN_START);
+		gtk_widget_set_margin_start(widget, std::max(_bounds.x, 0));
+		gtk_widget_set_margin_top(widget, std::max(_bounds.y, 0));
+		gtk_widget_set_size_request(widget, std::max(_bounds.width, 0), std::max(_bounds.height, 0));
+	}
+}
+
+void WebView::ApplySettings() {
+	if (_settings == nullptr) return;
+	webkit_settings_set_enable_developer_extras(_settings, _devToolsEnabled);
+	if (_userAgent) webkit_settings_set_user_agent(_settings, _userAgent);
+}
+
+void WebView::OnMount(const std::string& prefix) {
+	RegisterScheme(prefix.c_str());
+}
+
+void WebView::InjectScript(const autostr script, const bool onDocumentCreated) {
+	if (_webview == nullptr) return;
+	if (onDocumentCreated) {
+		const auto userScript = webkit_user_script_new(script,
+			WEBKIT_USER_CONTENT_INJECT_TOP_FRAME,
+			WEBKIT_USER_SCRIPT_INJECT_AT_DOCUMENT_START,
+			nullptr, nullptr);
+		webkit_user_content_manager_add_script(_contentManager, userScript);
+		webkit_user_script_unref(userScript);
+	}
+	else {
+		webkit_web_view_run_javascript(_webview, script, nullptr, nullptr, nullptr);
+	}
+}
+
+bool WebView::GetContextMenuEnabled() {
+	return _contextMenuEnabled;
+}
+
+void WebView::SetContextMenuEnabled(const bool enabled) {
+	_contextMenuEnabled = enabled;
+}
+
+bool WebView::GetDevToolsEnabled() {
+	return webkit_settings_get_enable_developer_extras(_settings);
+}
+
+void WebView::SetDevToolsEnabled(const bool enabled) {
+	webkit_settings_set_enable_developer_extras(_settings, enabled);
+}
+
+autostr WebView::GetUserAgent() {
+	return g_strdup(webkit_settings_get_user_agent(_settings));
+}
+
+void WebView::SetUserAgent(const autostr userAgent) {
+	webkit_settings_set_user_agent(_settings, userAgent);
+}
+
+void WebView::HandleSchemeRequest(WebKitURISchemeRequest* request) {
+	const auto uri = webkit_uri_scheme_request_get_uri(request);
+#if WEBKIT_CHECK_VERSION(2, 36, 0)
+	const auto method = webkit_uri_scheme_request_get_http_method(request);
+#else
+	const char* method = nullptr;
+#endif
+
+	ResourceQuery query{ ToUtf8(uri), ToUtf8(method ? method : "GET"), {}, {} };
+
+#if WEBKIT_CHECK_VERSION(2, 36, 0)
+	if (const auto headers = webkit_uri_scheme_request_get_http_headers(request)) {
+		SoupMessageHeadersIter iterator;
+		soup_message_headers_iter_init(&iterator, headers);
+		const char* name;
+		const char* value;
+		while (soup_message_headers_iter_next(&iterator, &name, &value)) {
+			if (g_ascii_strcasecmp(name, "Range") == 0)
+				query.Range = value;
+			query.Headers.append(name).append(": ").append(value).append("\r\n");
+		}
+	}
+#endif
+
+	if (ResourceResult result; _resourceRouter.Route(query, &result)) {
+		FinishRequest(request, CreateBlobStream(result.Blob, result.Offset, result.Length),
+			(gint64)result.Length, result.StatusCode, result.ContentType.c_str(), result.Headers);
+		return;
+	}
+	if (!_onResourceRequested) {
+		FinishRequestWithError(request);
+		return;
+	}
+
+	const WebResourceRequest req{
+		nullptr,
+		(char*)uri,
+		nullptr,
+		query.Method.data()
+	};
+	WebResourceResponse res{};
+	_window->FlushEvents();
+	_onResourceRequested(req, &res);
+
+	if (res.Content == nullptr) {
+		FinishRequestWithError(request);
+		return;
+	}
+
+	// The host allocates the content with the C allocator and hands it over with the response.
+	const auto bytes = g_bytes_new_with_free_func(res.Content, res.ContentLength, free, res.Content);
+	const auto stream = g_memory_input_stream_new_from_bytes(bytes);
+	g_bytes_unref(bytes);
+	FinishRequest(request, stream, res.ContentLength, res.StatusCode,
+		res.ContentTypeA ? res.ContentTypeA : "application/octet-stream", {});
+}
+
+void WebView::OnSchemeRequest(WebKitURISchemeRequest* request, gpointer) {
+	const auto webview = webkit_uri_scheme_request_get_web_view(request);
+	const auto self = webview ? (WebView*)g_object_get_data(G_OBJECT(webview), WebViewKey) : nullptr;
+	if (!self) {
+		FinishRequestWithError(request);
+		return;
+	}
+	self->HandleSchemeRequest(request);
+}
+
+void WebView::OnLoadChanged(WebKitWebView* webview, const WebKitLoadEvent loadEvent, const gpointer data) {
+	const auto self = (WebView*)data;
+	switch (loadEvent) {
+		case WEBKIT_LOAD_STARTED: {
+			const auto uri = webkit_web_view_get_uri(webview);
+			self->_prefetcher.Prefetch(ToUtf8(uri));
+			self->_window->PostEvent(EventType::NavigationStart, self->_viewId, 0, (autostr)uri);
+			break;
+		}
+		case WEBKIT_LOAD_COMMITTED: {
+			self->NotifyFirstCommit();
+			break;
+		}
+		case WEBKIT_LOAD_FINISHED: {
+			self->_window->PostEvent(EventType::NavigationEnd, self->_viewId);
+			break;
+		}
+		default: break;
+	}
+}
+
+void WebView::OnScriptMessage(WebKitUserContentManager*, WebKitJavascriptResult* result, const gpointer data) {
+	const auto self = (WebView*)data;
+	if (!self->_window->IsSubscribed(EventType::MessageReceived))
+		return;
+
+	const auto message = jsc_value_to_string(webkit_javascript_result_get_js_value(result));
+	self->_window->PostEvent(EventType::MessageReceived, self->_viewId, 0, message);
+	g_free(message);
+}
+
+gboolean WebView::OnContextMenu(WebKitWebView*, WebKitContextMenu*, GdkEvent*, WebKitHitTestResult*, const gpointer data) {
+	// Returning TRUE keeps the menu from being shown.
+	return !((WebView*)data)->_contextMenuEnabled;
+}
+
+gboolean WebView::OnPermissionRequest(WebKitWebView*, WebKitPermissionRequest* request, const gpointer data) {
+	if (!((WebView*)data)->_grantPermissions)
+		return FALSE;
+
+	webkit_permission_request_allow(request);
+	return TRUE;
+}
@@ -0,0 +1,594 @@
+#include "app.h"
+#include "window.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+using namespace Gluino;
+
+static GeometryCoalescer::Clock::duration GetRefreshInterval(GtkWindow* window) {
+	const auto display = gtk_widget_get_display(GTK_WIDGET(window));
+	const auto gdkWindow = gtk_widget_get_window(GTK_WIDGET(window));
+	const auto monitor = gdkWindow
+		? gdk_display_get_monitor_at_window(display, gdkWindow)
+		: gdk_display_get_primary_monitor(display);
+
+	// The refresh rate is reported in millihertz, or 0 when it is not known.
+	const auto rate = monitor ? gdk_monitor_get_refresh_rate(monitor) : 0;
+	if (rate <= 1000)
+		return GeometryCoalescer::DefaultInterval;
+
+	return std::chrono::duration_cast<GeometryCoalescer::Clock::duration>(
+		std::chrono::duration<double>(1000.0 / rate));
+}
+
+static bool IsSystemDarkMode() {
+	gchar* themeName = nullptr;
+	g_object_get(gtk_settings_get_default(), "gtk-theme-name", &themeName, nullptr);
+	if (!themeName)
+		return false;
+
+	const auto lowered = g_ascii_strdown(themeName, -1);
+	const auto dark = strstr(lowered, "dark") != nullptr;
+	g_free(lowered);
+	g_free(themeName);
+	return dark;
+}
+
+Window::Window(WindowOptions* options, const WindowEvents* events, WebView* webView) : WindowBase(options, events) {
+	_windowState = options->WindowState;
+	_minSize = options->MinimumSize;
+	_maxSize = options->MaximumSize;
+	_minimizeEnabled = options->MinimizeEnabled;
+	_maximizeEnabled = options->MaximizeEnabled;
+	_topMost = false;
+	_destroyed = false;
+	_geometryEventInterval = options->GeometryEventInterval;
+	_geometryTimer = 0;
+	_deferEvents = false;
+
+	// The window keeps a reference of its own so that work still queued for it after it has
+	// been destroyed finds a disposed widget rather than a freed one.
+	_window = GTK_WINDOW(gtk_window_new(GTK_WINDOW_TOPLEVEL));
+	g_object_ref(_window);
+	_overlay = GTK_OVERLAY(gtk_overlay_new());
+	gtk_container_add(GTK_CONTAINER(_window), GTK_WIDGET(_overlay));
+	gtk_widget_show(GTK_WIDGET(_overlay));
+
+	gtk_window_set_title(_window, _title);
+	gtk_window_set_default_size(_window, options->Size.width, options->Size.height);
+	if (options->StartupLocation != WindowStartupLocation::Default)
+		gtk_window_move(_window, options->Location.x, options->Location.y);
+
+	_loopSource = std::make_unique<LoopSource>(&_wakeHandle, nullptr, [this] { DrainInvokeQueue(); });
+
+	g_signal_connect(_window, "delete-event", G_CALLBACK(OnDeleteEvent), this);
+	g_signal_connect(_window, "destroy", G_CALLBACK(OnDestroy), this);
+	g_signal_connect(_window, "configure-event", G_CALLBACK(OnConfigureEvent), this);
+	g_signal_connect(_window, "window-state-event", G_CALLBACK(OnWindowStateEvent), this);
+	g_signal_connect(_window, "focus-in-event", G_CALLBACK(OnFocusInEvent), this);
+	g_signal_connect(_window, "focus-out-event", G_CALLBACK(OnFocusOutEvent), this);
+	g_signal_connect(_window, "show", G_CALLBACK(OnShow), this);
+	g_signal_connect(_window, "hide", G_CALLBACK(OnHide), this);
+	g_signal_connect(_window, "realize", G_CALLBACK(OnRealize), this);
+	_themeHandler = g_signal_connect(gtk_settings_get_default(), "notify::gtk-theme-name", G_CALLBACK(OnThemeChanged), this);
+
+	if (options->Icon)
+		SetIcon(options->Icon, options->IconSize);
+	SetTheme(options->Theme);
+	SetBorderStyle(options->BorderStyle);
+	UpdateGeometryHints();
+	if (options->StartupLocation == WindowStartupLocation::CenterScreen)
+		Center();
+	if (options->TopMost)
+		SetTopMost(options->TopMost);
+
+	SetGeometryEventInterval(_geometryEventInterval);
+	SetBackgroundThrottling(options->BackgroundThrottling);
+	SetBrowserSuspendDelay(options->BrowserSuspendDelay);
+
+	_webViews.Add(webView);
+	webView->Attach(this);
+
+	UpdateSnapshot();
+}
+
+Window::~Window() {
+	Destroy();
+	_loopSource.reset();
+	g_object_unref(_window);
+}
+
+void Window::Adopt(WindowOptions* options, const WindowEvents* events) {
+	WindowBase::Adopt(options, events);
+	_windowState = options->WindowState;
+	_minSize = options->MinimumSize;
+	_maxSize = options->MaximumSize;
+	_minimizeEnabled = options->MinimizeEnabled;
+	_maximizeEnabled = options->MaximizeEnabled;
+
+	gtk_window_set_title(_window, _title);
+	if (options->Icon)
+		SetIcon(options->Icon, options->IconSize);
+	SetTheme(options->Theme);
+	SetGeometryEventInterval(options->GeometryEventInterval);
+	SetBackgroundThrottling(options->BackgroundThrottling);
+	SetBrowserSuspendDelay(options->BrowserSuspendDelay);
+
+	// Window state is applied by Show, as for a new window.
+	SetBorderStyle(options->BorderStyle);
+	UpdateCaptionButtons();
+	UpdateGeometryHints();
+
+	gtk_window_resize(_window, options->Size.width, options->Size.height);
+	if (options->StartupLocation != WindowStartupLocation::Default)
+		gtk_window_move(_window, options->Location.x, options->Location.y);
+	if (options->StartupLocation == WindowStartupLocation::CenterScreen)
+		Center();
+	if (options->TopMost)
+		SetTopMost(options->TopMost);
+
+	UpdateSnapshot();
+}
+
+void Window::Show() {
+	gtk_widget_show(GTK_WIDGET(_window));
+
+	if (_windowState != WindowState::Normal)
+		SetWindowState(_windowState);
+}
+
+void Window::Hide() {
+	gtk_widget_hide(GTK_WIDGET(_window));
+}
+
+void Window::Close() {
+	// Like a click on the close button, this asks the host through delete-event first.
+	gtk_window_close(_window);
+}
+
+void Window::Destroy() {
+	if (!_destroyed)
+		gtk_widget_destroy(GTK_WIDGET(_window));
+}
+
+void Window::Center() {
+	const auto gdkWindow = gtk_widget_get_window(GTK_WIDGET(_window));
+	if (!gdkWindow) {
+		gtk_window_set_position(_window, GTK_WIN_POS_CENTER);
+		return;
+	}
+
+	GdkRectangle workArea;
+	gdk_monitor_get_workarea(gdk_display_get_monitor_at_window(gdk_window_get_display(gdkWindow), gdkWindow), &workArea);
+
+	int width, height;
+	gtk_window_get_size(_window, &width, &height);
+	Point loc = { workArea.x + (workArea.width - width) / 2, workArea.y + (workArea.height - height) / 2 };
+
+	SetLocation(loc);
+}
+
+void Window::DragMove() {
+	const auto seat = gdk_display_get_default_seat(gtk_widget_get_display(GTK_WIDGET(_window)));
+	gint x, y;
+	gdk_device_get_position(gdk_seat_get_pointer(seat), nullptr, &x, &y);
+	gtk_window_begin_move_drag(_window, 1, x, y, GDK_CURRENT_TIME);
+}
+
+void Window::SetGeometryEventInterval(const int interval) {
+	_geometryEventInterval = std::max(interval, 0);
+	_geometry.SetInterval(_geometryEventInterval > 0
+		? std::chrono::milliseconds(_geometryEventInterval)
+		: GetRefreshInterval(_window));
+}
+
+void Window::UpdateCaptionButtons() {
+	// Minimize and maximize are hints to the window manager, which needs the GDK window.
+	const auto gdkWindow = gtk_widget_get_window(GTK_WIDGET(_window));
+	if (!gdkWindow)
+		return;
+
+	auto functions = GDK_FUNC_MOVE | GDK_FUNC_CLOSE;
+	if (gtk_window_get_resizable(_window)) functions |= GDK_FUNC_RESIZE;
+	if (_minimizeEnabled)                  functions |= GDK_FUNC_MINIMIZE;
+	if (_maximizeEnabled)                  functions |= GDK_FUNC_MAXIMIZE;
+	gdk_window_set_functions(gdkWindow, (GdkWMFunction)functions);
+}
+
+void Window::UpdateGeometryHints() {
+	GdkGeometry hints = {};
+	hints.min_width = std::max(_minSize.width, 0);
+	hints.min_height = std::max(_minSize.height, 0);
+	hints.max_width = std::min(_maxSize.width, (int)G_MAXSHORT);
+	hints.max_height = std::min(_maxSize.height, (int)G_MAXSHORT);
+	gtk_window_set_geometry_hints(_window, nullptr, &hints, (GdkWindowHints)(GDK_HINT_MIN_SIZE | GDK_HINT_MAX_SIZE));
+}
+
+void Window::UpdateSnapshot() {
+	WindowSnapshot snapshot = {};
+	gtk_window_get_position(_window, &snapshot.Bounds.x, &snapshot.Bounds.y);
+	gtk_window_get_size(_window, &snapshot.Bounds.width, &snapshot.Bounds.height);
+
+	const auto gdkWindow = gtk_widget_get_window(GTK_WIDGET(_window));
+	const auto state = gdkWindow ? gdk_window_get_state(gdkWindow) : (GdkWindowState)0;
+	snapshot.WindowState =
+		state & GDK_WINDOW_STATE_ICONIFIED ? WindowState::Minimized :
+		state & GDK_WINDOW_STATE_MAXIMIZED ? WindowState::Maximized :
+		WindowState::Normal;
+	snapshot.IsDarkMode = _theme == WindowTheme::System ? IsSystemDarkMode() : _theme == WindowTheme::Dark;
+	PublishSnapshot(snapshot);
+}
+
+void Window::QueueGeometry(const bool due) {
+	if (_deferEvents)
+		return;
+
+	if (due) {
+		if (GeometryUpdate update; _geometry.Poll(GeometryCoalescer::Clock::now(), &update))
+			DeliverGeometry(update);
+	}
+
+	if (!_geometry.HasPending()) {
+		if (_geometryTimer)
+			g_source_remove(std::exchange(_geometryTimer, 0));
+		return;
+	}
+
+	if (_geometryTimer)
+		return;
+
+	const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(
+		_geometry.GetDeadline() - GeometryCoalescer::Clock::now()).count();
+	_geometryTimer = g_timeout_add((guint)std::max<long long>(remaining, 1), OnGeometryTimer, this);
+}
+
+void Window::DeliverGeometry(const GeometryUpdate& update) {
+	if (update.Resized)
+		PostEvent(EventType::Resize, update.Size.width, update.Size.height);
+	if (update.Moved)
+		PostEvent(EventType::LocationChanged, update.Location.x, update.Location.y);
+}
+
+void Window::Wake() {
+	_wakeHandle.Signal();
+}
+
+void Window::RestackWebViews() {
+	// Overlays are drawn in order, so each webview's index in the stack is its overlay position.
+	const auto& webViews = _webViews.GetAll();
+	for (size_t i = 0; i < webViews.size(); ++i)
+		gtk_overlay_reorder_overlay(_overlay, ((WebView*)webViews[i])->GetWidget(), (int)i);
+}
+
+WebViewBase* Window::AddWebView(WebViewOptions* options, const WebViewEvents* events) {
+	const auto webView = new WebView(options, events);
+	webView->SetRegistryHandle(WebViewRegistry.Add(webView));
+	_webViews.Add(webView);
+	webView->Attach(this);
+	webView->SetWindowThrottleLevel(GetThrottleLevel());
+	return webView;
+}
+
+bool Window::RemoveWebView(WebViewBase* webView) {
+	if (webView == _webViews.GetPrimary() || !_webViews.Remove(webView))
+		return false;
+
+	webView->GetFileTokens()->RevokeAll();
+	RetireWebView(webView->GetRegistryHandle(), [webView] { ((WebView*)webView)->Close(); });
+	return true;
+}
+
+void Window::GetBounds(Rect* bounds) {
+	*bounds = GetSnapshot().Bounds;
+}
+
+bool Window::GetIsDarkMode() {
+	return GetSnapshot().IsDarkMode;
+}
+
+autostr Window::GetTitle() {
+	const auto title = gtk_window_get_title(_window);
+	return CopyStr((autostr)(title ? title : ""));
+}
+
+void Window::SetTitle(const autostr title) {
+	delete[] _title;
+	_title = CopyStr(title);
+
+	gtk_window_set_title(_window, _title);
+}
+
+void Window::GetIcon(void** data, int* size) {
+	*data = _icon;
+	*size = _iconSize;
+}
+
+void Window::SetIcon(void* data, const int size) {
+	const auto loader = gdk_pixbuf_loader_new();
+	const auto loaded = gdk_pixbuf_loader_write(loader, (const guchar*)data, size, nullptr);
+	if (gdk_pixbuf_loader_close(loader, nullptr) && loaded) {
+		if (const auto pixbuf = gdk_pixbuf_loader_get_pixbuf(loader))
+			gtk_window_set_icon(_window, pixbuf);
+	}
+	g_object_unref(loader);
+}
+
+WindowBorderStyle Window::GetBorderStyle() {
+	return _borderStyle;
+}
+
+void Window::SetBorderStyle(const WindowBorderStyle style) {
+	gtk_window_set_decorated(_window,
+		style == WindowBorderStyle::Sizable ||
+		style == WindowBorderStyle::Fixed);
+	gtk_window_set_resizable(_window,
+		style == WindowBorderStyle::Sizable ||
+		style == WindowBorderStyle::SizableNoCaption);
+
+	_borderStyle = style;
+	UpdateCaptionButtons();
+}
+
+WindowState Window::GetWindowState() {
+	return GetSnapshot().WindowState;
+}
+
+void Window::SetWindowState(const WindowState state) {
+	switch (state) {
+		case WindowState::Maximized:
+			gtk_window_deiconify(_window);
+			gtk_window_maximize(_window);
+			break;
+		case WindowState::Minimized:
+			gtk_window_iconify(_window);
+			break;
+		case WindowState::Normal:
+			gtk_window_deiconify(_window);
+			gtk_window_unmaximize(_window);
+			break;
+	}
+}
+
+WindowTheme Window::GetTheme() {
+	return _theme;
+}
+
+void Window::SetTheme(const WindowTheme theme) {
+	// The preference is process-wide in GTK, so the last window to set a theme decides it.
+	_theme = theme;
+	const gboolean darkMode =
+		theme == WindowTheme::System ? IsSystemDarkMode() :
+		theme == WindowTheme::Dark;
+	g_object_set(gtk_settings_get_default(), "gtk-application-prefer-dark-theme", darkMode, nullptr);
+	UpdateSnapshot();
+}
+
+Size Window::GetMinimumSize() {
+	return _minSize;
+}
+
+void Window::SetMinimumSize(Size& size) {
+	_minSize = size;
+	UpdateGeometryHints();
+
+	const auto [width, height] = GetSize();
+	if (Size newSize = {
+		std::max(width, _minSize.width),
+		std::max(height, _minSize.height)
+		}; newSize.width != width || newSize.height != height) {
+		SetSize(newSize);
+	}
+}
+
+Size Window::GetMaximumSize() {
+	return _maxSize;
+}
+
+void Window::SetMaximumSize(Size& size) {
+	_maxSize = size;
+	UpdateGeometryHints();
+
+	const auto [width, height] = GetSize();
+	if (Size newSize = {
+			std::min(width, _maxSize.width),
+			std::min(height, _maxSize.height)
+		}; newSize.width != width || newSize.height != height) {
+		SetSize(newSize);
+	}
+}
+
+Size Window::GetSize() {
+	const auto bounds = GetSnapshot().Bounds;
+	return { bounds.width, bounds.height };
+}
+
+void Window::SetSize(Size& size) {
+	gtk_window_resize(_window, std::max(size.width, 1), std::max(size.height, 1));
+}
+
+Point Window::GetLocation() {
+	const auto bounds = GetSnapshot().Bounds;
+	return { bounds.x, bounds.y };
+}
+
+void Window::SetLocation(Point& location) {
+	gtk_window_move(_window, location.x, location.y);
+}
+
+bool Window::GetMinimizeEnabled() {
+	return _minimizeEnabled;
+}
+
+void Window::SetMinimizeEnabled(const bool enabled) {
+	_minimizeEnabled = enabled;
+	UpdateCaptionButtons();
+}
+
+bool Window::GetMaximizeEnabled() {
+	return _maximizeEnabled;
+}
+
+void Window::SetMaximizeEnabled(const bool enabled) {
+	_maximizeEnabled = enabled;
+	UpdateCaptionButtons();
+}
+
+bool Window::GetTopMost() {
+	return _topMost;
+}
+
+void Window::SetTopMost(const bool topMost) {
+	_topMost = topMost;
+	gtk_window_set_keep_above(_window, topMost);
+}
+
+void Window::ApplyChanges(const WindowChangeSet& changes) {
+	const auto previousState = _windowState;
+	_deferEvents = true;
+
+	if (changes.Has(WindowChange::Theme) && changes.Theme != _theme)
+		SetTheme(changes.Theme);
+	if (changes.Has(WindowChange::BorderStyle) && changes.BorderStyle != _borderStyle)
+		SetBorderStyle(changes.BorderStyle);
+	if (changes.Has(WindowChange::MinimizeEnabled))
+		_minimizeEnabled = changes.MinimizeEnabled;
+	if (changes.Has(WindowChange::MaximizeEnabled))
+		_maximizeEnabled = changes.MaximizeEnabled;
+	if (changes.Has(WindowChange::MinimumSize))
+		_minSize = changes.MinimumSize;
+	if (changes.Has(WindowChange::MaximumSize))
+		_maxSize = changes.MaximumSize;
+	if (changes.Has(WindowChange::TopMost))
+		SetTopMost(changes.TopMost);
+
+	UpdateCaptionButtons();
+	if (changes.Has(WindowChange::MinimumSize) || changes.Has(WindowChange::MaximumSize))
+		UpdateGeometryHints();
+
+	// GTK hands the requests to the window manager together; the configure events that follow
+	// are coalesced like any other move or resize.
+	if (changes.Has(WindowChange::Location))
+		gtk_window_move(_window, changes.Location.x, changes.Location.y);
+	if (changes.Has(WindowChange::Size) || changes.Has(WindowChange::MinimumSize) || changes.Has(WindowChange::MaximumSize)) {
+		auto [width, height] = changes.Has(WindowChange::Size) ? changes.Size : GetSize();
+		width = std::clamp(width, _minSize.width, std::max(_minSize.width, _maxSize.width));
+		height = std::clamp(height, _minSize.height, std::max(_minSize.height, _maxSize.height));
+		gtk_window_resize(_window, std::max(width, 1), std::max(height, 1));
+	}
+	if (changes.Has(WindowChange::WindowState))
+		SetWindowState(changes.WindowState);
+
+	UpdateSnapshot();
+	_deferEvents = false;
+
+	if (GeometryUpdate update; _geometry.Flush(&update))
+		DeliverGeometry(update);
+	QueueGeometry(false);
+
+	if (const auto currentState = GetWindowState(); currentState != previousState) {
+		PostEvent(EventType::WindowStateChanged, (int)currentState);
+		_windowState = currentState;
+	}
+}
+
+gboolean Window::OnDeleteEvent(GtkWidget*, GdkEvent*, const gpointer data) {
+	const auto window = (Window*)data;
+	window->FlushEvents();
+
+	// Returning FALSE lets GTK destroy the window.
+	return window->IsSubscribed(EventType::Closing) && window->_onClosing();
+}
+
+void Window::OnDestroy(GtkWidget*, const gpointer data) {
+	const auto window = (Window*)data;
+	if (std::exchange(window->_destroyed, true))
+		return;
+
+	App::NotifyDestroy(window);
+
+	for (const auto webView : window->_webViews.GetAll())
+		webView->GetFileTokens()->RevokeAll();
+	window->StopTimers();
+	window->FlushEvents();
+
+	if (window->_geometryTimer)
+		g_source_remove(std::exchange(window->_geometryTimer, 0));
+	g_signal_handler_disconnect(gtk_settings_get_default(), window->_themeHandler);
+}
+
+gboolean Window::OnConfigureEvent(GtkWidget*, GdkEventConfigure*, const gpointer data) {
+	const auto window = (Window*)data;
+	const auto previous = window->GetSnapshot().Bounds;
+	window->UpdateSnapshot();
+	const auto bounds = window->GetSnapshot().Bounds;
+
+	if (window->IsSubscribed(EventType::Resize) && (bounds.width != previous.width || bounds.height != previous.height))
+		window->QueueGeometry(window->_geometry.Resize({ bounds.width, bounds.height }, GeometryCoalescer::Clock::now()));
+	if (window->IsSubscribed(EventType::LocationChanged) && (bounds.x != previous.x || bounds.y != previous.y))
+		window->QueueGeometry(window->_geometry.Move({ bounds.x, bounds.y }, GeometryCoalescer::Clock::now()));
+	return FALSE;
+}
+
+gboolean Window::OnWindowStateEvent(GtkWidget*, GdkEventWindowState* event, const gpointer data) {
+	const auto window = (Window*)data;
+	window->UpdateSnapshot();
+	window->TrackMinimized(event->new_window_state & GDK_WINDOW_STATE_ICONIFIED);
+
+	if (const auto currentWindowState = window->GetWindowState();
+		!window->_deferEvents && currentWindowState != window->_windowState) {
+		window->PostEvent(EventType::WindowStateChanged, (int)currentWindowState);
+		window->_windowState = currentWindowState;
+	}
+	return FALSE;
+}
+
+gboolean Window::OnFocusInEvent(GtkWidget*, GdkEventFocus*, const gpointer data) {
+	const auto window = (Window*)data;
+	if (const auto webView = window->GetWebView())
+		webView->Focus();
+	window->PostEvent(EventType::FocusIn);
+	return FALSE;
+}
+
+gboolean Window::OnFocusOutEvent(GtkWidget*, GdkEventFocus*, const gpointer data) {
+	((Window*)data)->PostEvent(EventType::FocusOut);
+	return FALSE;
+}
+
+void Window::OnShow(GtkWidget*, const gpointer data) {
+	const auto window = (Window*)data;
+	window->PostEvent(EventType::Shown);
+	window->TrackVisibility(true);
+}
+
+void Window::OnHide(GtkWidget*, const gpointer data) {
+	const auto window = (Window*)data;
+	window->PostEvent(EventType::Hidden);
+	window->TrackVisibility(false);
+}
+
+void Window::OnRealize(GtkWidget*, const gpointer data) {
+	const auto window = (Window*)data;
+	window->UpdateCaptionButtons();
+	window->SetGeometryEventInterval(window->_geometryEventInterval);
+}
+
+void Window::OnThemeChanged(GObject*, GParamSpec*, const gpointer data) {
+	const auto window = (Window*)data;
+	if (window->_theme == WindowTheme::System)
+		window->SetTheme(WindowTheme::System);
+	else
+		window->UpdateSnapshot();
+}
+
+gboolean Window::OnGeometryTimer(const gpointer data) {
+	const auto window = (Window*)data;
+	window->_geometryTimer = 0;
+
+	if (GeometryUpdate update; window->_geometry.Poll(GeometryCoalescer::Clock::now(), &update))
+		window->DeliverGeometry(update);
+	window->QueueGeometry(false);
+	return G_SOURCE_REMOVE;
+}
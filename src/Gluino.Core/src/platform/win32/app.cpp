@@ -1,19 +1,21 @@
 #include "app.h"
 
 #include <dwmapi.h>
-#include <future>
-#include <map>
 #include <shobjidl_core.h>
 
 using namespace Gluino;
 
 App* app{};
-std::map<HWND, Window*> windowMap{};
+
+static Window* LookupWindow(const HWND hWnd) {
+	return (Window*)WindowRegistry.Get((WindowHandle)GetWindowLongPtr(hWnd, GWLP_USERDATA));
+}
 
 App::App(const HINSTANCE hInstance, wchar_t* appId) {
 	_hInstance = hInstance;
 	_appId = CopyStr(appId);
 	_wndClassName = ConcatStr(_appId, L"Window");
+	_mainThreadId = GetCurrentThreadId();
 
 	SetCurrentProcessExplicitAppUserModelID(_appId);
 	SetThreadDpiAwarenessContext(DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2);
@@ -38,47 +40,87 @@ App::App(const HINSTANCE hInstance, wchar_t* appId) {
 }
 
 App::~App() {
+	DestroyUiThreads();
 	delete[] _appId;
 	delete[] _wndClassName;
 }
 
-void App::SpawnWindow(
+WindowBase* App::NewWindowPair(
 	WindowOptions* windowOptions, WindowEvents* windowEvents,
 	WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
-	WindowBase** window, WebViewBase** webView) {
+	UiThreadBase*, WebViewBase** webView) {
 	const auto wv = new WebView(webViewOptions, webViewEvents);
-	const auto wnd = new Window(windowOptions, windowEvents, wv);
-
-	windowMap[wnd->GetHandle()] = wnd;
-
-	*window = wnd;
 	*webView = wv;
+	return new Window(windowOptions, windowEvents, wv);
+}
+
+void App::OnWindowCreated(WindowBase* window, UiThreadBase*) {
+	SetWindowLongPtr(((Window*)window)->GetHandle(), GWLP_USERDATA, (LONG_PTR)window->GetRegistryHandle());
 }
 
-void App::DespawnWindow(WindowBase* window) {
-	const auto win32Window = (Window*)window;
-	const HWND hWnd = win32Window->GetHandle();
+void App::OnDespawnWindow(WindowBase* window) {
+	const HWND hWnd = ((Window*)window)->GetHandle();
 
 	WCHAR className[256];
 	GetClassName(hWnd, className, 256);
-
 	UnregisterClass(className, _hInstance);
-	windowMap.erase(hWnd);
+}
 
-	if (window->IsMain())
-		Exit();
+std::unique_ptr<UiThreadBase> App::NewUiThread() {
+	return std::make_unique<UiThread>();
 }
 
 void App::Run() {
+	while (RunOnce(-1)) {}
+}
+
+bool App::RunOnce(int timeout) {
 	MSG msg;
-	while (GetMessage(&msg, nullptr, 0, 0)) {
-		TranslateMessage(&msg);
-		DispatchMessageW(&msg);
+	_wakeHandle.Reset();
+
+	if (!PeekMessage(&msg, nullptr, 0, 0, PM_NOREMOVE) && _invokeQueue.IsEmpty()) {
+		// Idle work only runs while no input, paint or invoke messages are queued.
+		if (_idleScheduler.HasWork() &&
+			_idleScheduler.RunSlice([this] { return HasPendingWork(); }))
+			timeout = 0;
+
+		_loopTimer.Wait((HANDLE)_wakeHandle.GetNative(), &_timerWheel, timeout);
+		_wakeHandle.Reset();
 	}
+
+	for (auto i = 0; i < MaxMessagesPerRun && PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE); ++i) {
+		if (msg.message == WM_QUIT) {
+			PostQuitMessage((int)msg.wParam);
+			return false;
+		}
+		ProcessMessage(msg);
+	}
+
+	if (_invokeQueue.Drain())
+		Wake();
+	_timerWheel.Advance(TimerWheel::Clock::now());
+	return true;
 }
 
 void App::Exit() {
-	PostQuitMessage(0);
+	StopUiThreads();
+	PostThreadMessage(_mainThreadId, WM_QUIT, 0, 0);
+	Wake();
+}
+
+bool App::HasPendingWork() {
+	// Window messages are queued per thread, so only the loop thread can see them.
+	if (GetCurrentThreadId() != _mainThreadId)
+		return !_invokeQueue.IsEmpty();
+
+	// The high word is what is in the queue now; the low word only what arrived since the last
+	// peek, which misses messages left behind when RunOnce stops at MaxMessagesPerRun.
+	return HIWORD(GetQueueStatus(QS_ALLINPUT)) != 0 || !_invokeQueue.IsEmpty();
+}
+
+void App::ProcessMessage(const MSG& msg) {
+	TranslateMessage(&msg);
+	DispatchMessageW(&msg);
 }
 
 HINSTANCE App::GetHInstance() {
@@ -89,21 +131,23 @@ wchar_t* App::GetWndClassName() {
 	return app->_wndClassName;
 }
 
+void App::NotifyWake(const HWND hWnd) {
+	// Only the loop driven by RunOnce needs the host's wait to return early.
+	if (app && GetWindowThreadProcessId(hWnd, nullptr) == app->_mainThreadId)
+		app->Wake();
+}
+
 LRESULT App::WndProc(const HWND hWnd, const UINT msg, const WPARAM wParam, const LPARAM lParam) {
-	const auto window = windowMap[hWnd];
+	const auto window = LookupWindow(hWnd);
 
 	switch (msg) {
 		case WM_DESTROY: {
-			if (windowMap.contains(hWnd))
-				app->DespawnWindow(windowMap[hWnd]);
+			if (window)
+				app->DespawnWindow(window);
 			break;
 		}
 		case WM_USER_INVOKE: {
-			const auto callback = (Delegate)wParam;
-			callback();
-
-			const auto promise = (std::promise<void>*)lParam;
-			promise->set_value();
+			if (window) window->DrainInvokeQueue();
 			return 0;
 		}
 		default: break;
@@ -0,0 +1,113 @@
+#include "blob_stream.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace Microsoft::WRL;
+using namespace Gluino;
+
+BlobStream::BlobStream(std::shared_ptr<const ResourceBlob> blob, const size_t offset, const size_t length) {
+	_blob = std::move(blob);
+	_offset = offset;
+	_length = _blob ? length : 0;
+}
+
+HRESULT BlobStream::Read(void* pv, const ULONG cb, ULONG* pcbRead) {
+	const auto wanted = std::min<size_t>(cb, _length - _position);
+	const auto count = wanted > 0 ? (ULONG)_blob->Read(_offset + _position, (char*)pv, wanted) : 0;
+	_position += count;
+
+	// A blob read from a file truncated under it comes up short; the stream ends there.
+	if (count < wanted)
+		_length = _position;
+
+	if (pcbRead) *pcbRead = count;
+	return count < cb ? S_FALSE : S_OK;
+}
+
+HRESULT BlobStream::Write(const void* pv, ULONG cb, ULONG* pcbWritten) {
+	return STG_E_ACCESSDENIED;
+}
+
+HRESULT BlobStream::Seek(const LARGE_INTEGER dlibMove, const DWORD dwOrigin, ULARGE_INTEGER* plibNewPosition) {
+	LONGLONG base;
+	switch (dwOrigin) {
+		case STREAM_SEEK_SET: base = 0; break;
+		case STREAM_SEEK_CUR: base = (LONGLONG)_position; break;
+		case STREAM_SEEK_END: base = (LONGLONG)_length; break;
+		default: return STG_E_INVALIDFUNCTION;
+	}
+
+	const auto position = base + dlibMove.QuadPart;
+	if (position < 0)
+		return STG_E_INVALIDFUNCTION;
+
+	_position = std::min((size_t)position, _length);
+	if (plibNewPosition) plibNewPosition->QuadPart = _position;
+	return S_OK;
+}
+
+HRESULT BlobStream::SetSize(ULARGE_INTEGER libNewSize) {
+	return E_NOTIMPL;
+}
+
+HRESULT BlobStream::CopyTo(IStream* pstm, const ULARGE_INTEGER cb, ULARGE_INTEGER* pcbRead, ULARGE_INTEGER* pcbWritten) {
+	auto remaining = (size_t)std::min<ULONGLONG>(cb.QuadPart, _length - _position);
+	std::vector<char> buffer(std::min<size_t>(remaining, 64 * 1024));
+
+	ULONGLONG read = 0, written = 0;
+	auto hr = S_OK;
+	while (remaining > 0 && SUCCEEDED(hr)) {
+		ULONG count;
+		Read(buffer.data(), (ULONG)std::min(remaining, buffer.size()), &count);
+		if (count == 0)
+			break;
+
+		ULONG chunkWritten = 0;
+		hr = pstm->Write(buffer.data(), count, &chunkWritten);
+		read += count;
+		written += chunkWritten;
+		remaining -= count;
+	}
+
+	if (pcbRead) pcbRead->QuadPart = read;
+	if (pcbWritten) pcbWritten->QuadPart = written;
+	return hr;
+}
+
+HRESULT BlobStream::Commit(DWORD grfCommitFlags) {
+	return S_OK;
+}
+
+HRESULT BlobStream::Revert() {
+	return E_NOTIMPL;
+}
+
+HRESULT BlobStream::LockRegion(ULARGE_INTEGER libOffset, ULARGE_INTEGER cb, DWORD dwLockType) {
+	return STG_E_INVALIDFUNCTION;
+}
+
+HRESULT BlobStream::UnlockRegion(ULARGE_INTEGER libOffset, ULARGE_INTEGER cb, DWORD dwLockType) {
+	return STG_E_INVALIDFUNCTION;
+}
+
+HRESULT BlobStream::Stat(STATSTG* pstatstg, DWORD grfStatFlag) {
+	if (!pstatstg)
+		return STG_E_INVALIDPOINTER;
+
+	*pstatstg = {};
+	pstatstg->type = STGTY_STREAM;
+	pstatstg->cbSize.QuadPart = _length;
+	pstatstg->grfMode = STGM_READ;
+	return S_OK;
+}
+
+HRESULT BlobStream::Clone(IStream** ppstm) {
+	if (!ppstm)
+		return STG_E_INVALIDPOINTER;
+
+	auto clone = Make<BlobStream>(_blob, _offset, _length);
+	clone->_position = _position;
+	*ppstm = clone.Detach();
+	return S_OK;
+}
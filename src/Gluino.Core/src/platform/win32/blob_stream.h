@@ -0,0 +1,41 @@
+#pragma once
+
+#ifndef GLUINO_BLOB_STREAM_H
+#define GLUINO_BLOB_STREAM_H
+
+#include "resource.h"
+
+#include <Windows.h>
+#include <wrl.h>
+
+namespace Gluino {
+
+class BlobStream final : public Microsoft::WRL::RuntimeClass<
+	Microsoft::WRL::RuntimeClassFlags<Microsoft::WRL::ClassicCom>,
+	Microsoft::WRL::ChainInterfaces<IStream, ISequentialStream>> {
+public:
+	BlobStream(std::shared_ptr<const ResourceBlob> blob, size_t offset, size_t length);
+
+	HRESULT STDMETHODCALLTYPE Read(void* pv, ULONG cb, ULONG* pcbRead) override;
+	HRESULT STDMETHODCALLTYPE Write(const void* pv, ULONG cb, ULONG* pcbWritten) override;
+
+	HRESULT STDMETHODCALLTYPE Seek(LARGE_INTEGER dlibMove, DWORD dwOrigin, ULARGE_INTEGER* plibNewPosition) override;
+	HRESULT STDMETHODCALLTYPE SetSize(ULARGE_INTEGER libNewSize) override;
+	HRESULT STDMETHODCALLTYPE CopyTo(IStream* pstm, ULARGE_INTEGER cb, ULARGE_INTEGER* pcbRead, ULARGE_INTEGER* pcbWritten) override;
+	HRESULT STDMETHODCALLTYPE Commit(DWORD grfCommitFlags) override;
+	HRESULT STDMETHODCALLTYPE Revert() override;
+	HRESULT STDMETHODCALLTYPE LockRegion(ULARGE_INTEGER libOffset, ULARGE_INTEGER cb, DWORD dwLockType) override;
+	HRESULT STDMETHODCALLTYPE UnlockRegion(ULARGE_INTEGER libOffset, ULARGE_INTEGER cb, DWORD dwLockType) override;
+	HRESULT STDMETHODCALLTYPE Stat(STATSTG* pstatstg, DWORD grfStatFlag) override;
+	HRESULT STDMETHODCALLTYPE Clone(IStream** ppstm) override;
+
+private:
+	std::shared_ptr<const ResourceBlob> _blob;
+	size_t _offset;
+	size_t _length;
+	size_t _position = 0;
+};
+
+}
+
+#endif // !GLUINO_BLOB_STREAM_H
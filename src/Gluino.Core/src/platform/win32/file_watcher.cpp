@@ -0,0 +1,107 @@
+#include "file_watcher.h"
+#include "common.h"
+
+#include <algorithm>
+#include <utility>
+#include <Windows.h>
+
+using namespace Gluino;
+
+FileWatcher::FileWatcher(std::string root, ChangeCallback callback)
+	: _root(std::move(root)), _callback(std::move(callback)) {}
+
+FileWatcher::~FileWatcher() {
+	Stop();
+}
+
+bool FileWatcher::Start() {
+	if (_running) return true;
+
+	_hDirectory = CreateFileW(ToWide(_root).c_str(), FILE_LIST_DIRECTORY,
+		FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+		FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+	if (_hDirectory == INVALID_HANDLE_VALUE) {
+		_hDirectory = nullptr;
+		return false;
+	}
+
+	_hStopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	_running = true;
+	_thread = std::thread(&FileWatcher::Run, this);
+	return true;
+}
+
+void FileWatcher::Stop() {
+	if (_running.exchange(false)) {
+		SetEvent(_hStopEvent);
+		_thread.join();
+	}
+
+	if (_hDirectory) CloseHandle(_hDirectory);
+	if (_hStopEvent) CloseHandle(_hStopEvent);
+	_hDirectory = _hStopEvent = nullptr;
+}
+
+void FileWatcher::Run() {
+	alignas(DWORD) char buffer[64 * 1024];
+	std::vector<std::string> pending;
+	bool overflow = false;
+
+	OVERLAPPED overlapped{};
+	overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+	constexpr DWORD filter =
+		FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME |
+		FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+
+	bool reading = false;
+	while (_running) {
+		if (!reading) {
+			ResetEvent(overlapped.hEvent);
+			if (!ReadDirectoryChangesW(_hDirectory, buffer, sizeof buffer, TRUE, filter, nullptr, &overlapped, nullptr))
+				break;
+			reading = true;
+		}
+
+		const HANDLE handles[] = { overlapped.hEvent, _hStopEvent };
+		const DWORD timeout = pending.empty() && !overflow ? INFINITE : (DWORD)DebounceInterval.count();
+		const auto result = WaitForMultipleObjects(2, handles, FALSE, timeout);
+
+		if (result == WAIT_OBJECT_0 + 1)
+			break;
+
+		if (result == WAIT_TIMEOUT) {
+			std::sort(pending.begin(), pending.end());
+			pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+			_callback(pending, std::exchange(overflow, false));
+			pending.clear();
+			continue;
+		}
+
+		reading = false;
+
+		// An empty result or ERROR_NOTIFY_ENUM_DIR means the buffer overflowed and changes were lost.
+		DWORD length = 0;
+		if (!GetOverlappedResult(_hDirectory, &overlapped, &length, FALSE) || length == 0) {
+			overflow = true;
+			continue;
+		}
+
+		for (auto info = (const FILE_NOTIFY_INFORMATION*)buffer;;) {
+			std::wstring name(info->FileName, info->FileNameLength / sizeof(wchar_t));
+			std::replace(name.begin(), name.end(), L'\\', L'/');
+			pending.push_back(ToUtf8(name.c_str()));
+
+			if (info->NextEntryOffset == 0)
+				break;
+			info = (const FILE_NOTIFY_INFORMATION*)((const char*)info + info->NextEntryOffset);
+		}
+	}
+
+	if (reading) {
+		CancelIoEx(_hDirectory, &overlapped);
+		DWORD length;
+		GetOverlappedResult(_hDirectory, &overlapped, &length, TRUE);
+	}
+	CloseHandle(overlapped.hEvent);
+}
@@ -0,0 +1,54 @@
+#include "loop_timer.h"
+
+#include <algorithm>
+
+using namespace Gluino;
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+LoopTimer::LoopTimer() {
+	_hTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (!_hTimer)
+		_hTimer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+}
+
+LoopTimer::~LoopTimer() {
+	if (_hTimer)
+		CloseHandle(_hTimer);
+}
+
+void LoopTimer::Wait(const HANDLE hEvent, TimerWheel* timerWheel, int timeout) {
+	HANDLE handles[2];
+	DWORD count = 0;
+	if (hEvent)
+		handles[count++] = hEvent;
+
+	auto armed = false;
+	if (const auto deadline = timerWheel->GetNextDeadline()) {
+		const auto remaining = *deadline - TimerWheel::Clock::now();
+		if (remaining <= TimerWheel::Clock::duration::zero())
+			return;
+
+		// Relative due times are negative and expressed in 100ns units.
+		const auto ticks = std::chrono::duration_cast<std::chrono::duration<int64_t, std::ratio<1, 10000000>>>(remaining).count();
+		LARGE_INTEGER due;
+		due.QuadPart = -std::max<int64_t>(ticks, 1);
+
+		if (_hTimer && SetWaitableTimer(_hTimer, &due, 0, nullptr, nullptr, FALSE)) {
+			handles[count++] = _hTimer;
+			armed = true;
+		}
+		else {
+			const auto ms = (int)std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+			timeout = timeout < 0 ? ms : std::min(timeout, ms);
+		}
+	}
+
+	MsgWaitForMultipleObjectsEx(count, count ? handles : nullptr, timeout < 0 ? INFINITE : (DWORD)timeout,
+		QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+
+	if (armed)
+		CancelWaitableTimer(_hTimer);
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#ifndef GLUINO_LOOP_TIMER_H
+#define GLUINO_LOOP_TIMER_H
+
+#include "timer_wheel.h"
+
+#include <Windows.h>
+
+namespace Gluino {
+
+// Waits for window messages, an optional wake event and the next timer wheel deadline.
+// A high-resolution waitable timer is used where available so that deadlines are not
+// quantised to the system timer tick.
+class LoopTimer {
+public:
+	LoopTimer();
+	~LoopTimer();
+
+	LoopTimer(const LoopTimer&) = delete;
+	LoopTimer& operator=(const LoopTimer&) = delete;
+
+	void Wait(HANDLE hEvent, TimerWheel* timerWheel, int timeout);
+
+private:
+	HANDLE _hTimer;
+};
+
+}
+
+#endif // !GLUINO_LOOP_TIMER_H
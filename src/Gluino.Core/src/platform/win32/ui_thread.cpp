@@ -0,0 +1,103 @@
+#include "ui_thread.h"
+#include "app.h"
+#include "webview.h"
+
+#include <mutex>
+
+using namespace Gluino;
+
+namespace {
+
+constexpr auto UiThreadClassName = L"GluinoUiThread";
+
+void RegisterUiThreadClass() {
+	static std::once_flag once;
+	std::call_once(once, [] {
+		WNDCLASSEX wcex = { sizeof(WNDCLASSEX) };
+		wcex.lpfnWndProc = UiThread::WndProc;
+		wcex.hInstance = App::GetHInstance();
+		wcex.lpszClassName = UiThreadClassName;
+		RegisterClassEx(&wcex);
+	});
+}
+
+}
+
+UiThread::UiThread() {
+	RegisterUiThreadClass();
+
+	std::promise<void> ready;
+	const auto future = ready.get_future();
+	_thread = std::thread(&UiThread::Run, this, &ready);
+	future.wait();
+}
+
+UiThread::~UiThread() {
+	Stop();
+	if (_thread.joinable())
+		_thread.join();
+}
+
+void UiThread::Stop() {
+	if (_stopping.exchange(true))
+		return;
+
+	// Windows still owned by the thread are destroyed on it before its loop exits.
+	Dispatch([] {
+		EnumThreadWindows(GetCurrentThreadId(), [](const HWND hWnd, LPARAM) -> BOOL {
+			DestroyWindow(hWnd);
+			return TRUE;
+		}, 0);
+		PostQuitMessage(0);
+	});
+}
+
+void UiThread::Wake() {
+	PostMessage(_hWnd, WM_USER_INVOKE, 0, 0);
+}
+
+void UiThread::Run(std::promise<void>* ready) {
+	CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED);
+	SetThreadDpiAwarenessContext(DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2);
+
+	_threadId = GetCurrentThreadId();
+	_hWnd = CreateWindowEx(0, UiThreadClassName, nullptr, 0, 0, 0, 0, 0,
+		HWND_MESSAGE, nullptr, App::GetHInstance(), this);
+	ready->set_value();
+
+	MSG msg;
+	for (auto running = true; running;) {
+		if (!PeekMessage(&msg, nullptr, 0, 0, PM_NOREMOVE))
+			_loopTimer.Wait(nullptr, &_timerWheel, -1);
+
+		while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) {
+			if (msg.message == WM_QUIT) {
+				running = false;
+				break;
+			}
+			TranslateMessage(&msg);
+			DispatchMessageW(&msg);
+		}
+
+		if (running)
+			_timerWheel.Advance(TimerWheel::Clock::now());
+	}
+
+	DestroyWindow(_hWnd);
+	WebView::ReleaseThreadEnvironment();
+	CoUninitialize();
+}
+
+LRESULT UiThread::WndProc(const HWND hWnd, const UINT msg, const WPARAM wParam, const LPARAM lParam) {
+	if (msg == WM_NCCREATE) {
+		const auto createStruct = reinterpret_cast<CREATESTRUCT*>(lParam);
+		SetWindowLongPtr(hWnd, GWLP_USERDATA, (LONG_PTR)createStruct->lpCreateParams);
+	}
+	else if (msg == WM_USER_INVOKE) {
+		if (const auto thread = (UiThread*)GetWindowLongPtr(hWnd, GWLP_USERDATA))
+			thread->DrainInvokeQueue();
+		return 0;
+	}
+
+	return DefWindowProc(hWnd, msg, wParam, lParam);
+}
@@ -198,14 +198,27 @@ void Gluino::AdjustMaximizedClientRect(const HWND hWnd, RECT& rect) noexcept {
     rect = monitorInfo.rcWork;
 }
 
-void Gluino::ApplyBorderlessStyle(const HWND hWnd, const bool borderless) noexcept {
-    const auto compositionEnabled = IsCompositionEnabled();
-
+DWORD Gluino::GetFrameStyle(const bool borderless) noexcept {
     constexpr DWORD aeroBorderless = WS_POPUP | WS_THICKFRAME | WS_CAPTION | WS_SYSMENU | WS_MAXIMIZEBOX | WS_MINIMIZEBOX;
     constexpr DWORD basicBorderless = WS_POPUP | WS_THICKFRAME | WS_SYSMENU | WS_MAXIMIZEBOX | WS_MINIMIZEBOX;
-    const DWORD borderlessStyle = compositionEnabled ? aeroBorderless : basicBorderless;
 
-    const DWORD newStyle = borderless ? borderlessStyle : WS_OVERLAPPEDWINDOW;
+    if (!borderless) {
+        return WS_OVERLAPPEDWINDOW;
+    }
+    return IsCompositionEnabled() ? aeroBorderless : basicBorderless;
+}
+
+void Gluino::ExtendFrame(const HWND hWnd, const bool borderless) noexcept {
+    if (!IsCompositionEnabled()) {
+        return;
+    }
+
+    constexpr MARGINS shadowState[2] = { StyleExtendMargins, {1, 1, 1, 1} };
+    DwmExtendFrameIntoClientArea(hWnd, &shadowState[borderless]);
+}
+
+void Gluino::ApplyBorderlessStyle(const HWND hWnd, const bool borderless) noexcept {
+    const DWORD newStyle = GetFrameStyle(borderless);
     const DWORD oldStyle = GetWindowLong(hWnd, GWL_STYLE);
 
     if (newStyle == oldStyle) {
@@ -213,11 +226,7 @@ void Gluino::ApplyBorderlessStyle(const HWND hWnd, const bool borderless) noexce
     }
 
     SetWindowLongW(hWnd, GWL_STYLE, static_cast<LONG>(newStyle));
-
-    if (compositionEnabled) {
-        constexpr MARGINS shadowState[2] = { StyleExtendMargins, {1, 1, 1, 1} };
-        DwmExtendFrameIntoClientArea(hWnd, &shadowState[borderless]);
-    }
+    ExtendFrame(hWnd, borderless);
 
     SetWindowPos(hWnd, nullptr, 0, 0, 0, 0, SWP_FRAMECHANGED | SWP_NOMOVE | SWP_NOSIZE);
     ShowWindow(hWnd, SW_SHOW);
@@ -236,3 +245,26 @@ void Gluino::ApplyWindowStyle(const HWND hWnd, const bool darkMode) noexcept {
     constexpr DWM_SYSTEMBACKDROP_TYPE value = DWMSBT_MAINWINDOW;
     DwmSetWindowAttribute(hWnd, DWMWA_SYSTEMBACKDROP_TYPE, &value, sizeof value);
 }
+
+
+std::string Gluino::ToUtf8(const wchar_t* str) {
+    if (str == nullptr || *str == L'\0') {
+        return {};
+    }
+
+    const int length = WideCharToMultiByte(CP_UTF8, 0, str, -1, nullptr, 0, nullptr, nullptr);
+    std::string result(length - 1, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, str, -1, result.data(), length, nullptr, nullptr);
+    return result;
+}
+
+std::wstring Gluino::ToWide(const std::string& str) {
+    if (str.empty()) {
+        return {};
+    }
+
+    const int length = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), (int)str.size(), nullptr, 0);
+    std::wstring result(length, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, str.c_str(), (int)str.size(), result.data(), length);
+    return result;
+}
@@ -3,6 +3,8 @@
 #ifndef GLUINO_UTILS_H
 #define GLUINO_UTILS_H
 
+#include "common.h"
+
 #include <Windows.h>
 
 namespace Gluino {
@@ -72,6 +74,8 @@ void RefreshNonClientArea(HWND hWnd) noexcept;
 bool IsColorSchemeChange(LPARAM lParam) noexcept;
 bool IsCompositionEnabled() noexcept;
 void AdjustMaximizedClientRect(HWND hWnd, RECT& rect) noexcept;
+DWORD GetFrameStyle(bool borderless) noexcept;
+void ExtendFrame(HWND hWnd, bool borderless) noexcept;
 void ApplyBorderlessStyle(HWND hWnd, bool borderless) noexcept;
 void ApplyWindowStyle(HWND hWnd, bool darkMode) noexcept;
 
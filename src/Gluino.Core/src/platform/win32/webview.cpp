@@ -1,7 +1,13 @@
+#include "app.h"
 #include "webview.h"
+#include "blob_stream.h"
+#include "utils.h"
 
+#include <algorithm>
 #include <shlobj.h>
 #include <Shlwapi.h>
+#include <utility>
+#include <vector>
 #include <wrl.h>
 
 #pragma comment(lib, "Shlwapi.lib")
@@ -9,24 +15,69 @@
 using namespace Microsoft::WRL;
 using namespace Gluino;
 
+namespace {
+
+// WebView2 objects are bound to the thread that created them, so each UI thread shares one
+// environment between its webviews. Webviews attached while it is being created wait for it.
+struct SharedEnvironment {
+	wil::com_ptr<ICoreWebView2Environment> Environment;
+	std::vector<WebView*> Pending;
+	bool Creating = false;
+};
+
+thread_local SharedEnvironment sharedEnvironment;
+
+}
+
 WebView::~WebView() {
+	std::erase(sharedEnvironment.Pending, this);
 	delete[] _userAgent;
 }
 
+void WebView::ReleaseThreadEnvironment() {
+	sharedEnvironment.Environment.reset();
+	sharedEnvironment.Pending.clear();
+	sharedEnvironment.Creating = false;
+}
+
 void WebView::Refit(const WindowBorderStyle& borderStyle) const {
-	if (_webviewController == nullptr) return;
+	if (_hWndHost == nullptr) return;
 
 	RECT bounds;
-	GetClientRect(_hWndWnd, &bounds);
-	if (borderStyle == WindowBorderStyle::SizableNoCaption ||
-		borderStyle == WindowBorderStyle::FixedNoCaption) {
-		bounds.top += 1;
-		bounds.left += 1;
-		bounds.right -= 1;
-		bounds.bottom -= 1;
+	if (_fillWindow) {
+		GetClientRect(_hWndWnd, &bounds);
+		if (borderStyle == WindowBorderStyle::SizableNoCaption ||
+			borderStyle == WindowBorderStyle::FixedNoCaption) {
+			bounds.top += 1;
+			bounds.left += 1;
+			bounds.right -= 1;
+			bounds.bottom -= 1;
+		}
+	}
+	else {
+		bounds = { _bounds.x, _bounds.y, _bounds.x + _bounds.width, _bounds.y + _bounds.height };
 	}
 
-	_webviewController->put_Bounds(bounds);
+	const auto width = std::max<LONG>(bounds.right - bounds.left, 0);
+	const auto height = std::max<LONG>(bounds.bottom - bounds.top, 0);
+	SetWindowPos(_hWndHost, nullptr, bounds.left, bounds.top, width, height, SWP_NOZORDER | SWP_NOACTIVATE);
+	if (_webviewController)
+		_webviewController->put_Bounds({ 0, 0, width, height });
+}
+
+void WebView::Close() {
+	_closed = true;
+	std::erase(sharedEnvironment.Pending, this);
+
+	// A controller that is still being created calls back into this webview; it is released
+	// once the controller arrives.
+	if (_creatingController)
+		return;
+
+	if (_webviewController)
+		_webviewController->Close();
+	DestroyWindow(_hWndHost);
+	delete this;
 }
 
 void WebView::Focus() const {
@@ -35,15 +86,56 @@ void WebView::Focus() const {
 }
 
 void WebView::Attach(WindowBase* window) {
+	_host = window;
 	_window = (Window*)window;
 	_hWndWnd = _window->GetHandle();
 
+	// Each webview lives in a child window of its own, which carries its bounds, visibility
+	// and place in the window's stack.
+	_hWndHost = CreateWindowEx(
+		0,
+		L"STATIC",
+		nullptr,
+		WS_VISIBLE | WS_CHILD | WS_CLIPSIBLINGS | WS_CLIPCHILDREN,
+		0,
+		0,
+		0,
+		0,
+		_hWndWnd,
+		nullptr,
+		App::GetHInstance(),
+		nullptr);
+	Refit(_window->GetBorderStyle());
+
+	if (sharedEnvironment.Environment) {
+		OnWebView2CreateEnvironmentCompleted(S_OK, sharedEnvironment.Environment.get());
+		return;
+	}
+
+	sharedEnvironment.Pending.push_back(this);
+	if (std::exchange(sharedEnvironment.Creating, true))
+		return;
+
 	wchar_t dataPath[MAX_PATH];
 	SHGetSpecialFolderPath(nullptr, dataPath, CSIDL_LOCAL_APPDATA, FALSE);
 
-	CreateCoreWebView2EnvironmentWithOptions(nullptr, dataPath, nullptr,
-		Callback<ICoreWebView2CreateCoreWebView2EnvironmentCompletedHandler>(this,
-			&WebView::OnWebView2CreateEnvironmentCompleted).Get());
+	const auto hr = CreateCoreWebView2EnvironmentWithOptions(nullptr, dataPath, nullptr,
+		Callback<ICoreWebView2CreateCoreWebView2EnvironmentCompletedHandler>(
+			[](const HRESULT result, ICoreWebView2Environment* env) -> HRESULT {
+				sharedEnvironment.Creating = false;
+				if (result == S_OK)
+					sharedEnvironment.Environment = env;
+
+				for (const auto webView : std::exchange(sharedEnvironment.Pending, {}))
+					webView->OnWebView2CreateEnvironmentCompleted(result, env);
+				return S_OK;
+			}).Get());
+
+	if (hr != S_OK) {
+		sharedEnvironment.Creating = false;
+		for (const auto webView : std::exchange(sharedEnvironment.Pending, {}))
+			webView->NotifyReady();
+	}
 }
 
 void WebView::Navigate(const autostr url) {
@@ -56,11 +148,51 @@ void WebView::NativateToString(const autostr content) {
 	_webview->NavigateToString(content);
 }
 
-void WebView::PostWebMessage(const autostr message) {
+void WebView::SendWebMessage(const autostr message) {
 	if (_webview == nullptr) return;
 	_webview->PostWebMessageAsString(message);
 }
 
+void WebView::ApplyThrottleLevel(const ThrottleLevel level) {
+	if (_webviewController == nullptr) return;
+
+	// A hidden controller lets WebView2 lower the page's priority and throttle its timers, and
+	// only a hidden one can be suspended.
+	const auto webview3 = _webview.try_query<ICoreWebView2_3>();
+	if (BOOL suspended = FALSE; webview3 && level != ThrottleLevel::Suspended &&
+		SUCCEEDED(webview3->get_IsSuspended(&suspended)) && suspended)
+		webview3->Resume();
+
+	_webviewController->put_IsVisible(level == ThrottleLevel::Active);
+
+	// A suspended page also gives back what memory it can until it is shown again.
+	if (const auto webview19 = _webview.try_query<ICoreWebView2_19>()) {
+		webview19->put_MemoryUsageTargetLevel(level == ThrottleLevel::Suspended
+			? COREWEBVIEW2_MEMORY_USAGE_TARGET_LEVEL_LOW
+			: COREWEBVIEW2_MEMORY_USAGE_TARGET_LEVEL_NORMAL);
+	}
+
+	if (webview3 && level == ThrottleLevel::Suspended) {
+		webview3->TrySuspend(Callback<ICoreWebView2TrySuspendCompletedHandler>(
+			[](HRESULT, BOOL) { return S_OK; }).Get());
+	}
+}
+
+void WebView::ApplyVisible(const bool visible) {
+	ShowWindow(_hWndHost, visible ? SW_SHOWNA : SW_HIDE);
+}
+
+void WebView::ApplyBounds() {
+	Refit(_window->GetBorderStyle());
+}
+
+void WebView::ApplySettings() {
+	if (_webviewSettings == nullptr) return;
+	_webviewSettings->put_AreDefaultContextMenusEnabled(_contextMenuEnabled);
+	_webviewSettings->put_AreDevToolsEnabled(_devToolsEnabled);
+	if (_userAgent && _webviewSettings2) _webviewSettings2->put_UserAgent(_userAgent);
+}
+
 void WebView::InjectScript(autostr script, bool onDocumentCreated) {
 	if (_webview == nullptr) return;
 	if (onDocumentCreated)
@@ -69,10 +201,6 @@ void WebView::InjectScript(autostr script, bool onDocumentCreated) {
 		_webview->ExecuteScript(script, nullptr);
 }
 
-bool WebView::GetGrantPermissions() const {
-	return _grantPermissions;
-}
-
 bool WebView::GetContextMenuEnabled() {
 	BOOL enabled;
 	_webviewSettings->get_AreDefaultContextMenusEnabled(&enabled);
@@ -104,22 +232,38 @@ void WebView::SetUserAgent(const autostr userAgent) {
 }
 
 HRESULT WebView::OnWebView2CreateEnvironmentCompleted(const HRESULT result, ICoreWebView2Environment* env) {
-	if (result != S_OK) return result;
-	const auto envResult = env->QueryInterface(&_webviewEnv);
-	if (envResult != S_OK) return envResult;
-
-	env->CreateCoreWebView2Controller(_hWndWnd,
-		Callback<ICoreWebView2CreateCoreWebView2ControllerCompletedHandler>(this,
-			&WebView::OnWebView2CreateControllerCompleted).Get());
-
-	return S_OK;
+	HRESULT hr = result;
+	if (hr == S_OK)
+		hr = env->QueryInterface(&_webviewEnv);
+	if (hr == S_OK)
+		hr = env->CreateCoreWebView2Controller(_hWndHost,
+			Callback<ICoreWebView2CreateCoreWebView2ControllerCompletedHandler>(this,
+				&WebView::OnWebView2CreateControllerCompleted).Get());
+	_creatingController = hr == S_OK;
+
+	if (hr != S_OK) {
+		NotifyReady();
+		NotifyFirstCommit();
+	}
+	return hr;
 }
 
 HRESULT WebView::OnWebView2CreateControllerCompleted(const HRESULT result, ICoreWebView2Controller* controller) {
-	if (result != S_OK) return result;
+	_creatingController = false;
+	if (_closed) {
+		if (result == S_OK)
+			controller->Close();
+		DestroyWindow(_hWndHost);
+		delete this;
+		return S_OK;
+	}
 
-	const auto controllerResult = controller->QueryInterface(&_webviewController);
-	if (controllerResult != S_OK) return controllerResult;
+	const auto controllerResult = result == S_OK ? controller->QueryInterface(&_webviewController) : result;
+	if (controllerResult != S_OK) {
+		NotifyReady();
+		NotifyFirstCommit();
+		return controllerResult;
+	}
 
 	_webviewController->get_CoreWebView2(&_webview);
 
@@ -132,11 +276,11 @@ HRESULT WebView::OnWebView2CreateControllerCompleted(const HRESULT result, ICore
 	_webviewSettings->put_AreDefaultScriptDialogsEnabled(TRUE);
 	_webviewSettings->put_IsWebMessageEnabled(TRUE);
 	_webviewSettings->put_IsStatusBarEnabled(FALSE);
-	_webviewSettings->put_AreDefaultContextMenusEnabled(_contextMenuEnabled);
-	_webviewSettings->put_AreDevToolsEnabled(_devToolsEnabled);
-
 	_webviewSettings2 = _webviewSettings.try_query<ICoreWebView2Settings2>();
-	if (_userAgent) _webviewSettings2->put_UserAgent(_userAgent);
+	ApplySettings();
+
+	if (_throttleLevel != ThrottleLevel::Active)
+		ApplyThrottleLevel(_throttleLevel);
 
 
 
@@ -166,13 +310,16 @@ HRESULT WebView::OnWebView2CreateControllerCompleted(const HRESULT result, ICore
   };
 })();)", nullptr);
 
-	_onCreated();
-
 	EventRegistrationToken navigationStartingToken;
 	_webview->add_NavigationStarting(
 		Callback<ICoreWebView2NavigationStartingEventHandler>(this,
 			&WebView::OnWebView2NavigationStarting).Get(), &navigationStartingToken);
 
+	EventRegistrationToken contentLoadingToken;
+	_webview->add_ContentLoading(
+		Callback<ICoreWebView2ContentLoadingEventHandler>(this,
+			&WebView::OnWebView2ContentLoading).Get(), &contentLoadingToken);
+
 	EventRegistrationToken navigationCompletedToken;
 	_webview->add_NavigationCompleted(
 		Callback<ICoreWebView2NavigationCompletedEventHandler>(this,
@@ -194,13 +341,7 @@ HRESULT WebView::OnWebView2CreateControllerCompleted(const HRESULT result, ICore
 		Callback<ICoreWebView2PermissionRequestedEventHandler>(this,
 			&WebView::OnWebView2PermissionRequested).Get(), &permissionRequestedToken);
 
-	if (_startUrl) 
-		_webview->Navigate(_startUrl);
-	else if (_startContent) 
-		_webview->NavigateToString(_startContent);
-
-	Refit(_window->GetBorderStyle());
-
+	Start();
 	return S_OK;
 }
 
@@ -208,25 +349,34 @@ HRESULT WebView::OnWebView2NavigationStarting(ICoreWebView2* sender, ICoreWebVie
 	wil::unique_cotaskmem_string uri;
 	if (const auto hr = args->get_Uri(&uri); hr != S_OK)
 		return hr;
-	_onNavigationStart(uri.get());
+	_prefetcher.Prefetch(ToUtf8(uri.get()));
+	_window->PostEvent(EventType::NavigationStart, _viewId, 0, uri.get());
+	return S_OK;
+}
+
+HRESULT WebView::OnWebView2ContentLoading(ICoreWebView2* sender, ICoreWebView2ContentLoadingEventArgs* args) {
+	NotifyFirstCommit();
 	return S_OK;
 }
 
 HRESULT WebView::OnWebView2NavigationCompleted(ICoreWebView2* sender, ICoreWebView2NavigationCompletedEventArgs* args) {
-	_onNavigationEnd();
+	_window->PostEvent(EventType::NavigationEnd, _viewId);
 	return S_OK;
 }
 
 HRESULT WebView::OnWebView2WebMessageReceived(ICoreWebView2* sender, ICoreWebView2WebMessageReceivedEventArgs* args) {
+	if (!_window->IsSubscribed(EventType::MessageReceived))
+		return S_OK;
+
 	wil::unique_cotaskmem_string message;
 	if (const auto hr = args->TryGetWebMessageAsString(&message); hr != S_OK)
 		return hr;
-	_onMessageReceived(message.get());
+	_window->PostEvent(EventType::MessageReceived, _viewId, 0, message.get());
 	return S_OK;
 }
 
 HRESULT WebView::OnWebView2WebResourceRequested(ICoreWebView2* sender, ICoreWebView2WebResourceRequestedEventArgs* args) {
-	ICoreWebView2WebResourceRequest* request;
+	wil::com_ptr<ICoreWebView2WebResourceRequest> request;
 	args->get_Request(&request);
 
 	wil::unique_cotaskmem_string reqUri;
@@ -235,6 +385,32 @@ HRESULT WebView::OnWebView2WebResourceRequested(ICoreWebView2* sender, ICoreWebV
 	wil::unique_cotaskmem_string reqMethod;
 	request->get_Method(&reqMethod);
 
+	ResourceQuery query{ ToUtf8(reqUri.get()), ToUtf8(reqMethod.get()), {}, {} };
+
+	wil::com_ptr<ICoreWebView2HttpRequestHeaders> headers;
+	wil::com_ptr<ICoreWebView2HttpHeadersCollectionIterator> iterator;
+	if (request->get_Headers(&headers) == S_OK && headers->GetIterator(&iterator) == S_OK) {
+		BOOL hasHeader = FALSE;
+		while (iterator->get_HasCurrentHeader(&hasHeader) == S_OK && hasHeader) {
+			wil::unique_cotaskmem_string name, value;
+			if (iterator->GetCurrentHeader(&name, &value) == S_OK) {
+				const auto valueStr = ToUtf8(value.get());
+				if (_wcsicmp(name.get(), L"Range") == 0)
+					query.Range = valueStr;
+				query.Headers.append(ToUtf8(name.get())).append(": ").append(valueStr).append("\r\n");
+			}
+
+			BOOL hasNext = FALSE;
+			if (iterator->MoveNext(&hasNext) != S_OK || !hasNext)
+				break;
+		}
+	}
+
+	if (ResourceResult result; _resourceRouter.Route(query, &result))
+		return PutResourceResponse(args, result);
+	if (!_onResourceRequested)
+		return S_OK;
+
 	const WebResourceRequest req{
 		reqUri.get(),
 		nullptr,
@@ -242,6 +418,7 @@ HRESULT WebView::OnWebView2WebResourceRequested(ICoreWebView2* sender, ICoreWebV
 		nullptr
 	};
 	WebResourceResponse res;
+	_window->FlushEvents();
 	_onResourceRequested(req, &res);
 
 	const wil::unique_cotaskmem content(res.Content);
@@ -270,3 +447,20 @@ HRESULT WebView::OnWebView2PermissionRequested(ICoreWebView2* sender, ICoreWebVi
 		args->put_State(COREWEBVIEW2_PERMISSION_STATE_ALLOW);
 	return S_OK;
 }
+
+HRESULT WebView::PutResourceResponse(ICoreWebView2WebResourceRequestedEventArgs* args, const ResourceResult& result) const {
+	const auto stream = Make<BlobStream>(result.Blob, result.Offset, result.Length);
+	const auto reasonPhrase = ToWide(GetReasonPhrase(result.StatusCode));
+	const auto headers = ToWide(result.GetHeaders());
+
+	wil::com_ptr<ICoreWebView2WebResourceResponse> response;
+	if (const auto hr = _webviewEnv->CreateWebResourceResponse(
+		stream.Get(),
+		result.StatusCode,
+		reasonPhrase.c_str(),
+		headers.c_str(),
+		&response); hr != S_OK)
+		return hr;
+
+	return args->put_Response(response.get());
+}
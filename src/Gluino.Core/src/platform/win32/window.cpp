@@ -2,17 +2,36 @@
 #include "window.h"
 #include "window_frame.h"
 
-#include <future>
 #include <algorithm>
 
 using namespace Gluino;
 
+constexpr UINT_PTR GeometryTimerId = 1;
+
+static GeometryCoalescer::Clock::duration GetRefreshInterval(const HWND hWnd) {
+	MONITORINFOEXW monitorInfo = {};
+	monitorInfo.cbSize = sizeof(monitorInfo);
+	DEVMODEW devMode = {};
+	devMode.dmSize = sizeof(devMode);
+
+	if (!GetMonitorInfoW(MonitorFromWindow(hWnd, MONITOR_DEFAULTTONEAREST), &monitorInfo) ||
+		!EnumDisplaySettingsW(monitorInfo.szDevice, ENUM_CURRENT_SETTINGS, &devMode) ||
+		devMode.dmDisplayFrequency <= 1)
+		return GeometryCoalescer::DefaultInterval;
+
+	return std::chrono::duration_cast<GeometryCoalescer::Clock::duration>(
+		std::chrono::duration<double>(1.0 / devMode.dmDisplayFrequency));
+}
+
 Window::Window(WindowOptions* options, const WindowEvents* events, WebView* webView) : WindowBase(options, events) {
 	_windowState = options->WindowState;
 	_minSize = options->MinimumSize;
 	_maxSize = options->MaximumSize;
 	_minimizeEnabled = options->MinimizeEnabled;
 	_maximizeEnabled = options->MaximizeEnabled;
+	_geometryEventInterval = options->GeometryEventInterval;
+	_geometryTimerArmed = false;
+	_deferEvents = false;
 
 	const auto x = options->StartupLocation == WindowStartupLocation::Default ? CW_USEDEFAULT : options->Location.x;
 	const auto y = options->StartupLocation == WindowStartupLocation::Default ? CW_USEDEFAULT : options->Location.y;
@@ -41,62 +60,129 @@ Window::Window(WindowOptions* options, const WindowEvents* events, WebView* webV
 	if (options->TopMost)
 		SetTopMost(options->TopMost);
 
+	SetGeometryEventInterval(_geometryEventInterval);
+	SetBackgroundThrottling(options->BackgroundThrottling);
+	SetBrowserSuspendDelay(options->BrowserSuspendDelay);
+
 	_frame = new WindowFrame(_hWnd);
 	if (options->BorderStyle == WindowBorderStyle::SizableNoCaption)
 		_frame->Attach();
 
-	_webView = webView;
-	_webView->Attach(this);
+	_webViews.Add(webView);
+	webView->Attach(this);
+
+	UpdateSnapshot();
 }
 
 Window::~Window() {
 	delete[] _title;
 }
 
+void Window::Adopt(WindowOptions* options, const WindowEvents* events) {
+	WindowBase::Adopt(options, events);
+	_windowState = options->WindowState;
+	_minSize = options->MinimumSize;
+	_maxSize = options->MaximumSize;
+	_minimizeEnabled = options->MinimizeEnabled;
+	_maximizeEnabled = options->MaximizeEnabled;
+
+	SetWindowText(_hWnd, _title);
+	if (options->Icon)
+		SetIcon(options->Icon, options->IconSize);
+	SetTheme(options->Theme);
+	SetGeometryEventInterval(options->GeometryEventInterval);
+	SetBackgroundThrottling(options->BackgroundThrottling);
+	SetBrowserSuspendDelay(options->BrowserSuspendDelay);
+
+	// Window state, border style and caption buttons are applied by Show, as for a new window.
+	if (options->BorderStyle == WindowBorderStyle::SizableNoCaption)
+		_frame->Attach();
+	else
+		_frame->Detach();
+
+	const auto flags = options->StartupLocation == WindowStartupLocation::Default ? SWP_NOMOVE : 0;
+	SetWindowPos(_hWnd, nullptr, options->Location.x, options->Location.y,
+		options->Size.width, options->Size.height, SWP_NOACTIVATE | SWP_NOZORDER | flags);
+	if (options->StartupLocation == WindowStartupLocation::CenterScreen)
+		Center();
+	if (options->TopMost)
+		SetTopMost(options->TopMost);
+
+	UpdateSnapshot();
+}
+
 LRESULT Window::WndProc(const UINT msg, const WPARAM wParam, const LPARAM lParam) {
 	switch (msg) {
 		case WM_ACTIVATE: {
 			if (LOWORD(wParam) == WA_INACTIVE) {
-				_onFocusOut();
+				PostEvent(EventType::FocusOut);
 			}
 			else {
-				_webView->Focus();
-				_onFocusIn();
+				GetWebView()->Focus();
+				PostEvent(EventType::FocusIn);
 				return 0;
 			}
 			break;
 		}
 		case WM_SIZE: {
-			std::this_thread::sleep_for(std::chrono::nanoseconds(5000));
+			UpdateSnapshot();
+			TrackMinimized(wParam == SIZE_MINIMIZED);
 
-			_webView->Refit(_borderStyle);
+			for (const auto webView : _webViews.GetAll())
+				((WebView*)webView)->Refit(_borderStyle);
 
-			_onResize(GetSize());
+			if (IsSubscribed(EventType::Resize))
+				QueueGeometry(_geometry.Resize(GetSize(), GeometryCoalescer::Clock::now()));
 
-			if (const auto currentWindowState =
-				IsIconic(_hWnd) ? WindowState::Minimized :
-				IsZoomed(_hWnd) ? WindowState::Maximized :
-				WindowState::Normal;
-				currentWindowState != _windowState) {
-				_onWindowStateChanged((int)currentWindowState);
+			if (const auto currentWindowState = GetWindowState();
+				!_deferEvents && currentWindowState != _windowState) {
+				PostEvent(EventType::WindowStateChanged, (int)currentWindowState);
 				_windowState = currentWindowState;
 			}
 
 			return 0;
 		}
 		case WM_ENTERSIZEMOVE: {
-			_onResizeStart(GetSize());
+			if (IsSubscribed(EventType::ResizeStart)) {
+				const auto size = GetSize();
+				PostEvent(EventType::ResizeStart, size.width, size.height);
+			}
 			break;
 		}
 		case WM_EXITSIZEMOVE: {
 			if (_borderStyle == WindowBorderStyle::SizableNoCaption)
 				_frame->Update();
 
-			_onResizeEnd(GetSize());
+			if (GeometryUpdate update; _geometry.Flush(&update))
+				DeliverGeometry(update);
+			QueueGeometry(false);
+
+			if (IsSubscribed(EventType::ResizeEnd)) {
+				const auto size = GetSize();
+				PostEvent(EventType::ResizeEnd, size.width, size.height);
+			}
 			break;
 		}
 		case WM_MOVE: {
-			_onLocationChanged(GetLocation());
+			UpdateSnapshot();
+			if (IsSubscribed(EventType::LocationChanged))
+				QueueGeometry(_geometry.Move(GetLocation(), GeometryCoalescer::Clock::now()));
+			break;
+		}
+		case WM_TIMER: {
+			if (wParam != GeometryTimerId)
+				break;
+
+			KillTimer(_hWnd, GeometryTimerId);
+			_geometryTimerArmed = false;
+
+			if (GeometryUpdate update; _geometry.Poll(GeometryCoalescer::Clock::now(), &update))
+				DeliverGeometry(update);
+			QueueGeometry(false);
+			return 0;
+		}
+		case WM_DISPLAYCHANGE: {
+			SetGeometryEventInterval(_geometryEventInterval);
 			break;
 		}
 		case WM_GETMINMAXINFO: {
@@ -109,16 +195,24 @@ LRESULT Window::WndProc(const UINT msg, const WPARAM wParam, const LPARAM lParam
 			break;
 		}
 		case WM_SHOWWINDOW: {
-			if (wParam == TRUE) _onShown();
-			else                _onHidden();
+			PostEvent(wParam == TRUE ? EventType::Shown : EventType::Hidden);
+			TrackVisibility(wParam == TRUE);
 			break;
 		}
 		case WM_CLOSE: {
-			if (const auto cancel = _onClosing(); !cancel) {
+			FlushEvents();
+			if (const auto cancel = IsSubscribed(EventType::Closing) && _onClosing(); !cancel) {
 				DestroyWindow(_hWnd);				
 			}
 			return 0;
 		}
+		case WM_DESTROY: {
+			for (const auto webView : _webViews.GetAll())
+				webView->GetFileTokens()->RevokeAll();
+			StopTimers();
+			FlushEvents();
+			break;
+		}
 		case WM_NCCALCSIZE: {
 			if (wParam == TRUE && 
 				_borderStyle == WindowBorderStyle::SizableNoCaption || 
@@ -137,6 +231,7 @@ LRESULT Window::WndProc(const UINT msg, const WPARAM wParam, const LPARAM lParam
 		}
 		case WM_THEMECHANGED: {
 			ApplyWindowStyle(_hWnd, IsDarkModeEnabled());
+			UpdateSnapshot();
 			break;
 		}
 		default:
@@ -189,29 +284,99 @@ void Window::DragMove() {
 	PostMessage(_hWnd, WM_NCLBUTTONDOWN, HTCAPTION, 0);
 }
 
-void Window::Invoke(Delegate action) {
-	std::promise<void> promise;
-	const std::future<void> future = promise.get_future();
-
-	PostMessage(_hWnd, WM_USER_INVOKE, (WPARAM)action, (LPARAM)&promise);
-
-	future.wait();
+void Window::SetGeometryEventInterval(const int interval) {
+	_geometryEventInterval = std::max(interval, 0);
+	_geometry.SetInterval(_geometryEventInterval > 0
+		? std::chrono::milliseconds(_geometryEventInterval)
+		: GetRefreshInterval(_hWnd));
 }
 
-void Window::GetBounds(Rect* bounds) {
+void Window::UpdateSnapshot() {
 	RECT rect;
 	GetWindowRect(_hWnd, &rect);
 
-	*bounds = {
-		rect.right - rect.left,
-		rect.bottom - rect.top,
-		rect.left,
-		rect.top
-	};
+	WindowSnapshot snapshot = {};
+	snapshot.Bounds = { rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top };
+	snapshot.WindowState =
+		IsIconic(_hWnd) ? WindowState::Minimized :
+		IsZoomed(_hWnd) ? WindowState::Maximized :
+		WindowState::Normal;
+	snapshot.IsDarkMode = _theme == WindowTheme::System ? IsDarkModeEnabled() : _theme == WindowTheme::Dark;
+	PublishSnapshot(snapshot);
+}
+
+void Window::QueueGeometry(const bool due) {
+	if (_deferEvents)
+		return;
+
+	if (due) {
+		if (GeometryUpdate update; _geometry.Poll(GeometryCoalescer::Clock::now(), &update))
+			DeliverGeometry(update);
+	}
+
+	if (!_geometry.HasPending()) {
+		if (_geometryTimerArmed)
+			KillTimer(_hWnd, GeometryTimerId);
+		_geometryTimerArmed = false;
+		return;
+	}
+
+	if (_geometryTimerArmed)
+		return;
+
+	const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(
+		_geometry.GetDeadline() - GeometryCoalescer::Clock::now()).count();
+	SetTimer(_hWnd, GeometryTimerId, (UINT)std::max<long long>(remaining, USER_TIMER_MINIMUM), nullptr);
+	_geometryTimerArmed = true;
+}
+
+void Window::DeliverGeometry(const GeometryUpdate& update) {
+	if (update.Resized)
+		PostEvent(EventType::Resize, update.Size.width, update.Size.height);
+	if (update.Moved)
+		PostEvent(EventType::LocationChanged, update.Location.x, update.Location.y);
+}
+
+void Window::Wake() {
+	PostMessage(_hWnd, WM_USER_INVOKE, 0, 0);
+	App::NotifyWake(_hWnd);
+}
+
+void Window::RestackWebViews() {
+	// Front to back, each host goes right below the one placed before it.
+	auto insertAfter = HWND_TOP;
+	const auto& webViews = _webViews.GetAll();
+	for (auto it = webViews.rbegin(); it != webViews.rend(); ++it) {
+		const auto host = ((WebView*)*it)->GetHostHandle();
+		SetWindowPos(host, insertAfter, 0, 0, 0, 0, SWP_NOMOVE | SWP_NOSIZE | SWP_NOACTIVATE);
+		insertAfter = host;
+	}
+}
+
+WebViewBase* Window::AddWebView(WebViewOptions* options, const WebViewEvents* events) {
+	const auto webView = new WebView(options, events);
+	webView->SetRegistryHandle(WebViewRegistry.Add(webView));
+	_webViews.Add(webView);
+	webView->Attach(this);
+	webView->SetWindowThrottleLevel(GetThrottleLevel());
+	return webView;
+}
+
+bool Window::RemoveWebView(WebViewBase* webView) {
+	if (webView == _webViews.GetPrimary() || !_webViews.Remove(webView))
+		return false;
+
+	webView->GetFileTokens()->RevokeAll();
+	RetireWebView(webView->GetRegistryHandle(), [webView] { ((WebView*)webView)->Close(); });
+	return true;
+}
+
+void Window::GetBounds(Rect* bounds) {
+	*bounds = GetSnapshot().Bounds;
 }
 
 bool Window::GetIsDarkMode() {
-	return _theme == WindowTheme::System ? IsDarkModeEnabled() : _theme == WindowTheme::Dark;
+	return GetSnapshot().IsDarkMode;
 }
 
 autostr Window::GetTitle() {
@@ -275,14 +440,7 @@ void Window::SetBorderStyle(const WindowBorderStyle style) {
 }
 
 WindowState Window::GetWindowState() {
-	WINDOWPLACEMENT placement;
-	if (GetWindowPlacement(_hWnd, &placement))
-		return WindowState::Normal;
-	switch (placement.showCmd) {
-		case SW_MAXIMIZE: return WindowState::Maximized;
-		case SW_MINIMIZE: return WindowState::Minimized;
-		default:          return WindowState::Normal;
-	}
+	return GetSnapshot().WindowState;
 }
 
 void Window::SetWindowState(const WindowState state) {
@@ -308,6 +466,7 @@ void Window::SetTheme(const WindowTheme theme) {
 		theme == WindowTheme::Dark;
 	ApplyWindowStyle(_hWnd, darkMode);
 	UpdateWindow(_hWnd);
+	UpdateSnapshot();
 }
 
 Size Window::GetMinimumSize() {
@@ -343,9 +502,8 @@ void Window::SetMaximumSize(Size& size) {
 }
 
 Size Window::GetSize() {
-	RECT rect;
-	GetWindowRect(_hWnd, &rect);
-	return { rect.right - rect.left, rect.bottom - rect.top };
+	const auto bounds = GetSnapshot().Bounds;
+	return { bounds.width, bounds.height };
 }
 
 void Window::SetSize(Size& size) {
@@ -353,9 +511,8 @@ void Window::SetSize(Size& size) {
 }
 
 Point Window::GetLocation() {
-	RECT rect;
-	GetWindowRect(_hWnd, &rect);
-	return { rect.left, rect.top };
+	const auto bounds = GetSnapshot().Bounds;
+	return { bounds.x, bounds.y };
 }
 
 void Window::SetLocation(Point& location) {
@@ -375,16 +532,8 @@ bool Window::GetMinimizeEnabled() {
 void Window::SetMinimizeEnabled(const bool enabled) {
 	_minimizeEnabled = enabled;
 
-	if (_borderStyle == WindowBorderStyle::SizableNoCaption ||
-		_borderStyle == WindowBorderStyle::FixedNoCaption) {
-		return;
-	}
-
-	auto style = GetWindowLong(_hWnd, GWL_STYLE);
-	if (enabled) style |= WS_MINIMIZEBOX;
-	else         style &= ~WS_MINIMIZEBOX;
-	SetWindowLong(_hWnd, GWL_STYLE, style);
-	SetWindowPos(_hWnd, nullptr, 0, 0, 0, 0, SWP_NOMOVE | SWP_NOSIZE | SWP_NOZORDER | SWP_FRAMECHANGED);
+	if (UpdateCaptionButtons())
+		SetWindowPos(_hWnd, nullptr, 0, 0, 0, 0, SWP_NOMOVE | SWP_NOSIZE | SWP_NOZORDER | SWP_FRAMECHANGED);
 }
 
 bool Window::GetMaximizeEnabled() {
@@ -400,16 +549,8 @@ bool Window::GetMaximizeEnabled() {
 void Window::SetMaximizeEnabled(const bool enabled) {
 	_maximizeEnabled = enabled;
 
-	if (_borderStyle == WindowBorderStyle::SizableNoCaption ||
-		_borderStyle == WindowBorderStyle::FixedNoCaption) {
-		return;
-	}
-
-	auto style = GetWindowLong(_hWnd, GWL_STYLE);
-	if (enabled) style |= WS_MAXIMIZEBOX;
-	else         style &= ~WS_MAXIMIZEBOX;
-	SetWindowLong(_hWnd, GWL_STYLE, style);
-	SetWindowPos(_hWnd, nullptr, 0, 0, 0, 0, SWP_NOMOVE | SWP_NOSIZE | SWP_NOZORDER | SWP_FRAMECHANGED);
+	if (UpdateCaptionButtons())
+		SetWindowPos(_hWnd, nullptr, 0, 0, 0, 0, SWP_NOMOVE | SWP_NOSIZE | SWP_NOZORDER | SWP_FRAMECHANGED);
 }
 
 bool Window::GetTopMost() {
@@ -420,3 +561,151 @@ bool Window::GetTopMost() {
 void Window::SetTopMost(const bool topMost) {
     SetWindowPos(_hWnd, topMost ? HWND_TOPMOST : HWND_NOTOPMOST, 0, 0, 0, 0, SWP_NOMOVE | SWP_NOSIZE);
 }
+
+void Window::ApplyChanges(const WindowChangeSet& changes) {
+	const auto previousState = _windowState;
+	_deferEvents = true;
+	SendMessage(_hWnd, WM_SETREDRAW, FALSE, 0);
+
+	if (changes.Has(WindowChange::Theme) && changes.Theme != _theme)
+		SetTheme(changes.Theme);
+	if (changes.Has(WindowChange::MinimizeEnabled))
+		_minimizeEnabled = changes.MinimizeEnabled;
+	if (changes.Has(WindowChange::MaximizeEnabled))
+		_maximizeEnabled = changes.MaximizeEnabled;
+	if (changes.Has(WindowChange::MinimumSize))
+		_minSize = changes.MinimumSize;
+	if (changes.Has(WindowChange::MaximumSize))
+		_maxSize = changes.MaximumSize;
+
+	UINT flags = SWP_NOACTIVATE | SWP_NOZORDER;
+	HWND insertAfter = nullptr;
+
+	// Border and caption buttons are written as one style, recalculated with the geometry below.
+	const auto borderStyle = changes.Has(WindowChange::BorderStyle) ? changes.BorderStyle : _borderStyle;
+	const auto style = GetWindowLongPtr(_hWnd, GWL_STYLE);
+	if (const auto newStyle = BuildStyle(borderStyle, style); newStyle != style) {
+		SetWindowLongPtr(_hWnd, GWL_STYLE, newStyle);
+		flags |= SWP_FRAMECHANGED;
+	}
+	if (borderStyle != _borderStyle) {
+		if (const auto borderless = IsBorderless(borderStyle); borderless != IsBorderless(_borderStyle))
+			ExtendFrame(_hWnd, borderless);
+		if (borderStyle == WindowBorderStyle::SizableNoCaption)
+			_frame->Attach();
+		else
+			_frame->Detach();
+		_borderStyle = borderStyle;
+	}
+	if (changes.Has(WindowChange::TopMost)) {
+		insertAfter = changes.TopMost ? HWND_TOPMOST : HWND_NOTOPMOST;
+		flags &= ~SWP_NOZORDER;
+	}
+
+	auto [x, y, width, height] = GetSnapshot().Bounds;
+	WINDOWPLACEMENT placement = { sizeof(WINDOWPLACEMENT) };
+	GetWindowPlacement(_hWnd, &placement);
+	if (placement.showCmd != SW_SHOWNORMAL) {
+		x = placement.rcNormalPosition.left;
+		y = placement.rcNormalPosition.top;
+		width = placement.rcNormalPosition.right - placement.rcNormalPosition.left;
+		height = placement.rcNormalPosition.bottom - placement.rcNormalPosition.top;
+	}
+
+	if (changes.Has(WindowChange::Location)) {
+		x = changes.Location.x;
+		y = changes.Location.y;
+	}
+	if (changes.Has(WindowChange::Size) || changes.Has(WindowChange::MinimumSize) || changes.Has(WindowChange::MaximumSize)) {
+		if (changes.Has(WindowChange::Size)) {
+			width = changes.Size.width;
+			height = changes.Size.height;
+		}
+		width = std::clamp(width, _minSize.width, std::max(_minSize.width, _maxSize.width));
+		height = std::clamp(height, _minSize.height, std::max(_minSize.height, _maxSize.height));
+	}
+
+	const auto targetState = changes.Has(WindowChange::WindowState) ? changes.WindowState : GetWindowState();
+	if (targetState == WindowState::Normal && placement.showCmd == SW_SHOWNORMAL) {
+		// Geometry, z-order and frame all change in a single SetWindowPos.
+		SetWindowPos(_hWnd, insertAfter, x, y, width, height, flags);
+	}
+	else {
+		// rcNormalPosition is in workspace coordinates, which differ from screen coordinates
+		// when the taskbar sits on the top or left edge of the monitor.
+		MONITORINFO monitorInfo = { sizeof(MONITORINFO) };
+		GetMonitorInfo(MonitorFromWindow(_hWnd, MONITOR_DEFAULTTONEAREST), &monitorInfo);
+		const auto offsetX = monitorInfo.rcWork.left - monitorInfo.rcMonitor.left;
+		const auto offsetY = monitorInfo.rcWork.top - monitorInfo.rcMonitor.top;
+
+		placement.rcNormalPosition = { x - offsetX, y - offsetY, x - offsetX + width, y - offsetY + height };
+		placement.showCmd =
+			targetState == WindowState::Maximized ? SW_MAXIMIZE :
+			targetState == WindowState::Minimized ? SW_MINIMIZE :
+			SW_SHOWNORMAL;
+		if (!IsWindowVisible(_hWnd) && targetState == WindowState::Normal)
+			placement.showCmd = SW_HIDE;
+
+		SetWindowPlacement(_hWnd, &placement);
+		if (flags & SWP_FRAMECHANGED || insertAfter)
+			SetWindowPos(_hWnd, insertAfter, 0, 0, 0, 0, flags | SWP_NOMOVE | SWP_NOSIZE);
+	}
+
+	SendMessage(_hWnd, WM_SETREDRAW, TRUE, 0);
+	RedrawWindow(_hWnd, nullptr, nullptr, RDW_ERASE | RDW_FRAME | RDW_INVALIDATE | RDW_ALLCHILDREN);
+	if (_borderStyle == WindowBorderStyle::SizableNoCaption)
+		_frame->Update();
+
+	UpdateSnapshot();
+	_deferEvents = false;
+
+	if (GeometryUpdate update; _geometry.Flush(&update))
+		DeliverGeometry(update);
+	QueueGeometry(false);
+
+	if (const auto currentState = GetWindowState(); currentState != previousState) {
+		PostEvent(EventType::WindowStateChanged, (int)currentState);
+		_windowState = currentState;
+	}
+}
+
+bool Window::IsBorderless(const WindowBorderStyle style) {
+	return style == WindowBorderStyle::SizableNoCaption || style == WindowBorderStyle::FixedNoCaption;
+}
+
+LONG_PTR Window::BuildStyle(const WindowBorderStyle borderStyle, const LONG_PTR style) const {
+	constexpr LONG_PTR frameBits = WS_OVERLAPPEDWINDOW | WS_POPUP;
+
+	auto newStyle = style;
+	if (borderStyle != WindowBorderStyle::None)
+		newStyle = (style & ~frameBits) | GetFrameStyle(IsBorderless(borderStyle));
+	if (IsBorderless(borderStyle))
+		return newStyle;
+
+	if (borderStyle == WindowBorderStyle::Fixed) newStyle &= ~WS_THICKFRAME;
+	if (_minimizeEnabled) newStyle |= WS_MINIMIZEBOX;
+	else                  newStyle &= ~WS_MINIMIZEBOX;
+	if (_maximizeEnabled) newStyle |= WS_MAXIMIZEBOX;
+	else                  newStyle &= ~WS_MAXIMIZEBOX;
+	return newStyle;
+}
+
+bool Window::UpdateCaptionButtons() {
+	if (_borderStyle == WindowBorderStyle::SizableNoCaption ||
+		_borderStyle == WindowBorderStyle::FixedNoCaption) {
+		return false;
+	}
+
+	const auto style = GetWindowLong(_hWnd, GWL_STYLE);
+	auto newStyle = style;
+	if (_minimizeEnabled) newStyle |= WS_MINIMIZEBOX;
+	else                  newStyle &= ~WS_MINIMIZEBOX;
+	if (_maximizeEnabled) newStyle |= WS_MAXIMIZEBOX;
+	else                  newStyle &= ~WS_MAXIMIZEBOX;
+
+	if (newStyle == style)
+		return false;
+
+	SetWindowLong(_hWnd, GWL_STYLE, newStyle);
+	return true;
+}
@@ -1,15 +1,11 @@
 #include "window_frame.h"
 #include "app.h"
 
-#include <map>
-
 using namespace Gluino;
 
 WNDPROC OriginalWndProc = nullptr;
 
-std::map<HWND, WindowEdge> StaticHandleToEdge;
-std::map<HWND, HWND> StaticHandleToWindowHandle;
-std::map<HWND, WindowFrame*> StaticHandleToFrame;
+HandleTable<WindowFrame::Edge> WindowFrame::EdgeRegistry;
 
 WindowFrame::WindowFrame(const HWND hWndWindow) {
 	_hWndWindow = hWndWindow;
@@ -34,11 +30,11 @@ void WindowFrame::Attach() {
 			App::GetHInstance(),
 			nullptr);
 
-		_hWndEdges.push_back(hWnd);
+		auto& entry = _edges[i];
+		entry = { this, edge, hWnd, 0 };
+		entry.RegistryHandle = EdgeRegistry.Add(&entry);
 
-		StaticHandleToEdge[hWnd] = edge;
-		StaticHandleToWindowHandle[hWnd] = _hWndWindow;
-		StaticHandleToFrame[hWnd] = this;
+		SetWindowLongPtr(hWnd, GWLP_USERDATA, (LONG_PTR)entry.RegistryHandle);
 		OriginalWndProc = (WNDPROC)SetWindowLongPtr(hWnd, GWLP_WNDPROC, (LONG_PTR)WndFrameProc);
 	}
 	_isAttached = true;
@@ -46,21 +42,19 @@ void WindowFrame::Attach() {
 
 void WindowFrame::Detach() {
 	if (!_isAttached) return;
-	for (const auto hWnd : _hWndEdges) {
-		StaticHandleToEdge.erase(hWnd);
-		StaticHandleToWindowHandle.erase(hWnd);
-		StaticHandleToFrame.erase(hWnd);
-
-		DestroyWindow(hWnd);
+	for (auto& edge : _edges) {
+		EdgeRegistry.Remove(edge.RegistryHandle);
+		DestroyWindow(edge.Handle);
+		edge = {};
 	}
 	_isAttached = false;
 }
 
 void WindowFrame::Update() const {
 	if (!_isAttached) return;
-	for (const auto& [hWnd, edge] : StaticHandleToEdge) {
-		auto [x, y, width, height] = GetEdgeRect(edge);
-		SetWindowPos(hWnd, nullptr, x, y, width, height, SWP_NOZORDER);
+	for (const auto& edge : _edges) {
+		auto [x, y, width, height] = GetEdgeRect(edge.Kind);
+		SetWindowPos(edge.Handle, nullptr, x, y, width, height, SWP_NOZORDER);
 	}
 }
 
@@ -146,17 +140,8 @@ LRESULT WindowFrame::WndFrameEdgeProc(HWND hWnd, WindowEdge edge, UINT msg, WPAR
 }
 
 LRESULT WindowFrame::WndFrameProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam) {
-	if (StaticHandleToWindowHandle.contains(hWnd)) {
-		if (StaticHandleToFrame.contains(hWnd)) {			
-			const auto frame = StaticHandleToFrame[hWnd];
-
-			if (StaticHandleToEdge.contains(hWnd)) {
-				const auto edge = StaticHandleToEdge[hWnd];
-				return frame->WndFrameEdgeProc(hWnd, edge, msg, wParam, lParam);
-			}			
-		}
-	}
+	if (const auto edge = EdgeRegistry.Get((HandleTable<Edge>::Handle)GetWindowLongPtr(hWnd, GWLP_USERDATA)))
+		return edge->Frame->WndFrameEdgeProc(hWnd, edge->Kind, msg, wParam, lParam);
 
 	return CallWindowProc(OriginalWndProc, hWnd, msg, wParam, lParam);
 }
-
@@ -0,0 +1,159 @@
+#include "plugin.h"
+
+#include <algorithm>
+#include <cctype>
+
+#ifdef _WIN32
+#include "common.h"
+
+#include <Windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+using namespace Gluino;
+
+// The loaded library and the handler it created. Blobs handed out by the plugin keep it
+// alive, so their release function is still mapped when the browser lets go of them after
+// the plugin itself has been destroyed.
+struct Plugin::Module {
+	void* Handle = nullptr;
+	GluinoPluginHandler Handler{};
+
+	~Module() {
+		if (Handler.Destroy)
+			Handler.Destroy(Handler.context);
+
+#ifdef _WIN32
+		if (Handle) FreeLibrary((HMODULE)Handle);
+#else
+		if (Handle) dlclose(Handle);
+#endif
+	}
+};
+
+struct GluinoPluginResponse {
+	ResourceResult* Result;
+	std::vector<char> Data;
+	std::shared_ptr<const ResourceBlob> Body;
+	std::shared_ptr<const void> Module;
+};
+
+namespace {
+
+class ExternalBlob final : public ResourceBlob {
+public:
+	ExternalBlob(const void* data, const size_t size, void (*release)(void*), void* context, std::shared_ptr<const void> module)
+		: _data((const char*)data), _size(size), _release(release), _context(context), _module(std::move(module)) {}
+	~ExternalBlob() override { if (_release) _release(_context); }
+
+	[[nodiscard]] const char* GetData() const override { return _data; }
+	[[nodiscard]] size_t GetSize() const override { return _size; }
+
+private:
+	const char* _data;
+	size_t _size;
+	void (*_release)(void*);
+	void* _context;
+	std::shared_ptr<const void> _module;
+};
+
+const GluinoPluginHost Host = {
+	sizeof(GluinoPluginHost),
+	GLUINO_PLUGIN_ABI_VERSION,
+	[](GluinoPluginResponse* response, const int statusCode) {
+		response->Result->StatusCode = statusCode;
+	},
+	[](GluinoPluginResponse* response, const char* contentType) {
+		response->Result->ContentType = contentType ? contentType : "";
+	},
+	[](GluinoPluginResponse* response, const char* name, const char* value) {
+		if (name && value) response->Result->Headers.emplace_back(name, value);
+	},
+	[](GluinoPluginResponse* response, const void* data, const size_t size) {
+		response->Body = nullptr;
+		response->Data.insert(response->Data.end(), (const char*)data, (const char*)data + size);
+	},
+	[](GluinoPluginResponse* response, const void* data, const size_t size, void (*release)(void*), void* context) {
+		response->Data.clear();
+		response->Body = std::make_shared<ExternalBlob>(data, size, release, context, response->Module);
+	},
+};
+
+bool HasHeader(const ResourceResult& result, const std::string_view name) {
+	return std::any_of(result.Headers.begin(), result.Headers.end(), [&](const auto& header) {
+		return header.first.size() == name.size() &&
+			std::equal(name.begin(), name.end(), header.first.begin(), [](const char a, const char b) {
+				return std::tolower((unsigned char)a) == std::tolower((unsigned char)b);
+			});
+	});
+}
+
+}
+
+Plugin::~Plugin() {
+	Detach();
+}
+
+std::unique_ptr<Plugin> Plugin::Load(const std::string& path, const std::string& options) {
+	std::unique_ptr<Plugin> plugin(new Plugin());
+	const auto module = plugin->_module = std::make_shared<Module>();
+
+#ifdef _WIN32
+	module->Handle = LoadLibraryW(ToWide(path).c_str());
+	if (!module->Handle)
+		return nullptr;
+	const auto create = (GluinoPluginCreateFn)GetProcAddress((HMODULE)module->Handle, GLUINO_PLUGIN_ENTRY_POINT);
+#else
+	module->Handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+	if (!module->Handle)
+		return nullptr;
+	const auto create = (GluinoPluginCreateFn)dlsym(module->Handle, GLUINO_PLUGIN_ENTRY_POINT);
+#endif
+
+	if (!create)
+		return nullptr;
+
+	GluinoPluginHandler handler{};
+	handler.size = sizeof(GluinoPluginHandler);
+	if (!create(&Host, options.c_str(), &handler))
+		return nullptr;
+
+	module->Handler = handler;
+	if (!handler.HandleRequest)
+		return nullptr;
+
+	return plugin;
+}
+
+bool Plugin::HandleRequest(const ResourceQuery& query, const std::string_view path, ResourceResult* result) {
+	const std::string pathStr(path);
+	const GluinoPluginRequest request{
+		sizeof(GluinoPluginRequest),
+		query.Url.c_str(),
+		pathStr.c_str(),
+		query.Method.c_str(),
+		query.Headers.c_str()
+	};
+
+	ResourceResult pluginResult;
+	GluinoPluginResponse response{ &pluginResult, {}, nullptr, _module };
+	const auto& handler = _module->Handler;
+	if (!handler.HandleRequest(handler.context, &request, &response))
+		return false;
+
+	auto body = response.Body
+		? std::move(response.Body)
+		: std::make_shared<MemoryBlob>(std::move(response.Data));
+
+	if (pluginResult.StatusCode == 200 && !HasHeader(pluginResult, "Content-Range")) {
+		SetResourceContent(query, std::move(body), &pluginResult);
+	}
+	else {
+		pluginResult.Length = body->GetSize();
+		pluginResult.Blob = std::move(body);
+	}
+
+	*result = std::move(pluginResult);
+	return true;
+}
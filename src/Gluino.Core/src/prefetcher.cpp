@@ -0,0 +1,118 @@
+#include "prefetcher.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+using namespace Gluino;
+
+// One set of workers for all webviews, so the thread count does not grow with the window count.
+class Prefetcher::Pool {
+public:
+	// Never destroyed: process exit must not wait for a worker.
+	static Pool& Get() {
+		static const auto pool = new Pool();
+		return *pool;
+	}
+
+	// Replaces the owner's prefetches that have not started yet.
+	void Enqueue(Prefetcher* owner, const std::vector<std::string>& urls) {
+		{
+			std::lock_guard lock(_mutex);
+			std::erase_if(_queue, [owner](const Job& job) { return job.Owner == owner; });
+			for (const auto& url : urls)
+				_queue.push_back({ owner, url });
+
+			const auto workerCount = std::clamp(std::thread::hardware_concurrency() / 2, 1u, MaxWorkers);
+			for (; _workerCount < std::min<size_t>(workerCount, _queue.size()); ++_workerCount)
+				std::thread(&Pool::Run, this).detach();
+		}
+		_cv.notify_all();
+	}
+
+	// Drops the owner's queued prefetches and waits for the ones already running.
+	void Cancel(const Prefetcher* owner) {
+		std::unique_lock lock(_mutex);
+		std::erase_if(_queue, [owner](const Job& job) { return job.Owner == owner; });
+		_doneCv.wait(lock, [&] { return std::find(_running.begin(), _running.end(), owner) == _running.end(); });
+	}
+
+private:
+	struct Job {
+		Prefetcher* Owner;
+		std::string Url;
+	};
+
+	std::mutex _mutex;
+	std::condition_variable _cv;
+	std::condition_variable _doneCv;
+	std::deque<Job> _queue;
+	std::vector<const Prefetcher*> _running;
+	size_t _workerCount = 0;
+
+	void Run() {
+		std::unique_lock lock(_mutex);
+		while (true) {
+			_cv.wait(lock, [this] { return !_queue.empty(); });
+
+			auto job = std::move(_queue.front());
+			_queue.pop_front();
+			_running.push_back(job.Owner);
+
+			lock.unlock();
+			job.Owner->_router->Prefetch(job.Url);
+			lock.lock();
+
+			_running.erase(std::find(_running.begin(), _running.end(), job.Owner));
+			_doneCv.notify_all();
+		}
+	}
+};
+
+Prefetcher::~Prefetcher() {
+	Pool::Get().Cancel(this);
+}
+
+void Prefetcher::SetManifest(const std::string& route, std::vector<std::string> urls) {
+	std::lock_guard lock(_mutex);
+	_manifests[route] = std::move(urls);
+}
+
+void Prefetcher::RemoveManifest(const std::string& route) {
+	std::lock_guard lock(_mutex);
+	_manifests.erase(route);
+}
+
+void Prefetcher::Prefetch(const std::string_view url) {
+	std::vector<std::string> urls;
+	{
+		std::lock_guard lock(_mutex);
+		const auto manifest = FindManifest(url.substr(0, url.find_first_of("?#")));
+		if (!manifest || manifest->empty())
+			return;
+		urls = *manifest;
+	}
+
+	Pool::Get().Enqueue(this, urls);
+}
+
+const std::vector<std::string>* Prefetcher::FindManifest(const std::string_view url) const {
+	if (const auto it = _manifests.find(std::string(url)); it != _manifests.end())
+		return &it->second;
+
+	const std::vector<std::string>* match = nullptr;
+	size_t matchLength = 0;
+	for (const auto& [route, urls] : _manifests) {
+		if (route.empty() || route.back() != '*')
+			continue;
+
+		const auto prefix = std::string_view(route).substr(0, route.size() - 1);
+		if (url.starts_with(prefix) && (!match || prefix.size() > matchLength)) {
+			match = &urls;
+			matchLength = prefix.size();
+		}
+	}
+
+	return match;
+}
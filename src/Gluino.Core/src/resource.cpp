@@ -0,0 +1,215 @@
+#include "resource.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <mutex>
+#include <random>
+
+using namespace Gluino;
+
+namespace {
+
+struct MimeEntry {
+	const char* Extension;
+	const char* MimeType;
+};
+
+constexpr MimeEntry MimeTypes[] = {
+	{ ".html", "text/html" },
+	{ ".htm", "text/html" },
+	{ ".css", "text/css" },
+	{ ".js", "text/javascript" },
+	{ ".mjs", "text/javascript" },
+	{ ".json", "application/json" },
+	{ ".map", "application/json" },
+	{ ".wasm", "application/wasm" },
+	{ ".png", "image/png" },
+	{ ".jpg", "image/jpeg" },
+	{ ".jpeg", "image/jpeg" },
+	{ ".gif", "image/gif" },
+	{ ".webp", "image/webp" },
+	{ ".svg", "image/svg+xml" },
+	{ ".ico", "image/x-icon" },
+	{ ".woff", "font/woff" },
+	{ ".woff2", "font/woff2" },
+	{ ".ttf", "font/ttf" },
+	{ ".otf", "font/otf" },
+	{ ".eot", "application/vnd.ms-fontobject" },
+	{ ".sfnt", "application/font-sfnt" },
+	{ ".mp4", "video/mp4" },
+	{ ".webm", "video/webm" },
+	{ ".mp3", "audio/mpeg" },
+	{ ".ogg", "audio/ogg" },
+	{ ".wav", "audio/wav" },
+	{ ".pdf", "application/pdf" },
+	{ ".xml", "text/xml" },
+	{ ".txt", "text/plain" },
+	{ ".log", "text/plain" },
+	{ ".csv", "text/csv" },
+};
+
+int HexValue(const char c) {
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+bool ParseRange(std::string_view range, const size_t size, size_t* first, size_t* last) {
+	constexpr std::string_view unit = "bytes=";
+	if (range.substr(0, unit.size()) != unit || size == 0)
+		return false;
+	range.remove_prefix(unit.size());
+	if (range.find(',') != std::string_view::npos)
+		return false;
+
+	const auto dash = range.find('-');
+	if (dash == std::string_view::npos)
+		return false;
+
+	const auto firstStr = range.substr(0, dash);
+	const auto lastStr = range.substr(dash + 1);
+	size_t a = 0, b = 0;
+
+	if (firstStr.empty()) {
+		if (std::from_chars(lastStr.data(), lastStr.data() + lastStr.size(), b).ec != std::errc() || b == 0)
+			return false;
+		*first = size - std::min(b, size);
+		*last = size - 1;
+		return true;
+	}
+
+	if (std::from_chars(firstStr.data(), firstStr.data() + firstStr.size(), a).ec != std::errc() || a >= size)
+		return false;
+	if (lastStr.empty()) {
+		b = size - 1;
+	}
+	else if (std::from_chars(lastStr.data(), lastStr.data() + lastStr.size(), b).ec != std::errc() || b < a) {
+		return false;
+	}
+
+	*first = a;
+	*last = std::min(b, size - 1);
+	return true;
+}
+
+}
+
+size_t ResourceBlob::Read(const size_t offset, char* buffer, const size_t count) const {
+	const auto size = GetSize();
+	if (offset >= size)
+		return 0;
+
+	const auto copied = std::min(count, size - offset);
+	memcpy(buffer, GetData() + offset, copied);
+	return copied;
+}
+
+std::string ResourceResult::GetHeaders() const {
+	std::string headers;
+	if (!ContentType.empty())
+		headers.append("Content-Type: ").append(ContentType).append("\r\n");
+	for (const auto& [name, value] : Headers)
+		headers.append(name).append(": ").append(value).append("\r\n");
+	return headers;
+}
+
+const char* Gluino::GetMimeType(const std::string_view path) {
+	const auto dot = path.rfind('.');
+	if (dot == std::string_view::npos)
+		return "application/octet-stream";
+
+	const auto ext = path.substr(dot);
+	for (const auto& [extension, mimeType] : MimeTypes) {
+		if (ext.size() == strlen(extension) &&
+			std::equal(ext.begin(), ext.end(), extension, [](const char a, const char b) {
+				return std::tolower((unsigned char)a) == b;
+			})) {
+			return mimeType;
+		}
+	}
+
+	return "application/octet-stream";
+}
+
+const char* Gluino::GetReasonPhrase(const int statusCode) {
+	switch (statusCode) {
+		case 200: return "OK";
+		case 204: return "No Content";
+		case 206: return "Partial Content";
+		case 304: return "Not Modified";
+		case 400: return "Bad Request";
+		case 403: return "Forbidden";
+		case 404: return "Not Found";
+		case 405: return "Method Not Allowed";
+		case 416: return "Range Not Satisfiable";
+		case 500: return "Internal Server Error";
+		default:  return "Unknown";
+	}
+}
+
+std::string Gluino::DecodeUrlPath(std::string_view path) {
+	if (const auto end = path.find_first_of("?#"); end != std::string_view::npos)
+		path = path.substr(0, end);
+
+	std::string result;
+	result.reserve(path.size());
+	for (size_t i = 0; i < path.size(); ++i) {
+		if (path[i] == '%' && i + 2 < path.size()) {
+			const auto hi = HexValue(path[i + 1]);
+			const auto lo = HexValue(path[i + 2]);
+			if (hi >= 0 && lo >= 0) {
+				result.push_back((char)(hi << 4 | lo));
+				i += 2;
+				continue;
+			}
+		}
+		result.push_back(path[i]);
+	}
+
+	return result;
+}
+
+std::string Gluino::GenerateToken(const size_t length) {
+	static std::mutex mutex;
+	static std::random_device device;
+
+	constexpr char digits[] = "0123456789abcdef";
+	std::string token(length, '0');
+
+	std::lock_guard lock(mutex);
+	for (size_t i = 0; i < length; i += 8) {
+		auto value = device();
+		for (size_t j = i; j < std::min(i + 8, length); ++j, value >>= 4)
+			token[j] = digits[value & 0xF];
+	}
+	return token;
+}
+
+void Gluino::SetResourceContent(const ResourceQuery& query, std::shared_ptr<const ResourceBlob> blob, ResourceResult* result) {
+	const auto size = blob ? blob->GetSize() : 0;
+
+	result->Blob = std::move(blob);
+	result->Offset = 0;
+	result->Length = size;
+	result->Headers.emplace_back("Accept-Ranges", "bytes");
+
+	if (query.Range.empty())
+		return;
+
+	size_t first, last;
+	if (!ParseRange(query.Range, size, &first, &last)) {
+		result->StatusCode = 416;
+		result->Length = 0;
+		result->Headers.emplace_back("Content-Range", "bytes */" + std::to_string(size));
+		return;
+	}
+
+	result->StatusCode = 206;
+	result->Offset = first;
+	result->Length = last - first + 1;
+	result->Headers.emplace_back("Content-Range",
+		"bytes " + std::to_string(first) + "-" + std::to_string(last) + "/" + std::to_string(size));
+}
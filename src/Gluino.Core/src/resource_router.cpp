@@ -0,0 +1,110 @@
+#include "resource_router.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+using namespace Gluino;
+
+namespace {
+
+// Guards every handler's list of routers. Taken before a router's own lock, never while
+// routing, so routing only ever contends on the router it goes through.
+std::mutex linkMutex;
+
+}
+
+// Detaching here would be too late: a router could still be routing into the derived handler,
+// whose members are already gone. Every handler detaches in its own destructor instead.
+ResourceHandler::~ResourceHandler() {
+	assert(_routers.empty());
+}
+
+void ResourceHandler::Detach() {
+	std::lock_guard links(linkMutex);
+	for (const auto router : std::exchange(_routers, {})) {
+		std::unique_lock lock(router->_mutex);
+		std::erase_if(router->_mounts, [&](const auto& mount) { return mount.Handler == this; });
+	}
+}
+
+ResourceRouter::~ResourceRouter() {
+	std::lock_guard links(linkMutex);
+	for (const auto& mount : _mounts)
+		Unlink(mount);
+}
+
+void ResourceRouter::Unlink(const MountPoint& mount) {
+	auto& routers = mount.Handler->_routers;
+	if (const auto it = std::find(routers.begin(), routers.end(), this); it != routers.end())
+		routers.erase(it);
+}
+
+void ResourceRouter::Mount(const std::string& prefix, ResourceHandler* handler) {
+	std::lock_guard links(linkMutex);
+	std::unique_lock lock(_mutex);
+
+	std::erase_if(_mounts, [&](const auto& mount) {
+		if (mount.Prefix != prefix)
+			return false;
+		Unlink(mount);
+		return true;
+	});
+	_mounts.push_back({ prefix, handler });
+	handler->_routers.push_back(this);
+
+	std::stable_sort(_mounts.begin(), _mounts.end(), [](const auto& a, const auto& b) {
+		return a.Prefix.size() > b.Prefix.size();
+	});
+}
+
+void ResourceRouter::Unmount(const std::string& prefix) {
+	std::lock_guard links(linkMutex);
+	std::unique_lock lock(_mutex);
+	std::erase_if(_mounts, [&](const auto& mount) {
+		if (mount.Prefix != prefix)
+			return false;
+		Unlink(mount);
+		return true;
+	});
+}
+
+void ResourceRouter::Unmount(const ResourceHandler* handler) {
+	std::lock_guard links(linkMutex);
+	std::unique_lock lock(_mutex);
+	std::erase_if(_mounts, [&](const auto& mount) {
+		if (mount.Handler != handler)
+			return false;
+		Unlink(mount);
+		return true;
+	});
+}
+
+bool ResourceRouter::Route(const ResourceQuery& query, ResourceResult* result) {
+	std::shared_lock lock(_mutex);
+
+	for (const auto& [prefix, handler] : _mounts) {
+		if (query.Url.compare(0, prefix.size(), prefix) != 0)
+			continue;
+
+		const auto path = DecodeUrlPath(std::string_view(query.Url).substr(prefix.size()));
+		if (handler->HandleRequest(query, path, result))
+			return true;
+	}
+
+	return false;
+}
+
+bool ResourceRouter::Prefetch(const std::string_view url) {
+	std::shared_lock lock(_mutex);
+
+	for (const auto& [prefix, handler] : _mounts) {
+		if (url.compare(0, prefix.size(), prefix) != 0)
+			continue;
+
+		if (handler->Prefetch(DecodeUrlPath(url.substr(prefix.size()))))
+			return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,373 @@
+#include "single_instance.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+#include "common.h"
+
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace Gluino;
+
+namespace {
+
+void AppendSize(std::string* data, const uint32_t value) {
+	for (auto i = 0; i < 4; ++i)
+		data->push_back((char)(value >> i * 8 & 0xFF));
+}
+
+bool ReadSize(const std::string& data, size_t* offset, uint32_t* value) {
+	if (data.size() - *offset < 4)
+		return false;
+
+	*value = 0;
+	for (auto i = 0; i < 4; ++i)
+		*value |= (uint32_t)(unsigned char)data[*offset + i] << i * 8;
+	*offset += 4;
+	return true;
+}
+
+std::string GetEndpointName(const std::string& name) {
+	std::string endpoint = "gluino.";
+	for (const char c : name)
+		endpoint.push_back(c == '/' || c == '\\' ? '_' : c);
+	return endpoint;
+}
+
+#ifdef _WIN32
+
+std::wstring GetPipeName(const std::string& name) {
+	// Pipes are machine-wide; the session keeps users that are logged on at the same time apart.
+	DWORD sessionId = 0;
+	ProcessIdToSessionId(GetCurrentProcessId(), &sessionId);
+	return L"\\\\.\\pipe\\" + ToWide(GetEndpointName(name)) + L"." + std::to_wstring(sessionId);
+}
+
+// Waits for an overlapped operation, cancelling it if the stop event is set or the timeout elapses.
+bool CompleteIo(const HANDLE hPipe, OVERLAPPED* overlapped, const HANDLE hStop, const DWORD timeout, DWORD* transferred) {
+	const HANDLE handles[] = { overlapped->hEvent, hStop };
+	if (WaitForMultipleObjects(2, handles, FALSE, timeout) != WAIT_OBJECT_0) {
+		CancelIoEx(hPipe, overlapped);
+		GetOverlappedResult(hPipe, overlapped, transferred, TRUE);
+		return false;
+	}
+	return GetOverlappedResult(hPipe, overlapped, transferred, FALSE);
+}
+
+#else
+
+// Linux uses the abstract namespace, which needs no cleanup; elsewhere the socket is a file
+// in the temporary directory.
+socklen_t GetAddress(const std::string& name, sockaddr_un* address, std::string* path) {
+	auto endpoint = GetEndpointName(name) + "." + std::to_string(getuid());
+	if (endpoint.size() > sizeof address->sun_path - 16)
+		endpoint = "gluino." + std::to_string(std::hash<std::string>()(endpoint));
+
+	*address = {};
+	address->sun_family = AF_UNIX;
+#ifdef __linux__
+	memcpy(address->sun_path + 1, endpoint.data(), endpoint.size());
+	path->clear();
+	return (socklen_t)(offsetof(sockaddr_un, sun_path) + 1 + endpoint.size());
+#else
+	const auto tmp = getenv("TMPDIR");
+	*path = std::string(tmp && *tmp ? tmp : "/tmp") + "/" + endpoint;
+	if (path->size() >= sizeof address->sun_path)
+		*path = "/tmp/" + endpoint;
+	memcpy(address->sun_path, path->data(), path->size());
+	return (socklen_t)(offsetof(sockaddr_un, sun_path) + path->size() + 1);
+#endif
+}
+
+int CreateSocket() {
+	const auto fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd >= 0)
+		fcntl(fd, F_SETFD, FD_CLOEXEC);
+	return fd;
+}
+
+// Both ends must belong to the same user; abstract sockets are visible to every user.
+bool IsSameUser(const int fd) {
+#ifdef __linux__
+	ucred credentials{};
+	socklen_t length = sizeof credentials;
+	return getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &length) == 0 && credentials.uid == getuid();
+#else
+	uid_t uid;
+	gid_t gid;
+	return getpeereid(fd, &uid, &gid) == 0 && uid == getuid();
+#endif
+}
+
+bool WriteAll(const int fd, const std::string& data) {
+#ifdef MSG_NOSIGNAL
+	constexpr int flags = MSG_NOSIGNAL;
+#else
+	constexpr int flags = 0;
+#endif
+	for (size_t offset = 0; offset < data.size();) {
+		const auto written = send(fd, data.data() + offset, data.size() - offset, flags);
+		if (written < 0 && errno == EINTR)
+			continue;
+		if (written <= 0)
+			return false;
+		offset += (size_t)written;
+	}
+	return true;
+}
+
+#endif
+
+}
+
+SingleInstance::SingleInstance(std::string name, ArgumentsCallback callback)
+	: _name(std::move(name)), _callback(std::move(callback)) {}
+
+SingleInstance::~SingleInstance() {
+	Stop();
+}
+
+bool SingleInstance::Acquire(const std::vector<std::string>& args) {
+	const auto message = Encode(args);
+
+	// Another launch may claim the name between a failed connect and a failed listen.
+	for (auto attempt = 0; attempt < 3; ++attempt) {
+		if (Forward(message))
+			return false;
+		if (Listen())
+			return true;
+	}
+	return true;
+}
+
+void SingleInstance::Stop() {
+	if (_running.exchange(false)) {
+		_stop.Signal();
+		_thread.join();
+	}
+
+#ifdef _WIN32
+	if (_hPipe) CloseHandle(_hPipe);
+	_hPipe = nullptr;
+#else
+	if (_fd >= 0) close(_fd);
+	_fd = -1;
+	if (!_path.empty()) unlink(_path.c_str());
+	_path.clear();
+#endif
+}
+
+std::string SingleInstance::Encode(const std::vector<std::string>& args) {
+	std::string data;
+	AppendSize(&data, (uint32_t)args.size());
+	for (const auto& arg : args) {
+		AppendSize(&data, (uint32_t)arg.size());
+		data.append(arg);
+	}
+	return data;
+}
+
+bool SingleInstance::Decode(const std::string& data, std::vector<std::string>* args) {
+	size_t offset = 0;
+	uint32_t count;
+	if (!ReadSize(data, &offset, &count) || count > data.size() / 4)
+		return false;
+
+	args->clear();
+	args->reserve(count);
+	for (uint32_t i = 0; i < count; ++i) {
+		uint32_t length;
+		if (!ReadSize(data, &offset, &length) || data.size() - offset < length)
+			return false;
+		args->emplace_back(data, offset, length);
+		offset += length;
+	}
+	return offset == data.size();
+}
+
+#ifdef _WIN32
+
+bool SingleInstance::Listen() {
+	if (_running) return true;
+
+	_hPipe = CreateNamedPipeW(GetPipeName(_name).c_str(),
+		PIPE_ACCESS_INBOUND | FILE_FLAG_FIRST_PIPE_INSTANCE | FILE_FLAG_OVERLAPPED,
+		PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+		1, 0, 64 * 1024, 0, nullptr);
+	if (_hPipe == INVALID_HANDLE_VALUE) {
+		_hPipe = nullptr;
+		return false;
+	}
+
+	_running = true;
+	_thread = std::thread(&SingleInstance::Run, this);
+	return true;
+}
+
+bool SingleInstance::Forward(const std::string& message) const {
+	const auto pipeName = GetPipeName(_name);
+	const auto deadline = std::chrono::steady_clock::now() + ConnectTimeout;
+
+	HANDLE hPipe;
+	while ((hPipe = CreateFileW(pipeName.c_str(), GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, 0, nullptr)) == INVALID_HANDLE_VALUE) {
+		// Busy while the primary instance is reading another launch's arguments.
+		const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+		if (GetLastError() != ERROR_PIPE_BUSY || remaining <= 0)
+			return false;
+		WaitNamedPipeW(pipeName.c_str(), (DWORD)remaining);
+	}
+
+	DWORD written = 0;
+	const auto result = WriteFile(hPipe, message.data(), (DWORD)message.size(), &written, nullptr) && written == message.size();
+	CloseHandle(hPipe);
+	return result;
+}
+
+void SingleInstance::Run() {
+	const auto hStop = (HANDLE)_stop.GetNative();
+	OVERLAPPED overlapped{};
+	overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+	while (_running) {
+		DWORD transferred;
+		ResetEvent(overlapped.hEvent);
+		if (!ConnectNamedPipe(_hPipe, &overlapped)) {
+			const auto error = GetLastError();
+			if (error == ERROR_IO_PENDING) {
+				if (!CompleteIo(_hPipe, &overlapped, hStop, INFINITE, &transferred))
+					continue;
+			}
+			else if (error != ERROR_PIPE_CONNECTED) {
+				break;
+			}
+		}
+
+		std::string message;
+		char buffer[4096];
+		for (;;) {
+			ResetEvent(overlapped.hEvent);
+			if (!ReadFile(_hPipe, buffer, sizeof buffer, &transferred, &overlapped) &&
+				(GetLastError() != ERROR_IO_PENDING ||
+				 !CompleteIo(_hPipe, &overlapped, hStop, (DWORD)ConnectTimeout.count(), &transferred)))
+				break;
+
+			message.append(buffer, transferred);
+			if (message.size() > MaxMessageSize)
+				break;
+		}
+		DisconnectNamedPipe(_hPipe);
+
+		if (std::vector<std::string> args; _running && Decode(message, &args))
+			_callback(std::move(args));
+	}
+
+	CloseHandle(overlapped.hEvent);
+}
+
+#else
+
+bool SingleInstance::Listen() {
+	if (_running) return true;
+
+	sockaddr_un address;
+	std::string path;
+	const auto length = GetAddress(_name, &address, &path);
+
+	_fd = CreateSocket();
+	if (_fd < 0)
+		return false;
+
+	auto bound = bind(_fd, (const sockaddr*)&address, length) == 0;
+	if (!bound && errno == EADDRINUSE && !path.empty()) {
+		// A socket file left behind by an instance that crashed refuses connections.
+		if (const auto probe = CreateSocket(); probe >= 0) {
+			const auto stale = connect(probe, (const sockaddr*)&address, length) != 0 && errno == ECONNREFUSED;
+			close(probe);
+			if (stale && unlink(path.c_str()) == 0)
+				bound = bind(_fd, (const sockaddr*)&address, length) == 0;
+		}
+	}
+
+	if (!bound || listen(_fd, 16) != 0) {
+		close(_fd);
+		_fd = -1;
+		return false;
+	}
+
+	_path = path;
+	_running = true;
+	_thread = std::thread(&SingleInstance::Run, this);
+	return true;
+}
+
+bool SingleInstance::Forward(const std::string& message) const {
+	sockaddr_un address;
+	std::string path;
+	const auto length = GetAddress(_name, &address, &path);
+
+	const auto fd = CreateSocket();
+	if (fd < 0)
+		return false;
+
+	const auto result =
+		connect(fd, (const sockaddr*)&address, length) == 0 &&
+		IsSameUser(fd) &&
+		WriteAll(fd, message);
+	close(fd);
+	return result;
+}
+
+void SingleInstance::Run() {
+	const auto stopFd = (int)_stop.GetNative();
+	pollfd fds[] = { { _fd, POLLIN, 0 }, { stopFd, POLLIN, 0 } };
+
+	while (_running) {
+		if (poll(fds, 2, -1) < 0) {
+			if (errno == EINTR) continue;
+			break;
+		}
+		if (fds[1].revents)
+			break;
+		if (!(fds[0].revents & POLLIN))
+			continue;
+
+		const auto client = accept(_fd, nullptr, nullptr);
+		if (client < 0)
+			continue;
+		if (!IsSameUser(client)) {
+			close(client);
+			continue;
+		}
+
+		std::string message;
+		char buffer[4096];
+		pollfd clientFds[] = { { client, POLLIN, 0 }, { stopFd, POLLIN, 0 } };
+		while (poll(clientFds, 2, (int)ConnectTimeout.count()) > 0 && !clientFds[1].revents) {
+			const auto received = read(client, buffer, sizeof buffer);
+			if (received < 0 && errno == EINTR)
+				continue;
+			if (received <= 0)
+				break;
+
+			message.append(buffer, (size_t)received);
+			if (message.size() > MaxMessageSize)
+				break;
+		}
+		close(client);
+
+		if (std::vector<std::string> args; _running && Decode(message, &args))
+			_callback(std::move(args));
+	}
+}
+
+#endif
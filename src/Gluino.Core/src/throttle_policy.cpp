@@ -0,0 +1,58 @@
+#include "throttle_policy.h"
+
+using namespace Gluino;
+
+void ThrottlePolicy::SetEnabled(const bool enabled, const Clock::time_point now) {
+	const auto wasBackground = IsBackground();
+	_enabled = enabled;
+	Evaluate(wasBackground, now);
+}
+
+void ThrottlePolicy::SetSuspendDelay(const Clock::duration delay, const Clock::time_point now) {
+	_suspendDelay = delay;
+
+	// Takes effect for a window that is already in the background: disabling the delay wakes a
+	// suspended browser and a shorter one may suspend it right away.
+	if (_level == ThrottleLevel::Suspended && _suspendDelay < Clock::duration::zero())
+		_level = ThrottleLevel::Throttled;
+	Update(now);
+}
+
+ThrottleLevel ThrottlePolicy::SetVisible(const bool visible, const Clock::time_point now) {
+	const auto wasBackground = IsBackground();
+	_visible = visible;
+	return Evaluate(wasBackground, now);
+}
+
+ThrottleLevel ThrottlePolicy::SetMinimized(const bool minimized, const Clock::time_point now) {
+	const auto wasBackground = IsBackground();
+	_minimized = minimized;
+	return Evaluate(wasBackground, now);
+}
+
+ThrottleLevel ThrottlePolicy::Update(const Clock::time_point now) {
+	if (const auto deadline = GetDeadline(); deadline && now >= *deadline)
+		_level = ThrottleLevel::Suspended;
+	return _level;
+}
+
+std::optional<ThrottlePolicy::Clock::time_point> ThrottlePolicy::GetDeadline() const {
+	if (_level != ThrottleLevel::Throttled || _suspendDelay < Clock::duration::zero())
+		return std::nullopt;
+	return _backgroundSince + _suspendDelay;
+}
+
+ThrottleLevel ThrottlePolicy::Evaluate(const bool wasBackground, const Clock::time_point now) {
+	const auto background = IsBackground();
+	if (!background) {
+		_level = ThrottleLevel::Active;
+		return _level;
+	}
+
+	// Hiding a minimized window, or the reverse, keeps the time it went to the background.
+	if (!wasBackground) {
+		_backgroundSince = now;
+		_level = ThrottleLevel::Throttled;
+	}
+	return Update(now);
+}
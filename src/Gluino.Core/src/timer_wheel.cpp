@@ -0,0 +1,269 @@
+#include "timer_wheel.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace Gluino;
+
+TimerWheel::TimerWheel() : _origin(Clock::now()) {}
+
+int TimerWheel::Schedule(const Clock::duration due, Callback callback, const Clock::duration period, const void* owner) {
+	int id;
+	bool wake;
+	{
+		std::lock_guard lock(_mutex);
+		const auto now = std::max(ToTicks(Clock::now()), _current);
+		const auto expiry = ApplySlack(std::max(now + ToTicks(due), _current + 1));
+
+		id = _nextId++;
+		const auto suspended = owner && _suspendedOwners.contains(owner);
+		_timers.emplace(id, Timer{ expiry, period > Clock::duration::zero() ? std::max<uint64_t>(ToTicks(period), 1) : 0, std::move(callback), owner, suspended });
+		if (suspended)
+			return id;
+
+		Insert(id, expiry);
+		wake = expiry < _armedExpiry;
+		if (wake)
+			_armedExpiry = expiry;
+	}
+
+	if (wake && _wake)
+		_wake();
+	return id;
+}
+
+bool TimerWheel::Cancel(const int id) {
+	std::lock_guard lock(_mutex);
+	return _timers.erase(id) > 0;
+}
+
+void TimerWheel::CancelAll(const void* owner) {
+	std::lock_guard lock(_mutex);
+	std::erase_if(_timers, [owner](const auto& timer) { return timer.second.Owner == owner; });
+	_suspendedOwners.erase(owner);
+}
+
+void TimerWheel::Suspend(const void* owner) {
+	std::lock_guard lock(_mutex);
+	if (!_suspendedOwners.insert(owner).second)
+		return;
+
+	auto any = false;
+	for (auto& [id, timer] : _timers) {
+		if (timer.Owner == owner) {
+			timer.Suspended = true;
+			any = true;
+		}
+	}
+	if (!any)
+		return;
+
+	// Drop the slot entries so a timer resumed at its old deadline is not filed twice.
+	for (auto& level : _slots) {
+		for (auto& slot : level) {
+			std::erase_if(slot, [this](const SlotEntry& entry) {
+				const auto it = _timers.find(entry.Id);
+				return it != _timers.end() && it->second.Suspended;
+			});
+		}
+	}
+}
+
+void TimerWheel::Resume(const void* owner) {
+	bool wake = false;
+	{
+		std::lock_guard lock(_mutex);
+		if (_suspendedOwners.erase(owner) == 0)
+			return;
+
+		const auto now = std::max(ToTicks(Clock::now()), _current);
+		for (auto& [id, timer] : _timers) {
+			if (timer.Owner != owner || !timer.Suspended)
+				continue;
+
+			// Periods missed while suspended collapse into a single run on the next tick.
+			timer.Suspended = false;
+			timer.Expiry = ApplySlack(std::max(timer.Expiry, now + 1));
+			Insert(id, timer.Expiry);
+
+			if (timer.Expiry < _armedExpiry) {
+				_armedExpiry = timer.Expiry;
+				wake = true;
+			}
+		}
+	}
+
+	if (wake && _wake)
+		_wake();
+}
+
+size_t TimerWheel::Advance(const Clock::time_point now) {
+	std::vector<int> due;
+	{
+		std::lock_guard lock(_mutex);
+		_armedExpiry = 0;
+
+		// Round down so that a timer never fires before its deadline.
+		const auto target = now <= _origin ? 0 : (uint64_t)((now - _origin) / Resolution);
+		if (_timers.empty()) {
+			_current = std::max(_current, target);
+			return 0;
+		}
+
+		// After a long idle gap, jump straight to the tick before the next expiry instead of
+		// stepping through every empty slot, and re-file the timers relative to the new tick.
+		if (target - std::min(target, _current) > SlotCount * SlotCount) {
+			if (const auto next = FindNextExpiry(); next && *next > _current + 1) {
+				_current = std::min(target, *next - 1);
+				Rebuild();
+			}
+		}
+
+		while (_current < target) {
+			++_current;
+
+			// Higher levels first: each one may refill the slot of the level below it.
+			auto level = 0;
+			while (level + 1 < Levels && (_current & ((1ull << (LevelBits * (level + 1))) - 1)) == 0)
+				++level;
+			for (; level > 0; --level)
+				Cascade(level);
+
+			std::vector<SlotEntry> entries;
+			entries.swap(_slots[0][_current & SlotMask]);
+			for (const auto& entry : entries) {
+				const auto it = _timers.find(entry.Id);
+				if (it == _timers.end() || it->second.Expiry != entry.Expiry)
+					continue;
+				if (entry.Expiry <= _current)
+					due.push_back(entry.Id);
+				else
+					Insert(entry.Id, entry.Expiry);
+			}
+		}
+	}
+
+	size_t fired = 0;
+	for (const auto id : due) {
+		Callback callback;
+		{
+			std::lock_guard lock(_mutex);
+			const auto it = _timers.find(id);
+			if (it == _timers.end() || it->second.Suspended)
+				continue;
+
+			if (auto& timer = it->second; timer.Period > 0) {
+				callback = timer.Run;
+				timer.Expiry = ApplySlack(std::max(timer.Expiry + timer.Period, _current + 1));
+				Insert(id, timer.Expiry);
+			}
+			else {
+				callback = std::move(timer.Run);
+				_timers.erase(it);
+			}
+		}
+
+		callback();
+		++fired;
+	}
+
+	return fired;
+}
+
+std::optional<TimerWheel::Clock::time_point> TimerWheel::GetNextDeadline() {
+	std::lock_guard lock(_mutex);
+	const auto expiry = FindNextExpiry();
+	_armedExpiry = expiry.value_or(std::numeric_limits<uint64_t>::max());
+	if (!expiry)
+		return std::nullopt;
+	return _origin + Resolution * (int64_t)*expiry;
+}
+
+size_t TimerWheel::GetCount() {
+	std::lock_guard lock(_mutex);
+	return _timers.size();
+}
+
+void TimerWheel::SetSlack(const Clock::duration slack) {
+	std::lock_guard lock(_mutex);
+	_slack = std::max<uint64_t>(ToTicks(slack), 1);
+}
+
+TimerWheel::Clock::duration TimerWheel::GetSlack() {
+	std::lock_guard lock(_mutex);
+	return Resolution * (int64_t)_slack;
+}
+
+uint64_t TimerWheel::ToTicks(const Clock::time_point time) const {
+	return time <= _origin ? 0 : ToTicks(time - _origin);
+}
+
+uint64_t TimerWheel::ToTicks(const Clock::duration duration) const {
+	return duration <= Clock::duration::zero() ? 0 : (uint64_t)((duration + Resolution - Clock::duration(1)) / Resolution);
+}
+
+uint64_t TimerWheel::ApplySlack(const uint64_t expiry) const {
+	return (expiry + _slack - 1) / _slack * _slack;
+}
+
+void TimerWheel::Insert(const int id, const uint64_t expiry) {
+	if (expiry <= _current) {
+		// Only reachable while cascading into the tick being processed.
+		_slots[0][_current & SlotMask].push_back({ id, expiry });
+		return;
+	}
+
+	constexpr auto range = 1ull << (LevelBits * Levels);
+	const auto delta = expiry - _current;
+	const auto position = delta < range ? expiry : _current + range - 1;
+
+	auto level = 0;
+	while (level + 1 < Levels && delta >= 1ull << (LevelBits * (level + 1)))
+		++level;
+
+	_slots[level][(position >> (LevelBits * level)) & SlotMask].push_back({ id, expiry });
+}
+
+void TimerWheel::Cascade(const int level) {
+	std::vector<SlotEntry> entries;
+	entries.swap(_slots[level][(_current >> (LevelBits * level)) & SlotMask]);
+	for (const auto& entry : entries) {
+		if (const auto it = _timers.find(entry.Id); it != _timers.end() && it->second.Expiry == entry.Expiry)
+			Insert(entry.Id, entry.Expiry);
+	}
+}
+
+void TimerWheel::Rebuild() {
+	for (auto& level : _slots) {
+		for (auto& slot : level)
+			slot.clear();
+	}
+	for (const auto& [id, timer] : _timers) {
+		if (!timer.Suspended)
+			Insert(id, timer.Expiry);
+	}
+}
+
+std::optional<uint64_t> TimerWheel::FindNextExpiry() const {
+	std::optional<uint64_t> next;
+
+	for (auto level = 0; level < Levels; ++level) {
+		const auto shift = LevelBits * level;
+		for (uint64_t i = 1; i <= SlotCount; ++i) {
+			const auto& slot = _slots[level][((_current >> shift) + i) & SlotMask];
+
+			std::optional<uint64_t> slotNext;
+			for (const auto& entry : slot) {
+				if (const auto it = _timers.find(entry.Id); it != _timers.end() && it->second.Expiry == entry.Expiry)
+					slotNext = std::min(slotNext.value_or(entry.Expiry), entry.Expiry);
+			}
+
+			if (slotNext) {
+				next = std::min(next.value_or(*slotNext), *slotNext);
+				break;
+			}
+		}
+	}
+
+	return next;
+}
@@ -0,0 +1,426 @@
+#include "vfs.h"
+#include "hot_reload.h"
+#include "inflate.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace Gluino;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr size_t StreamedReadThreshold = 1024 * 1024;
+constexpr char PackMagic[4] = { 'G', 'L', 'P', 'K' };
+constexpr uint32_t PackVersion = 1;
+
+fs::path ToPath(const std::string& path) {
+	return fs::path(std::u8string_view((const char8_t*)path.data(), path.size()));
+}
+
+std::string FromPath(const fs::path& path) {
+	const auto str = path.generic_u8string();
+	return { (const char*)str.data(), str.size() };
+}
+
+// The root's own path elements, without the empty one a trailing separator leaves.
+bool IsWithin(const fs::path& root, const fs::path& path) {
+	const auto base = root.has_filename() ? root : root.parent_path();
+	return std::mismatch(base.begin(), base.end(), path.begin(), path.end()).first == base.end();
+}
+
+template<typename T>
+bool ReadValue(const char* data, const size_t size, const size_t offset, T* value) {
+	if (offset > size || size - offset < sizeof(T))
+		return false;
+	memcpy(value, data + offset, sizeof(T));
+	return true;
+}
+
+template<typename T>
+void WriteValue(std::ofstream& stream, const T value) {
+	stream.write((const char*)&value, sizeof(T));
+}
+
+}
+
+DirectoryLayer::DirectoryLayer(std::string root) : _root(std::move(root)) {}
+
+std::shared_ptr<const ResourceBlob> DirectoryLayer::Open(const std::string& path) {
+#ifdef _WIN32
+	// A drive or stream name in any segment would make the join below replace the root.
+	if (path.find(':') != std::string::npos)
+		return nullptr;
+#endif
+
+	const auto relative = ToPath(path);
+	if (relative.has_root_name() || relative.has_root_directory())
+		return nullptr;
+
+	const auto root = ToPath(_root).lexically_normal();
+	const auto fullPath = (root / relative).lexically_normal();
+	if (!IsWithin(root, fullPath))
+		return nullptr;
+
+	std::error_code ec;
+	const auto size = fs::file_size(fullPath, ec);
+	if (ec || !fs::is_regular_file(fullPath, ec))
+		return nullptr;
+
+	// Large files are read as they are served; directory files are edited while the app runs.
+	if (size >= StreamedReadThreshold)
+		return FileBlob::Open(FromPath(fullPath));
+
+	std::ifstream stream(fullPath, std::ios::binary);
+	if (!stream)
+		return nullptr;
+
+	std::vector<char> data((size_t)size);
+	if (!stream.read(data.data(), (std::streamsize)size))
+		return nullptr;
+
+	return std::make_shared<MemoryBlob>(std::move(data));
+}
+
+std::unique_ptr<ZipLayer> ZipLayer::Load(std::shared_ptr<MappedFile> file) {
+	if (!file)
+		return nullptr;
+
+	const auto data = file->GetData();
+	const auto size = file->GetSize();
+	if (size < 22)
+		return nullptr;
+
+	size_t eocd = size - 22;
+	const size_t searchEnd = size > 0xFFFF + 22 ? size - 0xFFFF - 22 : 0;
+	for (;; --eocd) {
+		uint32_t signature;
+		if (ReadValue(data, size, eocd, &signature) && signature == 0x06054b50)
+			break;
+		if (eocd == searchEnd)
+			return nullptr;
+	}
+
+	uint16_t entryCount;
+	uint32_t directoryOffset;
+	if (!ReadValue(data, size, eocd + 10, &entryCount) ||
+		!ReadValue(data, size, eocd + 16, &directoryOffset))
+		return nullptr;
+
+	std::unique_ptr<ZipLayer> layer(new ZipLayer(std::move(file)));
+	layer->_entries.reserve(entryCount);
+
+	size_t offset = directoryOffset;
+	for (uint16_t i = 0; i < entryCount; ++i) {
+		uint32_t signature, compressedSize, uncompressedSize, localOffset;
+		uint16_t method, nameLength, extraLength, commentLength;
+		if (!ReadValue(data, size, offset, &signature) || signature != 0x02014b50 ||
+			!ReadValue(data, size, offset + 10, &method) ||
+			!ReadValue(data, size, offset + 20, &compressedSize) ||
+			!ReadValue(data, size, offset + 24, &uncompressedSize) ||
+			!ReadValue(data, size, offset + 28, &nameLength) ||
+			!ReadValue(data, size, offset + 30, &extraLength) ||
+			!ReadValue(data, size, offset + 32, &commentLength) ||
+			!ReadValue(data, size, offset + 42, &localOffset) ||
+			offset + 46 + nameLength > size)
+			return nullptr;
+
+		std::string name(data + offset + 46, nameLength);
+		offset += 46 + nameLength + extraLength + commentLength;
+
+		if (name.empty() || name.back() == '/')
+			continue;
+
+		uint16_t localNameLength, localExtraLength;
+		if (!ReadValue(data, size, localOffset + 26, &localNameLength) ||
+			!ReadValue(data, size, localOffset + 28, &localExtraLength))
+			return nullptr;
+
+		const size_t dataOffset = (size_t)localOffset + 30 + localNameLength + localExtraLength;
+		if (dataOffset > size || size - dataOffset < compressedSize)
+			return nullptr;
+
+		layer->_entries[Vfs::NormalizePath(name)] = { dataOffset, compressedSize, uncompressedSize, method };
+	}
+
+	return layer;
+}
+
+std::shared_ptr<const ResourceBlob> ZipLayer::Open(const std::string& path) {
+	const auto it = _entries.find(path);
+	if (it == _entries.end())
+		return nullptr;
+
+	const auto& [offset, compressedSize, size, method] = it->second;
+	if (method == 0)
+		return std::make_shared<MappedBlob>(_file, offset, size);
+
+	if (method == 8) {
+		std::vector<char> data;
+		if (!Inflate(_file->GetData() + offset, compressedSize, size, &data))
+			return nullptr;
+		return std::make_shared<MemoryBlob>(std::move(data));
+	}
+
+	return nullptr;
+}
+
+std::unique_ptr<PackLayer> PackLayer::Load(std::shared_ptr<MappedFile> file) {
+	if (!file)
+		return nullptr;
+
+	const auto data = file->GetData();
+	const auto size = file->GetSize();
+
+	uint32_t version, count;
+	if (size < 12 || memcmp(data, PackMagic, 4) != 0 ||
+		!ReadValue(data, size, 4, &version) || version != PackVersion ||
+		!ReadValue(data, size, 8, &count))
+		return nullptr;
+
+	std::unique_ptr<PackLayer> layer(new PackLayer(std::move(file)));
+	layer->_entries.reserve(count);
+
+	size_t offset = 12;
+	for (uint32_t i = 0; i < count; ++i) {
+		uint32_t pathLength;
+		uint64_t entryOffset, entrySize;
+		if (!ReadValue(data, size, offset, &pathLength) || size - offset - 4 < pathLength)
+			return nullptr;
+
+		std::string path(data + offset + 4, pathLength);
+		offset += 4 + pathLength;
+
+		if (!ReadValue(data, size, offset, &entryOffset) ||
+			!ReadValue(data, size, offset + 8, &entrySize) ||
+			entryOffset > size || size - entryOffset < entrySize)
+			return nullptr;
+		offset += 16;
+
+		layer->_entries[std::move(path)] = { (size_t)entryOffset, (size_t)entrySize };
+	}
+
+	return layer;
+}
+
+bool PackLayer::Build(const std::string& directory, const std::string& output) {
+	const auto root = ToPath(directory);
+
+	std::error_code ec;
+	std::vector<std::pair<std::string, fs::path>> files;
+	for (fs::recursive_directory_iterator it(root, ec), end; !ec && it != end; it.increment(ec)) {
+		if (it->is_regular_file(ec))
+			files.emplace_back(Vfs::NormalizePath(FromPath(fs::relative(it->path(), root, ec))), it->path());
+	}
+	if (ec)
+		return false;
+
+	std::sort(files.begin(), files.end());
+
+	uint64_t dataOffset = 12;
+	for (const auto& [path, _] : files)
+		dataOffset += 4 + path.size() + 16;
+
+	std::ofstream stream(ToPath(output), std::ios::binary | std::ios::trunc);
+	if (!stream)
+		return false;
+
+	stream.write(PackMagic, 4);
+	WriteValue(stream, PackVersion);
+	WriteValue(stream, (uint32_t)files.size());
+
+	for (const auto& [path, fullPath] : files) {
+		const auto size = (uint64_t)fs::file_size(fullPath, ec);
+		if (ec)
+			return false;
+
+		WriteValue(stream, (uint32_t)path.size());
+		stream.write(path.data(), (std::streamsize)path.size());
+		WriteValue(stream, dataOffset);
+		WriteValue(stream, size);
+		dataOffset += size;
+	}
+
+	for (const auto& [_, fullPath] : files) {
+		std::ifstream input(fullPath, std::ios::binary);
+		if (!input)
+			return false;
+		stream << input.rdbuf();
+	}
+
+	return (bool)stream;
+}
+
+std::shared_ptr<const ResourceBlob> PackLayer::Open(const std::string& path) {
+	const auto it = _entries.find(path);
+	if (it == _entries.end())
+		return nullptr;
+	return std::make_shared<MappedBlob>(_file, it->second.first, it->second.second);
+}
+
+std::shared_ptr<const ResourceBlob> OverlayLayer::Open(const std::string& path) {
+	std::lock_guard lock(_mutex);
+	const auto it = _files.find(path);
+	return it == _files.end() ? nullptr : it->second;
+}
+
+void OverlayLayer::Put(const std::string& path, const void* data, const size_t size) {
+	const auto normalized = Vfs::NormalizePath(path);
+	{
+		std::lock_guard lock(_mutex);
+		_files[normalized] = std::make_shared<MemoryBlob>(
+			std::vector<char>((const char*)data, (const char*)data + size));
+	}
+	if (_vfs) _vfs->Invalidate(normalized);
+}
+
+void OverlayLayer::Remove(const std::string& path) {
+	const auto normalized = Vfs::NormalizePath(path);
+	{
+		std::lock_guard lock(_mutex);
+		_files.erase(normalized);
+	}
+	if (_vfs) _vfs->Invalidate(normalized);
+}
+
+Vfs::~Vfs() {
+	Detach();
+	HotReload::Release(this, nullptr);
+}
+
+VfsLayer* Vfs::AddLayer(std::unique_ptr<VfsLayer> layer, const int priority) {
+	if (!layer)
+		return nullptr;
+
+	std::unique_lock lock(_mutex);
+
+	const auto instance = layer.get();
+	instance->_vfs = this;
+
+	const auto it = std::upper_bound(_layers.begin(), _layers.end(), priority,
+		[](const int p, const Layer& l) { return p > l.Priority; });
+	_layers.insert(it, { std::move(layer), priority });
+	_cache.clear();
+	++_generation;
+
+	return instance;
+}
+
+void Vfs::RemoveLayer(const VfsLayer* layer) {
+	// Stopped first: a watcher thread invalidates through the file system lock.
+	HotReload::Release(this, layer);
+
+	std::unique_lock lock(_mutex);
+	std::erase_if(_layers, [&](const Layer& l) { return l.Instance.get() == layer; });
+	_cache.clear();
+	++_generation;
+}
+
+std::shared_ptr<const ResourceBlob> Vfs::Open(const std::string& path) {
+	return Load(NormalizePath(path));
+}
+
+std::shared_ptr<const ResourceBlob> Vfs::Load(const std::string& path) {
+	std::shared_lock lock(_mutex);
+
+	if (const auto it = _cache.find(path); it != _cache.end()) {
+		const auto& [layer, blob] = it->second;
+		return blob ? blob : layer->Open(path);
+	}
+
+	// Layers are searched without the write lock; an invalidation in the meantime
+	// bumps the generation so the stale result is not cached over it.
+	const auto generation = _generation;
+	CacheEntry entry{ nullptr, nullptr };
+	std::shared_ptr<const ResourceBlob> result;
+	for (const auto& [instance, _] : _layers) {
+		if (auto blob = instance->Open(path)) {
+			entry.Layer = instance.get();
+			// Only blobs of immutable layers are kept: a file on disk may change, or grow the
+			// cache without bound, and is read again on every request.
+			if (instance->IsResident())
+				entry.Blob = blob;
+			result = std::move(blob);
+			break;
+		}
+	}
+
+	// Misses are not cached: unknown URLs are unbounded and the file may appear later.
+	if (!entry.Layer)
+		return result;
+
+	lock.unlock();
+	std::unique_lock writeLock(_mutex);
+	if (_generation == generation)
+		_cache.try_emplace(path, std::move(entry));
+
+	return result;
+}
+
+void Vfs::Invalidate(const std::string& path) {
+	std::unique_lock lock(_mutex);
+	_cache.erase(NormalizePath(path));
+	++_generation;
+}
+
+void Vfs::InvalidateAll() {
+	std::unique_lock lock(_mutex);
+	_cache.clear();
+	++_generation;
+}
+
+bool Vfs::HandleRequest(const ResourceQuery& query, const std::string_view path, ResourceResult* result) {
+	if (query.Method != "GET" && query.Method != "HEAD")
+		return false;
+
+	const auto normalized = ToFilePath(path);
+
+	auto blob = Load(normalized);
+	if (!blob)
+		return false;
+
+	result->StatusCode = 200;
+	result->ContentType = GetMimeType(normalized);
+	SetResourceContent(query, std::move(blob), result);
+	return true;
+}
+
+bool Vfs::Prefetch(const std::string_view path) {
+	// Resolves the layer and reads the file once, which leaves it in the OS page cache.
+	return Load(ToFilePath(path)) != nullptr;
+}
+
+std::string Vfs::NormalizePath(const std::string_view path) {
+	std::string result;
+	result.reserve(path.size());
+
+	size_t start = 0;
+	while (start <= path.size()) {
+		auto end = path.find_first_of("/\\", start);
+		if (end == std::string_view::npos)
+			end = path.size();
+
+		if (const auto segment = path.substr(start, end - start);
+			!segment.empty() && segment != "." && segment != "..") {
+			if (!result.empty()) result.push_back('/');
+			result.append(segment);
+		}
+
+		start = end + 1;
+	}
+
+	if (!path.empty() && (path.back() == '/' || path.back() == '\\') && !result.empty())
+		result.push_back('/');
+
+	return result;
+}
+
+std::string Vfs::ToFilePath(const std::string_view path) {
+	auto normalized = NormalizePath(path);
+	if (normalized.empty() || normalized.back() == '/')
+		normalized += "index.html";
+	return normalized;
+}
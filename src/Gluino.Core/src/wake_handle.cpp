@@ -0,0 +1,67 @@
+#include "wake_handle.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+#endif
+
+using namespace Gluino;
+
+WakeHandle::WakeHandle() {
+#ifdef _WIN32
+	_hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+#elif defined(__linux__)
+	_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	_writeFd = _fd;
+#else
+	int fds[2];
+	if (pipe(fds) == 0) {
+		for (const auto fd : fds) {
+			fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+			fcntl(fd, F_SETFD, FD_CLOEXEC);
+		}
+		_fd = fds[0];
+		_writeFd = fds[1];
+	}
+#endif
+}
+
+WakeHandle::~WakeHandle() {
+#ifdef _WIN32
+	if (_hEvent) CloseHandle(_hEvent);
+#else
+	if (_writeFd >= 0 && _writeFd != _fd) close(_writeFd);
+	if (_fd >= 0) close(_fd);
+#endif
+}
+
+void WakeHandle::Signal() {
+#ifdef _WIN32
+	SetEvent(_hEvent);
+#else
+	constexpr uint64_t one = 1;
+	[[maybe_unused]] const auto written = write(_writeFd, &one, _writeFd == _fd ? sizeof(one) : 1);
+#endif
+}
+
+void WakeHandle::Reset() {
+#ifdef _WIN32
+	ResetEvent(_hEvent);
+#else
+	uint64_t buffer[8];
+	while (read(_fd, buffer, sizeof(buffer)) > 0) {}
+#endif
+}
+
+intptr_t WakeHandle::GetNative() const {
+#ifdef _WIN32
+	return (intptr_t)_hEvent;
+#else
+	return _fd;
+#endif
+}
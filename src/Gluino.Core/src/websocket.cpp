@@ -0,0 +1,103 @@
+#include "websocket.h"
+
+#include <array>
+
+using namespace Gluino;
+
+namespace {
+
+constexpr auto WebSocketGuid = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+uint32_t RotateLeft(const uint32_t value, const int bits) {
+	return value << bits | value >> (32 - bits);
+}
+
+std::array<uint8_t, 20> Sha1(const std::string& input) {
+	uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+
+	std::string message = input;
+	message.push_back((char)0x80);
+	while (message.size() % 64 != 56)
+		message.push_back(0);
+	const uint64_t bitLength = (uint64_t)input.size() * 8;
+	for (int i = 7; i >= 0; --i)
+		message.push_back((char)(bitLength >> (i * 8)));
+
+	for (size_t chunk = 0; chunk < message.size(); chunk += 64) {
+		uint32_t w[80];
+		for (int i = 0; i < 16; ++i) {
+			const auto p = (const uint8_t*)message.data() + chunk + i * 4;
+			w[i] = (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+		}
+		for (int i = 16; i < 80; ++i)
+			w[i] = RotateLeft(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+		uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+		for (int i = 0; i < 80; ++i) {
+			uint32_t f, k;
+			if (i < 20)      { f = (b & c) | (~b & d);          k = 0x5A827999; }
+			else if (i < 40) { f = b ^ c ^ d;                   k = 0x6ED9EBA1; }
+			else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+			else             { f = b ^ c ^ d;                   k = 0xCA62C1D6; }
+
+			const auto temp = RotateLeft(a, 5) + f + e + k + w[i];
+			e = d;
+			d = c;
+			c = RotateLeft(b, 30);
+			b = a;
+			a = temp;
+		}
+
+		h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+	}
+
+	std::array<uint8_t, 20> digest{};
+	for (int i = 0; i < 20; ++i)
+		digest[i] = (uint8_t)(h[i / 4] >> (24 - i % 4 * 8));
+	return digest;
+}
+
+std::string Base64(const uint8_t* data, const size_t size) {
+	constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	std::string result;
+	result.reserve((size + 2) / 3 * 4);
+	for (size_t i = 0; i < size; i += 3) {
+		const uint32_t n = (uint32_t)data[i] << 16 |
+			(i + 1 < size ? (uint32_t)data[i + 1] << 8 : 0) |
+			(i + 2 < size ? (uint32_t)data[i + 2] : 0);
+		result.push_back(alphabet[n >> 18 & 0x3F]);
+		result.push_back(alphabet[n >> 12 & 0x3F]);
+		result.push_back(i + 1 < size ? alphabet[n >> 6 & 0x3F] : '=');
+		result.push_back(i + 2 < size ? alphabet[n & 0x3F] : '=');
+	}
+	return result;
+}
+
+}
+
+std::string Gluino::ComputeWebSocketAccept(const std::string_view key) {
+	const auto digest = Sha1(std::string(key) + WebSocketGuid);
+	return Base64(digest.data(), digest.size());
+}
+
+std::string Gluino::EncodeWebSocketHeader(const WebSocketOpcode opcode, const uint64_t size) {
+	std::string header;
+	header.push_back((char)(0x80 | (uint8_t)opcode));
+
+	if (size < 126) {
+		header.push_back((char)size);
+	}
+	else if (size <= 0xFFFF) {
+		header.push_back((char)126);
+		header.push_back((char)(size >> 8));
+		header.push_back((char)size);
+	}
+	else {
+		header.push_back((char)127);
+		for (int i = 7; i >= 0; --i)
+			header.push_back((char)(size >> (i * 8)));
+	}
+
+	return header;
+}
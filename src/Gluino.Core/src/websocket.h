@@ -0,0 +1,26 @@
+#pragma once
+
+#ifndef GLUINO_WEBSOCKET_H
+#define GLUINO_WEBSOCKET_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Gluino {
+
+enum class WebSocketOpcode : uint8_t {
+	Continuation = 0x0,
+	Text = 0x1,
+	Binary = 0x2,
+	Close = 0x8,
+	Ping = 0x9,
+	Pong = 0xA
+};
+
+std::string ComputeWebSocketAccept(std::string_view key);
+std::string EncodeWebSocketHeader(WebSocketOpcode opcode, uint64_t size);
+
+}
+
+#endif // !GLUINO_WEBSOCKET_H
@@ -0,0 +1,61 @@
+#include "webview_stack.h"
+#include "webview_base.h"
+#include "registry.h"
+
+#include <algorithm>
+
+using namespace Gluino;
+
+int WebViewStack::Add(WebViewBase* webView) {
+	const auto viewId = _nextId++;
+	webView->SetViewId(viewId);
+	_webViews.push_back(webView);
+	return viewId;
+}
+
+bool WebViewStack::Remove(WebViewBase* webView) {
+	return std::erase(_webViews, webView) > 0;
+}
+
+WebViewBase* WebViewStack::Find(const int viewId) const {
+	const auto it = std::find_if(_webViews.begin(), _webViews.end(),
+		[viewId](const WebViewBase* webView) { return webView->GetViewId() == viewId; });
+	return it == _webViews.end() ? nullptr : *it;
+}
+
+int WebViewStack::GetIndex(const WebViewBase* webView) const {
+	const auto it = std::find(_webViews.begin(), _webViews.end(), webView);
+	return it == _webViews.end() ? -1 : (int)(it - _webViews.begin());
+}
+
+bool WebViewStack::Move(WebViewBase* webView, const int index) {
+	const auto from = GetIndex(webView);
+	if (from < 0)
+		return false;
+
+	const auto to = std::clamp(index, 0, (int)_webViews.size() - 1);
+	if (from == to)
+		return false;
+
+	_webViews.erase(_webViews.begin() + from);
+	_webViews.insert(_webViews.begin() + to, webView);
+	return true;
+}
+
+bool WebViewStack::Swap(WebViewBase* current, WebViewBase* replacement) {
+	const auto from = GetIndex(current);
+	const auto to = GetIndex(replacement);
+	if (from < 0 || to < 0 || from == to)
+		return false;
+
+	WebViewRegistry.Replace(current->GetRegistryHandle(), replacement);
+	WebViewRegistry.Replace(replacement->GetRegistryHandle(), current);
+	std::swap(_webViews[from], _webViews[to]);
+	current->SwapIdentity(replacement);
+	return true;
+}
+
+void WebViewStack::SetWindowThrottleLevel(const ThrottleLevel level) const {
+	for (const auto webView : _webViews)
+		webView->SetWindowThrottleLevel(level);
+}
@@ -0,0 +1,75 @@
+#include "window_pool.h"
+
+#include <algorithm>
+
+using namespace Gluino;
+
+void WindowPool::SetCapacity(const int capacity) {
+	std::lock_guard lock(_mutex);
+	_capacity = std::max(capacity, 0);
+	_failed = false;
+}
+
+int WindowPool::GetCapacity() const {
+	std::lock_guard lock(_mutex);
+	return _capacity;
+}
+
+void WindowPool::AddWarming(const Entry& entry) {
+	std::lock_guard lock(_mutex);
+	_warming.push_back(entry);
+}
+
+bool WindowPool::MarkReady(const WindowHandle window, const bool created) {
+	std::lock_guard lock(_mutex);
+	const auto it = std::find_if(_warming.begin(), _warming.end(),
+		[window](const Entry& entry) { return entry.Window == window; });
+	if (it == _warming.end())
+		return false;
+
+	const auto entry = *it;
+	_warming.erase(it);
+
+	if (!created) {
+		_failed = true;
+		return false;
+	}
+
+	_ready.push_back(entry);
+	return true;
+}
+
+bool WindowPool::Acquire(Entry* entry) {
+	std::lock_guard lock(_mutex);
+	while (!_ready.empty()) {
+		*entry = _ready.front();
+		_ready.pop_front();
+
+		// Pooled windows can still be destroyed from outside, e.g. when the session ends.
+		if (WindowRegistry.Get(entry->Window) && WebViewRegistry.Get(entry->WebView))
+			return true;
+	}
+	return false;
+}
+
+int WindowPool::GetReadyCount() const {
+	std::lock_guard lock(_mutex);
+	return (int)_ready.size();
+}
+
+int WindowPool::GetDeficit() const {
+	std::lock_guard lock(_mutex);
+	if (_failed)
+		return 0;
+	return std::max(_capacity - (int)(_warming.size() + _ready.size()), 0);
+}
+
+std::vector<WindowPool::Entry> WindowPool::Trim() {
+	std::lock_guard lock(_mutex);
+	std::vector<Entry> removed;
+	while (!_ready.empty() && (int)(_warming.size() + _ready.size()) > _capacity) {
+		removed.push_back(_ready.back());
+		_ready.pop_back();
+	}
+	return removed;
+}
@@ -0,0 +1,173 @@
+#include "test.h"
+#include "headless_options.h"
+#include "app.h"
+#include "event_ring.h"
+
+#include <string>
+#include <vector>
+
+using namespace Gluino;
+using namespace Gluino::Test;
+
+namespace {
+
+struct DeliveredEvent {
+	EventType Type;
+	int X;
+	int Y;
+	std::string Text;
+};
+
+std::vector<std::vector<DeliveredEvent>> batches;
+
+void OnEvents(const EventRecord* records, const int count) {
+	auto& batch = batches.emplace_back();
+	for (auto i = 0; i < count; ++i)
+		batch.push_back({ records[i].Type, records[i].X, records[i].Y, records[i].Text ? records[i].Text : "" });
+}
+
+unsigned int MaskOf(const std::initializer_list<EventType> types) {
+	unsigned int mask = 0;
+	for (const auto type : types)
+		mask |= 1u << (int)type;
+	return mask;
+}
+
+}
+
+TEST(EventRingDrainsInPushOrder) {
+	EventRing ring(8);
+	bool wasEmpty = false;
+	CHECK(ring.Push(EventType::Shown, 0, 0, nullptr, &wasEmpty));
+	CHECK(wasEmpty);
+	CHECK(ring.Push(EventType::FocusIn, 0, 0, nullptr, &wasEmpty));
+	CHECK(!wasEmpty);
+	CHECK(ring.Push(EventType::WindowStateChanged, 2, 0, nullptr, &wasEmpty));
+
+	std::vector<EventRecord> records;
+	CHECK(ring.Drain(&records) == 3);
+	CHECK(records.size() == 3);
+	CHECK(records.size() == 3 && records[0].Type == EventType::Shown && records[1].Type == EventType::FocusIn);
+	CHECK(records.size() == 3 && records[2].Type == EventType::WindowStateChanged && records[2].X == 2);
+	EventRing::Release(&records);
+	CHECK(records.empty());
+
+	// A drained ring reports empty again and drains nothing.
+	CHECK(ring.Drain(&records) == 0);
+	CHECK(ring.Push(EventType::Hidden, 0, 0, nullptr, &wasEmpty));
+	CHECK(wasEmpty);
+	CHECK(ring.Drain(&records) == 1);
+	EventRing::Release(&records);
+}
+
+TEST(EventRingMergesConsecutiveGeometry) {
+	EventRing ring(8);
+	bool wasEmpty;
+	ring.Push(EventType::Resize, 100, 100, nullptr, &wasEmpty);
+	ring.Push(EventType::Resize, 200, 150, nullptr, &wasEmpty);
+	ring.Push(EventType::LocationChanged, 10, 10, nullptr, &wasEmpty);
+	ring.Push(EventType::LocationChanged, 20, 30, nullptr, &wasEmpty);
+	ring.Push(EventType::Resize, 300, 250, nullptr, &wasEmpty);
+
+	// Only records of the same type next to each other merge; the last values win.
+	std::vector<EventRecord> records;
+	CHECK(ring.Drain(&records) == 3);
+	CHECK(records.size() == 3);
+	if (records.size() == 3) {
+		CHECK(records[0].Type == EventType::Resize && records[0].X == 200 && records[0].Y == 150);
+		CHECK(records[1].Type == EventType::LocationChanged && records[1].X == 20 && records[1].Y == 30);
+		CHECK(records[2].Type == EventType::Resize && records[2].X == 300 && records[2].Y == 250);
+	}
+	EventRing::Release(&records);
+
+	// Other types are never merged, even when repeated.
+	ring.Push(EventType::FocusIn, 0, 0, nullptr, &wasEmpty);
+	ring.Push(EventType::FocusIn, 0, 0, nullptr, &wasEmpty);
+	CHECK(ring.Drain(&records) == 2);
+	EventRing::Release(&records);
+}
+
+TEST(EventRingRejectsPushWhenFull) {
+	EventRing ring(2);
+	bool wasEmpty;
+	CHECK(ring.Push(EventType::Shown, 0, 0, nullptr, &wasEmpty));
+	CHECK(ring.Push(EventType::Resize, 1, 1, nullptr, &wasEmpty));
+	CHECK(!ring.Push(EventType::FocusIn, 0, 0, nullptr, &wasEmpty));
+
+	// A full ring still merges into its last record.
+	CHECK(ring.Push(EventType::Resize, 2, 2, nullptr, &wasEmpty));
+
+	std::vector<EventRecord> records;
+	CHECK(ring.Drain(&records) == 2);
+	CHECK(records.size() == 2 && records[1].X == 2);
+	EventRing::Release(&records);
+
+	// Wrapping around the end of the buffer keeps the order.
+	CHECK(ring.Push(EventType::FocusIn, 0, 0, nullptr, &wasEmpty));
+	CHECK(ring.Push(EventType::FocusOut, 0, 0, nullptr, &wasEmpty));
+	CHECK(ring.Drain(&records) == 2);
+	CHECK(records.size() == 2 && records[0].Type == EventType::FocusIn && records[1].Type == EventType::FocusOut);
+	EventRing::Release(&records);
+}
+
+TEST(EventRingOwnsRecordText) {
+	EventRing ring(4);
+	bool wasEmpty;
+	std::string url = "app://index.html";
+	ring.Push(EventType::NavigationStart, 1, 0, url.data(), &wasEmpty);
+	url.assign(url.size(), '?');
+
+	std::vector<EventRecord> records;
+	ring.Drain(&records);
+	CHECK(records.size() == 1 && records[0].Text != nullptr);
+	CHECK(records.size() == 1 && std::string(records[0].Text) == "app://index.html");
+	EventRing::Release(&records);
+
+	// Records left in the ring are released with it.
+	ring.Push(EventType::MessageReceived, 1, 0, (autostr)"pending", &wasEmpty);
+}
+
+TEST(EventRingDeliversSubscribedWindowEventsInOneBatch) {
+	App app((char*)"event-ring-tests");
+	batches.clear();
+
+	SpawnOptions options;
+	options.WindowEvents.OnEvents = (EventBatchDelegate*)OnEvents;
+	options.WindowEvents.Subscriptions = MaskOf({ EventType::Shown, EventType::FocusIn, EventType::FocusOut });
+	WindowBase* window = nullptr;
+	WebViewBase* webView = nullptr;
+	app.SpawnWindow(&options.Window, &options.WindowEvents, &options.WebView, &options.WebViewEvents, nullptr, &window, &webView);
+	CHECK(window != nullptr);
+	if (!window)
+		return;
+
+	const auto headless = (Window*)window;
+	headless->Show();
+	headless->SetFocused(true);
+	headless->SetFocused(false);
+	Size size = { 1024, 768 };
+	headless->SetSize(size);
+	CHECK(batches.empty());
+
+	// Everything queued before the loop turns arrives together; unsubscribed events never do.
+	app.RunOnce(0);
+	CHECK(batches.size() == 1);
+	if (batches.size() == 1) {
+		const auto& batch = batches[0];
+		CHECK(batch.size() == 3);
+		CHECK(batch.size() == 3 && batch[0].Type == EventType::Shown);
+		CHECK(batch.size() == 3 && batch[1].Type == EventType::FocusIn && batch[2].Type == EventType::FocusOut);
+	}
+
+	// Changing the mask takes effect for the next event.
+	batches.clear();
+	window->SetEventMask(MaskOf({ EventType::FocusIn }));
+	headless->SetFocused(true);
+	headless->SetFocused(false);
+	window->FlushEvents();
+	CHECK(batches.size() == 1 && batches[0].size() == 1 && batches[0][0].Type == EventType::FocusIn);
+
+	window->Close();
+	app.RunOnce(0);
+	CHECK(WindowRegistry.GetCount() == 0);
+}
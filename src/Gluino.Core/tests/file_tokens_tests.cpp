@@ -0,0 +1,155 @@
+#include "test.h"
+#include "temp_directory.h"
+#include "file_tokens.h"
+#include "resource_router.h"
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+using namespace Gluino;
+
+namespace {
+
+std::string ReadContent(const ResourceResult& result) {
+	std::string content(result.Length, '\0');
+	content.resize(result.Blob ? result.Blob->Read(result.Offset, content.data(), content.size()) : 0);
+	return content;
+}
+
+std::string_view GetHeader(const ResourceResult& result, const std::string_view name) {
+	for (const auto& [key, value] : result.Headers) {
+		if (key == name)
+			return value;
+	}
+	return {};
+}
+
+}
+
+TEST(FileTokensServeRegisteredFiles) {
+	const Test::TempDirectory directory;
+	directory.Write("notes.txt", "0123456789");
+
+	FileTokens tokens;
+	ResourceRouter router;
+	router.Mount(FileTokens::Prefix, &tokens);
+
+	const auto url = tokens.Register((directory.GetPath() / "notes.txt").string(), {});
+	CHECK(url.starts_with(FileTokens::Prefix));
+	CHECK(url.ends_with("/notes.txt"));
+	CHECK(url.size() == std::string_view(FileTokens::Prefix).size() + FileTokens::TokenLength + 10);
+	CHECK(tokens.Register((directory.GetPath() / "missing.txt").string(), {}).empty());
+
+	ResourceResult result;
+	CHECK(router.Route({ url, "GET", {}, {} }, &result));
+	CHECK(result.StatusCode == 200);
+	CHECK(result.ContentType == "text/plain");
+	CHECK(ReadContent(result) == "0123456789");
+	CHECK(GetHeader(result, "Accept-Ranges") == "bytes");
+
+	CHECK(router.Route({ url, "HEAD", {}, {} }, &result));
+	CHECK(!router.Route({ url, "POST", {}, {} }, &result));
+	CHECK(!router.Route({ std::string(FileTokens::Prefix) + "unknown/notes.txt", "GET", {}, {} }, &result));
+
+	const auto typed = tokens.Register((directory.GetPath() / "notes.txt").string(), "application/x-notes");
+	CHECK(typed != url);
+	CHECK(router.Route({ typed, "GET", {}, {} }, &result));
+	CHECK(result.ContentType == "application/x-notes");
+}
+
+TEST(FileTokensServeRanges) {
+	const Test::TempDirectory directory;
+	directory.Write("notes.txt", "0123456789");
+
+	FileTokens tokens;
+	ResourceRouter router;
+	router.Mount(FileTokens::Prefix, &tokens);
+	const auto url = tokens.Register((directory.GetPath() / "notes.txt").string(), {});
+
+	ResourceResult result;
+	CHECK(router.Route({ url, "GET", "bytes=2-5", {} }, &result));
+	CHECK(result.StatusCode == 206);
+	CHECK(ReadContent(result) == "2345");
+	CHECK(GetHeader(result, "Content-Range") == "bytes 2-5/10");
+
+	ResourceResult suffix;
+	CHECK(router.Route({ url, "GET", "bytes=-3", {} }, &suffix));
+	CHECK(suffix.StatusCode == 206);
+	CHECK(ReadContent(suffix) == "789");
+
+	ResourceResult open;
+	CHECK(router.Route({ url, "GET", "bytes=8-", {} }, &open));
+	CHECK(ReadContent(open) == "89");
+
+	ResourceResult unsatisfiable;
+	CHECK(router.Route({ url, "GET", "bytes=20-", {} }, &unsatisfiable));
+	CHECK(unsatisfiable.StatusCode == 416);
+	CHECK(unsatisfiable.Length == 0);
+	CHECK(GetHeader(unsatisfiable, "Content-Range") == "bytes */10");
+}
+
+TEST(FileTokensFollowResizedFiles) {
+	const Test::TempDirectory directory;
+	directory.Write("log.txt", "first");
+
+	FileTokens tokens;
+	ResourceRouter router;
+	router.Mount(FileTokens::Prefix, &tokens);
+	const auto url = tokens.Register((directory.GetPath() / "log.txt").string(), {});
+
+	// A file still being written is served at its current length.
+	directory.Write("log.txt", "first second");
+	ResourceResult grown;
+	CHECK(router.Route({ url, "GET", {}, {} }, &grown));
+	CHECK(ReadContent(grown) == "first second");
+
+	directory.Write("log.txt", "new");
+	ResourceResult shrunk;
+	CHECK(router.Route({ url, "GET", {}, {} }, &shrunk));
+	CHECK(ReadContent(shrunk) == "new");
+}
+
+TEST(FileTokensSurviveTruncationWhileServing) {
+	const Test::TempDirectory directory;
+	directory.Write("video.mp4", std::string(4 * 1024 * 1024, 'v'));
+	const auto path = directory.GetPath() / "video.mp4";
+
+	FileTokens tokens;
+	ResourceRouter router;
+	router.Mount(FileTokens::Prefix, &tokens);
+	const auto url = tokens.Register(path.string(), {});
+
+	ResourceResult result;
+	CHECK(router.Route({ url, "GET", "bytes=1024-", {} }, &result));
+	CHECK(result.Length == 4 * 1024 * 1024 - 1024);
+
+	// Truncating the file mid-response, as log rotation does, cuts the body short rather than
+	// faulting on a mapping past the new end of file.
+	std::string chunk(64 * 1024, '\0');
+	CHECK(result.Blob->Read(result.Offset, chunk.data(), chunk.size()) == chunk.size());
+	std::filesystem::resize_file(path, 100 * 1024);
+	CHECK(result.Blob->Read(result.Offset + chunk.size(), chunk.data(), chunk.size()) == 100 * 1024 - 1024 - chunk.size());
+	CHECK(result.Blob->Read(result.Offset + 2 * chunk.size(), chunk.data(), chunk.size()) == 0);
+}
+
+TEST(FileTokensRevoke) {
+	const Test::TempDirectory directory;
+	directory.Write("a.txt", "a");
+	directory.Write("b.txt", "b");
+
+	FileTokens tokens;
+	ResourceRouter router;
+	router.Mount(FileTokens::Prefix, &tokens);
+	const auto a = tokens.Register((directory.GetPath() / "a.txt").string(), {});
+	const auto b = tokens.Register((directory.GetPath() / "b.txt").string(), {});
+
+	ResourceResult result;
+	CHECK(tokens.Revoke(a));
+	CHECK(!tokens.Revoke(a));
+	CHECK(!router.Route({ a, "GET", {}, {} }, &result));
+	CHECK(router.Route({ b, "GET", {}, {} }, &result));
+
+	tokens.RevokeAll();
+	CHECK(!router.Route({ b, "GET", {}, {} }, &result));
+}
@@ -0,0 +1,110 @@
+#include "test.h"
+#include "geometry_coalescer.h"
+
+using namespace Gluino;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr auto Interval = GeometryCoalescer::Clock::duration(16ms);
+const auto Start = GeometryCoalescer::Clock::time_point(1h);
+
+}
+
+TEST(GeometryCoalescerCollapsesBursts) {
+	GeometryCoalescer coalescer(Interval);
+	GeometryUpdate update;
+
+	// The first notification is due at once; the rest of the burst waits for the interval.
+	CHECK(coalescer.Resize({ 100, 100 }, Start));
+	CHECK(coalescer.Poll(Start, &update));
+	CHECK(update.Resized && !update.Moved);
+	CHECK(update.Size.width == 100);
+
+	for (auto i = 1; i <= 10; ++i) {
+		CHECK(!coalescer.Resize({ 100 + i, 100 + i }, Start + 1ms * i));
+		CHECK(!coalescer.Move({ i, i }, Start + 1ms * i));
+		CHECK(!coalescer.Poll(Start + 1ms * i, &update));
+	}
+	CHECK(coalescer.HasPending());
+
+	CHECK(coalescer.Poll(Start + Interval, &update));
+	CHECK(update.Resized && update.Moved);
+	CHECK(update.Size.width == 110 && update.Size.height == 110);
+	CHECK(update.Location.x == 10 && update.Location.y == 10);
+	CHECK(!coalescer.HasPending());
+	CHECK(!coalescer.Poll(Start + Interval * 3, &update));
+}
+
+TEST(GeometryCoalescerPollsAfterDeadline) {
+	GeometryCoalescer coalescer(Interval);
+	GeometryUpdate update;
+
+	coalescer.Move({ 1, 2 }, Start);
+	CHECK(coalescer.Poll(Start, &update));
+	CHECK(coalescer.GetDeadline() == Start + Interval);
+
+	CHECK(!coalescer.Move({ 3, 4 }, Start + 5ms));
+	CHECK(!coalescer.Poll(coalescer.GetDeadline() - 1ns, &update));
+
+	// A late poll still delivers, and the next interval starts from that delivery.
+	const auto late = Start + Interval * 4;
+	CHECK(coalescer.Poll(late, &update));
+	CHECK(update.Location.x == 3 && update.Location.y == 4);
+	CHECK(coalescer.GetDeadline() == late + Interval);
+}
+
+TEST(GeometryCoalescerFlushesFinalGeometry) {
+	GeometryCoalescer coalescer(Interval);
+	GeometryUpdate update;
+
+	coalescer.Resize({ 10, 10 }, Start);
+	coalescer.Poll(Start, &update);
+
+	// The end of a drag delivers whatever is pending without waiting for the deadline.
+	coalescer.Resize({ 640, 480 }, Start + 1ms);
+	coalescer.Move({ 20, 30 }, Start + 2ms);
+	CHECK(coalescer.Flush(&update));
+	CHECK(update.Resized && update.Moved);
+	CHECK(update.Size.width == 640 && update.Size.height == 480);
+	CHECK(update.Location.x == 20 && update.Location.y == 30);
+
+	CHECK(!coalescer.HasPending());
+	CHECK(!coalescer.Flush(&update));
+}
+
+TEST(GeometryCoalescerKeepsMoveAndResizeStreamsApart) {
+	GeometryCoalescer coalescer(Interval);
+	GeometryUpdate update;
+
+	for (auto i = 0; i < 5; ++i)
+		coalescer.Move({ i, -i }, Start + 1ms * i);
+	CHECK(coalescer.Flush(&update));
+	CHECK(update.Moved && !update.Resized);
+	CHECK(update.Location.x == 4 && update.Location.y == -4);
+
+	for (auto i = 0; i < 5; ++i)
+		coalescer.Resize({ 200 + i, 100 }, Start + 1ms * i);
+	CHECK(coalescer.Flush(&update));
+	CHECK(update.Resized && !update.Moved);
+	CHECK(update.Size.width == 204 && update.Size.height == 100);
+}
+
+TEST(GeometryCoalescerAppliesIntervalChangeWhilePending) {
+	GeometryCoalescer coalescer(Interval);
+	GeometryUpdate update;
+
+	coalescer.Resize({ 1, 1 }, Start);
+	coalescer.Poll(Start, &update);
+	coalescer.Resize({ 2, 2 }, Start + 1ms);
+
+	// A longer interval pushes the pending delivery back; a shorter one brings it forward.
+	coalescer.SetInterval(50ms);
+	CHECK(coalescer.GetInterval() == GeometryCoalescer::Clock::duration(50ms));
+	CHECK(!coalescer.Poll(Start + Interval, &update));
+	CHECK(coalescer.HasPending());
+
+	coalescer.SetInterval(2ms);
+	CHECK(coalescer.Poll(Start + 2ms, &update));
+	CHECK(update.Size.width == 2);
+}
@@ -0,0 +1,121 @@
+#include "test.h"
+#include "handle_table.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Gluino;
+
+namespace {
+
+struct Entry {
+	int Value = 0;
+};
+
+typedef HandleTable<Entry> Table;
+
+}
+
+TEST(HandleTableRejectsStaleHandles) {
+	Table table;
+	Entry first, second;
+	const auto handle = table.Add(&first);
+	CHECK(handle != 0);
+	CHECK(table.Get(handle) == &first);
+
+	CHECK(table.Remove(handle));
+	CHECK(!table.Remove(handle));
+	CHECK(table.Get(handle) == nullptr);
+
+	// The slot is reused under a new generation; the old handle still resolves to nothing.
+	const auto reused = table.Add(&second);
+	CHECK(reused != handle);
+	CHECK(table.Get(reused) == &second);
+	CHECK(table.Get(handle) == nullptr);
+	CHECK(table.GetCount() == 1);
+}
+
+TEST(HandleTableDefersReleaseWhilePinned) {
+	Table table;
+	Entry entry;
+	const auto handle = table.Add(&entry);
+
+	auto released = 0;
+	{
+		const auto pinned = table.Pin(handle);
+		CHECK(pinned == &entry);
+
+		// Removal takes effect for lookups at once, but the value stays alive for the pin.
+		CHECK(table.Remove(handle, [&released] { ++released; }));
+		CHECK(table.Get(handle) == nullptr);
+		CHECK(!table.Pin(handle));
+		CHECK(table.GetCount() == 0);
+		CHECK(released == 0);
+
+		// The pinned slot is not handed out again.
+		Entry other;
+		const auto added = table.Add(&other);
+		CHECK((added & 0xFFFFF) != (handle & 0xFFFFF));
+		table.Remove(added);
+	}
+	CHECK(released == 1);
+
+	// Without a pin the release runs within Remove.
+	const auto unpinned = table.Add(&entry);
+	table.Remove(unpinned, [&released] { ++released; });
+	CHECK(released == 2);
+}
+
+TEST(HandleTableReleasesOnLastPin) {
+	Table table;
+	Entry entry;
+	const auto handle = table.Add(&entry);
+
+	auto released = 0;
+	auto first = table.Pin(handle);
+	{
+		const auto second = table.Pin(handle);
+		table.Remove(handle, [&released] { ++released; });
+	}
+	CHECK(released == 0);
+	{
+		const auto moved = std::move(first);
+		CHECK(moved == &entry);
+	}
+	CHECK(released == 1);
+}
+
+TEST(HandleTablePinsAgainstConcurrentRemoval) {
+	Table table;
+	std::atomic<bool> stop = false;
+	std::atomic<Table::Handle> current = 0;
+	std::atomic<int> misuses = 0;
+
+	// Readers touch whatever they pin; a released entry is poisoned before it is freed.
+	std::vector<std::thread> readers;
+	for (auto i = 0; i < 4; ++i) {
+		readers.emplace_back([&] {
+			while (!stop) {
+				if (const auto pinned = table.Pin(current.load()); pinned && pinned->Value != 1)
+					++misuses;
+			}
+		});
+	}
+
+	for (auto i = 0; i < 20000; ++i) {
+		const auto entry = new Entry{ 1 };
+		const auto handle = table.Add(entry);
+		current = handle;
+		table.Remove(handle, [entry] {
+			entry->Value = 0;
+			delete entry;
+		});
+	}
+
+	stop = true;
+	for (auto& reader : readers)
+		reader.join();
+	CHECK(misuses == 0);
+	CHECK(table.GetCount() == 0);
+}
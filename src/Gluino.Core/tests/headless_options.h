@@ -0,0 +1,37 @@
+#pragma once
+
+#ifndef GLUINO_HEADLESS_OPTIONS_H
+#define GLUINO_HEADLESS_OPTIONS_H
+
+#include "window_options.h"
+#include "window_events.h"
+#include "webview_options.h"
+#include "webview_events.h"
+
+#include <climits>
+
+namespace Gluino::Test {
+
+// Options and events for spawning a headless window and webview pair, as the host would
+// fill them in with its defaults.
+struct SpawnOptions {
+	WindowOptions Window{};
+	Gluino::WindowEvents WindowEvents{};
+	WebViewOptions WebView{};
+	Gluino::WebViewEvents WebViewEvents{};
+
+	SpawnOptions() {
+		Window.TitleW = (wchar_t*)L"";
+		Window.TitleA = (char*)"";
+		Window.Size = { 800, 600 };
+		Window.MaximumSize = { INT_MAX, INT_MAX };
+		Window.MinimizeEnabled = true;
+		Window.MaximizeEnabled = true;
+		Window.BrowserSuspendDelay = -1;
+		WebView.SuspendDelay = -1;
+	}
+};
+
+}
+
+#endif // !GLUINO_HEADLESS_OPTIONS_H
@@ -0,0 +1,268 @@
+#include "test.h"
+#include "headless_options.h"
+#include "app.h"
+#include "registry.h"
+#include "vfs.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace Gluino;
+using namespace Gluino::Test;
+
+// The tests drive the library through its exports, as the host does.
+extern "C" {
+	App* Gluino_App_Create(void*, autostr appId);
+	void Gluino_App_Destroy(const App* app);
+	void Gluino_App_SpawnWindow(App* app,
+		WindowOptions* windowOptions, WindowEvents* windowEvents,
+		WebViewOptions* webViewOptions, WebViewEvents* webViewEvents,
+		UiThreadBase* thread, WindowHandle* window, WebViewHandle* webView);
+	bool Gluino_App_RunOnce(App* app, int timeout);
+
+	void Gluino_Window_Show(WindowHandle handle);
+	void Gluino_Window_Close(WindowHandle handle);
+	void Gluino_Window_SetSize(WindowHandle handle, Size size);
+
+	void Gluino_WebView_Navigate(WebViewHandle handle, autostr url);
+	void Gluino_WebView_PostWebMessage(WebViewHandle handle, autostr message);
+	void Gluino_WebView_MountVfs(WebViewHandle handle, autostr prefix, Vfs* vfs);
+	void Gluino_WebView_Unmount(WebViewHandle handle, autostr prefix);
+
+	void Gluino_Headless_SetFocused(WindowHandle handle, bool focused);
+	void Gluino_Headless_PostMessage(WebViewHandle handle, autostr message);
+	int Gluino_Headless_Fetch(WebViewHandle handle, autostr url, autostr method, int* statusCode);
+	void Gluino_Headless_SetPageHandler(WebViewHandle handle, StringDelegate handler);
+}
+
+namespace {
+
+struct DeliveredEvent {
+	EventType Type;
+	int X;
+	int Y;
+	std::string Text;
+};
+
+// What the host has seen so far; each test starts from a fresh Host.
+struct Host {
+	std::vector<DeliveredEvent> Events;
+	std::vector<std::string> Requests;
+	std::vector<std::string> PageMessages;
+	int Created = 0;
+	bool CancelClose = false;
+
+	[[nodiscard]] size_t Count(const EventType type) const {
+		size_t count = 0;
+		for (const auto& event : Events)
+			count += event.Type == type;
+		return count;
+	}
+
+	[[nodiscard]] const DeliveredEvent* Find(const EventType type) const {
+		for (const auto& event : Events) {
+			if (event.Type == type)
+				return &event;
+		}
+		return nullptr;
+	}
+} host;
+
+void OnEvents(const EventRecord* records, const int count) {
+	for (auto i = 0; i < count; ++i)
+		host.Events.push_back({ records[i].Type, records[i].X, records[i].Y, records[i].Text ? records[i].Text : "" });
+}
+
+bool OnClosing() {
+	return host.CancelClose;
+}
+
+void OnCreated() {
+	++host.Created;
+}
+
+// Answers every request the router leaves unhandled with the requested URL.
+void OnResourceRequested(const WebResourceRequest request, WebResourceResponse* response) {
+	host.Requests.emplace_back(request.UrlA);
+	if (std::string(request.UrlA).find("missing") != std::string::npos)
+		return;
+
+	const auto length = strlen(request.UrlA);
+	response->Content = malloc(length);
+	memcpy(response->Content, request.UrlA, length);
+	response->ContentLength = (int)length;
+	response->ContentTypeA = (char*)"text/plain";
+	response->StatusCode = 200;
+}
+
+void OnPageMessage(const autostr message) {
+	host.PageMessages.emplace_back(message);
+}
+
+struct Spawned {
+	WindowHandle Window = 0;
+	WebViewHandle WebView = 0;
+};
+
+Spawned Spawn(App* app, SpawnOptions& options) {
+	options.WindowEvents.OnEvents = (EventBatchDelegate*)OnEvents;
+	options.WindowEvents.OnClosing = (Predicate*)OnClosing;
+	options.WindowEvents.Subscriptions = ~0u;
+	options.WebViewEvents.OnCreated = (Delegate*)OnCreated;
+	options.WebViewEvents.OnResourceRequested = (WebResourceDelegate*)OnResourceRequested;
+
+	Spawned spawned;
+	Gluino_App_SpawnWindow(app, &options.Window, &options.WindowEvents, &options.WebView, &options.WebViewEvents, nullptr, &spawned.Window, &spawned.WebView);
+	return spawned;
+}
+
+void RunUntil(App* app, const std::function<bool()>& done) {
+	for (auto i = 0; i < 100 && !done(); ++i)
+		Gluino_App_RunOnce(app, 5);
+}
+
+}
+
+TEST(HeadlessWindowLoadsStartPageAndReportsEvents) {
+	host = {};
+	const auto app = Gluino_App_Create(nullptr, (autostr)"headless-tests");
+	CHECK(app != nullptr);
+
+	SpawnOptions options;
+	options.WebView.StartUrlA = (char*)"app://index.html";
+	const auto spawned = Spawn(app, options);
+	CHECK(spawned.Window != 0 && spawned.WebView != 0);
+
+	// Created, the start page request and its navigation all happen on the loop.
+	CHECK(host.Created == 0);
+	RunUntil(app, [] { return host.Count(EventType::NavigationEnd) == 1; });
+	CHECK(host.Created == 1);
+	CHECK(host.Requests.size() == 1 && host.Requests[0] == "app://index.html");
+	const auto start = host.Find(EventType::NavigationStart);
+	CHECK(start && start->Text == "app://index.html");
+	CHECK(start && start->X == WebViewRegistry.Get(spawned.WebView)->GetViewId());
+	CHECK(((WebView*)WebViewRegistry.Get(spawned.WebView))->GetPageUrl() == "app://index.html");
+
+	host.Events.clear();
+	Gluino_Window_Show(spawned.Window);
+	Gluino_Headless_SetFocused(spawned.Window, true);
+	Gluino_Window_SetSize(spawned.Window, { 1024, 768 });
+	RunUntil(app, [] { return host.Count(EventType::Resize) == 1; });
+	CHECK(host.Count(EventType::Shown) == 1);
+	CHECK(host.Count(EventType::FocusIn) == 1);
+	const auto resize = host.Find(EventType::Resize);
+	CHECK(resize && resize->X == 1024 && resize->Y == 768);
+
+	// A newer navigation supersedes one that has not committed yet.
+	host.Events.clear();
+	Gluino_WebView_Navigate(spawned.WebView, (autostr)"app://first.html");
+	Gluino_WebView_Navigate(spawned.WebView, (autostr)"app://second.html");
+	RunUntil(app, [] { return host.Count(EventType::NavigationEnd) == 1; });
+	Gluino_App_RunOnce(app, 0);
+	CHECK(host.Count(EventType::NavigationStart) == 2);
+	CHECK(host.Count(EventType::NavigationEnd) == 1);
+	CHECK(host.Requests.back() == "app://second.html");
+
+	Gluino_Window_Close(spawned.Window);
+	RunUntil(app, [] { return WindowRegistry.GetCount() == 0; });
+	CHECK(WindowRegistry.GetCount() == 0);
+	CHECK(WebViewRegistry.GetCount() == 0);
+	Gluino_App_Destroy(app);
+}
+
+TEST(HeadlessPageExchangesMessagesWithHost) {
+	host = {};
+	const auto app = Gluino_App_Create(nullptr, (autostr)"headless-tests");
+	SpawnOptions options;
+	const auto spawned = Spawn(app, options);
+	RunUntil(app, [] { return host.Created == 1; });
+
+	// Page to host: a MessageReceived event carrying the view and the text.
+	Gluino_Headless_PostMessage(spawned.WebView, (autostr)"ping");
+	CHECK(host.Count(EventType::MessageReceived) == 0);
+	RunUntil(app, [] { return host.Count(EventType::MessageReceived) == 1; });
+	const auto message = host.Find(EventType::MessageReceived);
+	CHECK(message && message->Text == "ping");
+	CHECK(message && message->X == WebViewRegistry.Get(spawned.WebView)->GetViewId());
+
+	// Host to page: delivered to the page handler on a later turn of the loop.
+	Gluino_Headless_SetPageHandler(spawned.WebView, OnPageMessage);
+	Gluino_WebView_PostWebMessage(spawned.WebView, (autostr)"pong");
+	CHECK(host.PageMessages.empty());
+	RunUntil(app, [] { return !host.PageMessages.empty(); });
+	CHECK(host.PageMessages.size() == 1 && host.PageMessages[0] == "pong");
+
+	Gluino_Headless_SetPageHandler(spawned.WebView, nullptr);
+	Gluino_WebView_PostWebMessage(spawned.WebView, (autostr)"dropped");
+	Gluino_App_RunOnce(app, 0);
+	CHECK(host.PageMessages.size() == 1);
+
+	Gluino_Window_Close(spawned.Window);
+	RunUntil(app, [] { return WindowRegistry.GetCount() == 0; });
+	Gluino_App_Destroy(app);
+}
+
+TEST(HeadlessPageFetchesThroughRouterThenHost) {
+	host = {};
+	const auto app = Gluino_App_Create(nullptr, (autostr)"headless-tests");
+	SpawnOptions options;
+	const auto spawned = Spawn(app, options);
+	RunUntil(app, [] { return host.Created == 1; });
+
+	Vfs vfs;
+	const auto overlay = (OverlayLayer*)vfs.AddLayer(std::make_unique<OverlayLayer>(), 0);
+	overlay->Put("index.html", "<html></html>", 13);
+	Gluino_WebView_MountVfs(spawned.WebView, (autostr)"app://", &vfs);
+
+	// Mounted content is served without asking the host.
+	int statusCode = 0;
+	CHECK(Gluino_Headless_Fetch(spawned.WebView, (autostr)"app://index.html", nullptr, &statusCode) == 13);
+	CHECK(statusCode == 200);
+	CHECK(host.Requests.empty());
+
+	// Anything the router declines falls through to the host.
+	statusCode = 0;
+	CHECK(Gluino_Headless_Fetch(spawned.WebView, (autostr)"https://example.com/data", (autostr)"GET", &statusCode) == 24);
+	CHECK(statusCode == 200);
+	CHECK(host.Requests.size() == 1 && host.Requests[0] == "https://example.com/data");
+	CHECK(Gluino_Headless_Fetch(spawned.WebView, (autostr)"https://example.com/missing", nullptr, &statusCode) == -1);
+
+	Gluino_WebView_Unmount(spawned.WebView, (autostr)"app://");
+	CHECK(Gluino_Headless_Fetch(spawned.WebView, (autostr)"app://index.html", nullptr, &statusCode) == 16);
+	CHECK(host.Requests.back() == "app://index.html");
+
+	Gluino_Window_Close(spawned.Window);
+	RunUntil(app, [] { return WindowRegistry.GetCount() == 0; });
+	CHECK(Gluino_Headless_Fetch(spawned.WebView, (autostr)"app://index.html", nullptr, &statusCode) == -1);
+	Gluino_App_Destroy(app);
+}
+
+TEST(HeadlessCloseAsksHostAndReleasesHandles) {
+	host = {};
+	const auto app = Gluino_App_Create(nullptr, (autostr)"headless-tests");
+	SpawnOptions options;
+	const auto spawned = Spawn(app, options);
+	RunUntil(app, [] { return host.Created == 1; });
+
+	host.CancelClose = true;
+	Gluino_Window_Close(spawned.Window);
+	Gluino_App_RunOnce(app, 0);
+	CHECK(WindowRegistry.Get(spawned.Window) != nullptr);
+
+	host.CancelClose = false;
+	Gluino_Window_Close(spawned.Window);
+	Gluino_App_RunOnce(app, 0);
+	CHECK(WindowRegistry.Get(spawned.Window) == nullptr);
+	CHECK(WebViewRegistry.Get(spawned.WebView) == nullptr);
+
+	// Stale handles are ignored rather than reaching a destroyed window.
+	host.Events.clear();
+	Gluino_Headless_SetFocused(spawned.Window, true);
+	Gluino_Headless_PostMessage(spawned.WebView, (autostr)"late");
+	Gluino_App_RunOnce(app, 0);
+	CHECK(host.Events.empty());
+	Gluino_App_Destroy(app);
+}
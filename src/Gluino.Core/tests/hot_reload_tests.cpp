@@ -0,0 +1,55 @@
+#include "test.h"
+#include "temp_directory.h"
+#include "hot_reload.h"
+
+using namespace Gluino;
+
+namespace {
+
+const DirectoryLayer* AddDirectory(Vfs& vfs, const Test::TempDirectory& directory) {
+	return (const DirectoryLayer*)vfs.AddLayer(std::make_unique<DirectoryLayer>(directory.GetRoot()), 0);
+}
+
+}
+
+TEST(HotReloadStopsWhenItsLayerIsRemoved) {
+	const Test::TempDirectory directory;
+	Vfs vfs;
+	const auto layer = AddDirectory(vfs, directory);
+
+	HotReload hotReload(&vfs, layer);
+	CHECK(hotReload.Start());
+
+	vfs.RemoveLayer(layer);
+	CHECK(!hotReload.Start());
+}
+
+TEST(HotReloadKeepsWatchingOtherLayers) {
+	const Test::TempDirectory first;
+	const Test::TempDirectory second;
+	Vfs vfs;
+	const auto firstLayer = AddDirectory(vfs, first);
+	const auto secondLayer = AddDirectory(vfs, second);
+
+	HotReload hotReload(&vfs, secondLayer);
+	CHECK(hotReload.Start());
+
+	vfs.RemoveLayer(firstLayer);
+	hotReload.Stop();
+	CHECK(hotReload.Start());
+}
+
+TEST(HotReloadOutlivesItsFileSystem) {
+	const Test::TempDirectory directory;
+	auto vfs = std::make_unique<Vfs>();
+	HotReload hotReload(vfs.get(), AddDirectory(*vfs, directory));
+	CHECK(hotReload.Start());
+
+	// Changes keep arriving while the file system goes away.
+	for (auto i = 0; i < 20; ++i)
+		directory.Write("root/file" + std::to_string(i) + ".js", "x");
+	vfs.reset();
+
+	CHECK(!hotReload.Start());
+	hotReload.Stop();
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+#ifndef GLUINO_INFLATE_FIXTURES_H
+#define GLUINO_INFLATE_FIXTURES_H
+
+// Raw deflate streams produced by zlib (wbits -15, as stored in ZIP entries) from the inputs
+// that MakeText and MakeRandom in inflate_tests.cpp rebuild:
+//   Stored    MakeText(1, 200), level 0
+//   Fixed     MakeText(2, 300), level 9, Z_FIXED
+//   Dynamic   MakeText(3, 8192), level 9
+//   FarMatch  MakeRandom(4, 300) + 32000 zero bytes + MakeRandom(4, 300), level 9
+//   Flushed   MakeText(5, 4096), level 6, Z_FULL_FLUSH after the first 2048 bytes
+
+namespace Gluino::Fixtures {
+
+inline constexpr unsigned char Stored[] = {
+	0x01, 0xc8, 0x00, 0x37, 0xff, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x69, 0x6d, 0x65,
+	0x72, 0x20, 0x69, 0x6e, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x74, 0x74,
+	0x6c, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x20, 0x77, 0x65, 0x62, 0x76,
+	0x69, 0x65, 0x77, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x20, 0x71, 0x75, 0x65,
+	0x75, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20,
+	0x6f, 0x66, 0x20, 0x67, 0x6c, 0x75, 0x69, 0x6e, 0x6f, 0x20, 0x61, 0x20, 0x69, 0x6e, 0x66, 0x6c,
+	0x61, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x66, 0x6c,
+	0x61, 0x74, 0x65, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+	0x68, 0x65, 0x20, 0x77, 0x65, 0x62, 0x76, 0x69, 0x65, 0x77, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
+	0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+	0x74, 0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x74, 0x74, 0x6c,
+	0x65, 0x20, 0x77, 0x65, 0x62, 0x76, 0x69, 0x65, 0x77, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x66, 0x20,
+	0x69, 0x6e, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+};
+
+inline constexpr unsigned char Fixed[] = {
+	0x2b, 0xcf, 0x48, 0x4d, 0xcd, 0x51, 0x48, 0x54, 0x48, 0xcc, 0x4b, 0x51, 0x48, 0xcf, 0x29, 0xcd,
+	0xcc, 0xcb, 0x57, 0x28, 0xcf, 0xcc, 0x4b, 0xc9, 0x2f, 0x57, 0x28, 0xc9, 0xcc, 0x4d, 0x2d, 0x52,
+	0x28, 0x4f, 0x4d, 0x2a, 0xcb, 0x4c, 0x85, 0xf1, 0x4a, 0x32, 0x52, 0x15, 0x8a, 0x52, 0x8b, 0xf3,
+	0x4b, 0x8b, 0x92, 0x53, 0x81, 0x9c, 0xa2, 0xfc, 0x92, 0x92, 0x9c, 0x54, 0xa0, 0x6e, 0xa8, 0x4e,
+	0x90, 0x21, 0x10, 0x85, 0x50, 0x01, 0xb8, 0x5a, 0x28, 0x3f, 0x3f, 0x0d, 0xa8, 0x18, 0x64, 0x48,
+	0x66, 0x5e, 0x5a, 0x4e, 0x62, 0x49, 0xaa, 0x42, 0x39, 0xd8, 0x7a, 0x90, 0x08, 0x44, 0x1f, 0x50,
+	0x01, 0x54, 0x29, 0xcc, 0x42, 0xa8, 0x1d, 0x85, 0xa5, 0xa9, 0xa5, 0xa9, 0x60, 0xcd, 0x50, 0x01,
+	0xa0, 0x4a, 0x90, 0x36, 0xa8, 0x63, 0xcb, 0xa1, 0xde, 0x40, 0xe1, 0xc2, 0x4c, 0x42, 0x28, 0x43,
+	0xf5, 0x13, 0xd0, 0x08, 0xb8, 0x03, 0x13, 0x41, 0x3c, 0x98, 0xab, 0xe0, 0xa2, 0x70, 0x06, 0x58,
+	0x0b, 0x00,
+};
+
+inline constexpr unsigned char Dynamic[] = {
+	0x85, 0x59, 0x01, 0x92, 0xd3, 0x30, 0x0c, 0xfc, 0x4a, 0xbf, 0x26, 0xb8, 0x40, 0x3b, 0x53, 0xae,
+	0x43, 0xe9, 0x71, 0xc3, 0xef, 0x49, 0x62, 0x59, 0xda, 0x5d, 0xc9, 0x30, 0x70, 0x77, 0x4d, 0x63,
+	0x3b, 0xb2, 0xb4, 0x5a, 0xaf, 0x94, 0xe7, 0xf6, 0xeb, 0xf1, 0xf1, 0xfc, 0xba, 0x5d, 0x6e, 0xef,
+	0xdf, 0xee, 0xf6, 0xda, 0x2e, 0xaf, 0xdb, 0x8f, 0xed, 0x79, 0xb9, 0xdb, 0x9f, 0xfd, 0xf7, 0xcf,
+	0x8f, 0xed, 0x63, 0xf3, 0xcf, 0x9f, 0xb7, 0xf7, 0xb7, 0xc7, 0xe7, 0xe5, 0x39, 0xc7, 0x3f, 0xbe,
+	0xf9, 0xd0, 0x39, 0xf1, 0xf3, 0xba, 0x6d, 0xf7, 0x39, 0xcc, 0xde, 0xdf, 0xce, 0x9f, 0xf1, 0xe5,
+	0x3e, 0x76, 0x2c, 0x62, 0xc7, 0xc7, 0xf3, 0xfb, 0xed, 0xcb, 0xef, 0xdb, 0xf6, 0x79, 0xae, 0x72,
+	0xdd, 0xce, 0x9f, 0xef, 0xf7, 0x8f, 0xdb, 0xfb, 0xc3, 0x07, 0xc6, 0x63, 0x72, 0x11, 0xf3, 0xe7,
+	0xf9, 0xb8, 0x61, 0xdb, 0xeb, 0xfa, 0x7c, 0xbc, 0x5e, 0xf7, 0x6d, 0x5e, 0x9e, 0x23, 0x9e, 0xba,
+	0xa7, 0x71, 0x73, 0x5e, 0xc5, 0xed, 0xf3, 0xc9, 0xe7, 0x0c, 0xb7, 0x9a, 0x2e, 0x6c, 0xff, 0xe7,
+	0x4f, 0xde, 0x6d, 0xf0, 0xa7, 0x1e, 0x1f, 0x63, 0xfe, 0xdc, 0x44, 0x7c, 0x31, 0x6d, 0x1a, 0x66,
+	0x9b, 0x5f, 0xfb, 0xd4, 0x7d, 0xab, 0x64, 0xfa, 0x9c, 0x7d, 0x0c, 0x2f, 0x2b, 0x1d, 0xf3, 0x87,
+	0x35, 0x73, 0x95, 0x7d, 0x3a, 0xce, 0xc0, 0xd0, 0xd8, 0x34, 0xd9, 0xd7, 0xf7, 0x3f, 0xc5, 0xa9,
+	0x3e, 0x2a, 0x02, 0x36, 0x2e, 0x8f, 0x85, 0xc7, 0xa7, 0x31, 0x2a, 0xcd, 0xdd, 0xff, 0xbb, 0xa9,
+	0x78, 0x9f, 0xdd, 0x77, 0xec, 0x35, 0x9c, 0x23, 0x0e, 0x1f, 0x1b, 0x38, 0xd6, 0x3f, 0xdd, 0xe8,
+	0x46, 0xe8, 0x56, 0xf7, 0xfb, 0xea, 0x40, 0x0c, 0x43, 0xbd, 0x1d, 0x97, 0xbe, 0xfb, 0x03, 0x21,
+	0x33, 0x64, 0x69, 0xdc, 0xb9, 0x46, 0xc0, 0x03, 0x3e, 0x28, 0x1c, 0x8e, 0x38, 0x53, 0x58, 0x73,
+	0xac, 0xaf, 0x31, 0x67, 0x38, 0xc2, 0x7d, 0x03, 0x9c, 0x30, 0x26, 0xab, 0x8e, 0xb1, 0xe4, 0xbe,
+	0x09, 0x32, 0x5e, 0xbe, 0xf3, 0xcd, 0xb8, 0x1a, 0xbf, 0x21, 0x8a, 0x69, 0xcf, 0x5c, 0x91, 0x0c,
+	0xe2, 0xc7, 0x28, 0x16, 0xfc, 0xa1, 0x33, 0x31, 0xd1, 0xfd, 0xb1, 0xc0, 0xb9, 0x9c, 0xef, 0xe7,
+	0x00, 0x60, 0xf1, 0x1e, 0xe1, 0x08, 0x2d, 0x87, 0xf4, 0x46, 0x64, 0x4e, 0x88, 0x70, 0x7e, 0xcd,
+	0xc7, 0xf9, 0xdf, 0xc0, 0x37, 0x92, 0xce, 0xbc, 0x09, 0xd1, 0x85, 0x70, 0xcf, 0x44, 0x40, 0x42,
+	0x48, 0xbb, 0x31, 0x5a, 0xe0, 0x3e, 0xca, 0x46, 0xc1, 0xe6, 0xb8, 0x0c, 0x4b, 0x28, 0x0f, 0x7d,
+	0x86, 0x9a, 0x1d, 0x63, 0x04, 0x8f, 0x64, 0xd4, 0xc9, 0x6f, 0x14, 0xef, 0x09, 0x10, 0x8e, 0x78,
+	0xc6, 0x87, 0x02, 0x82, 0x8e, 0x2e, 0xe9, 0x9c, 0xe9, 0x06, 0x53, 0xfa, 0xb8, 0xcd, 0xbb, 0x85,
+	0x8a, 0xce, 0xe0, 0x9c, 0xcb, 0x17, 0xd2, 0x54, 0xb8, 0x86, 0xaf, 0x34, 0xff, 0xaa, 0x47, 0x06,
+	0x2b, 0x60, 0x38, 0xd3, 0x92, 0x36, 0x09, 0x10, 0xd3, 0x04, 0x95, 0xf3, 0x81, 0x69, 0xf5, 0x58,
+	0x6c, 0x90, 0xab, 0x64, 0xb8, 0x0f, 0x2a, 0xe4, 0x9c, 0x53, 0x84, 0x3d, 0x64, 0xbe, 0xe6, 0x9c,
+	0x29, 0xed, 0x37, 0xd8, 0x37, 0x49, 0x1d, 0x4a, 0xaa, 0x08, 0xda, 0xf1, 0x93, 0x66, 0x01, 0x2f,
+	0x04, 0xe4, 0xe3, 0x2c, 0xcd, 0x49, 0xa6, 0x67, 0x99, 0xee, 0xcf, 0xca, 0x2d, 0xc2, 0x37, 0x31,
+	0x4f, 0x6c, 0x52, 0x42, 0x47, 0x30, 0xb7, 0x64, 0x51, 0xe7, 0x15, 0x62, 0x17, 0xf0, 0x44, 0x3a,
+	0x33, 0xdd, 0x05, 0x50, 0xd4, 0x90, 0xc8, 0xa9, 0xba, 0x8f, 0x08, 0xea, 0x4c, 0x48, 0x83, 0x87,
+	0xd9, 0x95, 0x98, 0xef, 0x6c, 0x51, 0x12, 0x33, 0xb1, 0xfb, 0x58, 0x65, 0x3e, 0x42, 0xff, 0x12,
+	0xa2, 0xf8, 0xb8, 0x65, 0x48, 0x36, 0x27, 0x5f, 0xda, 0x98, 0x07, 0xbd, 0x04, 0x96, 0xc9, 0x57,
+	0x51, 0x1f, 0x71, 0xee, 0xd4, 0x84, 0xa5, 0x3a, 0x62, 0x8e, 0x48, 0x04, 0x17, 0x70, 0x37, 0x2c,
+	0x83, 0x44, 0x10, 0x30, 0xe3, 0xf3, 0x0d, 0x4d, 0x40, 0xc8, 0xe6, 0x2e, 0x81, 0x1d, 0xd8, 0x9d,
+	0xa2, 0xb7, 0x84, 0xa8, 0x50, 0xca, 0x60, 0xf6, 0xd0, 0xc1, 0x8c, 0x4e, 0xeb, 0x44, 0xa7, 0xc2,
+	0x07, 0xc3, 0x6d, 0xaa, 0x05, 0xac, 0xe8, 0xd2, 0x11, 0xca, 0x0d, 0x15, 0xa6, 0xec, 0x3c, 0xb7,
+	0xc9, 0x72, 0x05, 0x82, 0x84, 0x36, 0x56, 0x0a, 0x47, 0x80, 0xac, 0x68, 0x27, 0x33, 0xb9, 0xde,
+	0x4a, 0xcb, 0x8a, 0x04, 0xc3, 0xcc, 0x03, 0x52, 0x9c, 0xae, 0x38, 0xbf, 0x67, 0xa7, 0xd5, 0x63,
+	0x28, 0xf5, 0x27, 0x72, 0x9a, 0x8a, 0x3f, 0x27, 0xb0, 0x81, 0x39, 0xf2, 0x06, 0x24, 0x28, 0x65,
+	0x4b, 0x93, 0x65, 0x69, 0xff, 0x02, 0xf1, 0x64, 0x78, 0xd1, 0x53, 0x59, 0x2b, 0x28, 0x51, 0x11,
+	0x8b, 0x85, 0x35, 0x44, 0xe9, 0x2c, 0x6d, 0x49, 0x11, 0x24, 0xf6, 0xe7, 0x54, 0x56, 0x43, 0x94,
+	0xee, 0xc6, 0x09, 0xcf, 0x99, 0xb5, 0x62, 0x1c, 0x88, 0x21, 0x83, 0x08, 0xb5, 0x47, 0xe1, 0x1e,
+	0xb2, 0x3f, 0x14, 0x88, 0xde, 0x96, 0x1c, 0x33, 0x12, 0x5a, 0x79, 0x60, 0x97, 0x53, 0x17, 0x33,
+	0x0f, 0xe8, 0x94, 0x34, 0x65, 0x7f, 0xa8, 0xf4, 0xea, 0x43, 0xa1, 0x82, 0x19, 0x51, 0x21, 0xa1,
+	0x1f, 0x20, 0xff, 0x71, 0xbf, 0xb6, 0x96, 0x02, 0xb0, 0x6c, 0x0c, 0xdd, 0x1a, 0x59, 0xae, 0x52,
+	0x3b, 0xc9, 0x58, 0xf2, 0xb4, 0x29, 0x14, 0xa6, 0x4b, 0xb5, 0x6e, 0x44, 0xab, 0x83, 0xa5, 0x85,
+	0x6b, 0x56, 0x18, 0x33, 0xe2, 0x98, 0x33, 0x9d, 0xd8, 0x75, 0x91, 0x61, 0x0a, 0x6f, 0x3e, 0x20,
+	0xf1, 0x00, 0x41, 0x06, 0xcb, 0x74, 0x2b, 0xe2, 0x3d, 0x33, 0x0a, 0x59, 0x9b, 0x85, 0x8d, 0xf0,
+	0x79, 0xba, 0xbf, 0xa8, 0xfd, 0xad, 0x8b, 0x3e, 0x9c, 0x4f, 0x6c, 0x75, 0xd6, 0x4f, 0xa8, 0x5a,
+	0x54, 0x7f, 0x07, 0x28, 0x6b, 0xfd, 0xbb, 0xe4, 0x16, 0xca, 0x24, 0xe7, 0xc5, 0x06, 0xc5, 0x54,
+	0x2c, 0x82, 0xac, 0x32, 0x55, 0x37, 0x92, 0x77, 0x2d, 0x54, 0x4b, 0xf2, 0xa9, 0xc6, 0xe6, 0xcd,
+	0x87, 0xc0, 0xcb, 0xe2, 0x9c, 0xf9, 0x35, 0xfb, 0x16, 0xe8, 0x67, 0x54, 0x38, 0xa3, 0xc0, 0x56,
+	0x10, 0xfb, 0xd3, 0x95, 0x13, 0xd2, 0xd9, 0xf1, 0x64, 0x4c, 0x77, 0xaa, 0xdc, 0x3d, 0x90, 0x5d,
+	0xe5, 0xd7, 0x7d, 0xed, 0x86, 0x24, 0xc2, 0x82, 0x98, 0x8c, 0x63, 0xa4, 0x95, 0x13, 0x1d, 0x01,
+	0x02, 0x8a, 0xd0, 0xb5, 0x6d, 0x5d, 0x62, 0xd0, 0x7a, 0x21, 0x8d, 0x03, 0xf4, 0x16, 0x1c, 0x00,
+	0xa3, 0x30, 0xfa, 0x4d, 0x37, 0x87, 0x8b, 0xd4, 0x46, 0xb7, 0x96, 0xd3, 0x3a, 0x53, 0x8b, 0x52,
+	0x83, 0xdc, 0x99, 0x3d, 0xa0, 0x10, 0xfd, 0x81, 0x77, 0x16, 0x47, 0x88, 0x23, 0x2b, 0x52, 0x90,
+	0x2a, 0x61, 0xc6, 0x73, 0x95, 0x73, 0x92, 0xe1, 0x88, 0x35, 0x49, 0x6f, 0x14, 0xe2, 0xb5, 0x86,
+	0xa3, 0x73, 0x28, 0xe5, 0xd8, 0x28, 0xa0, 0x32, 0x1c, 0x4b, 0x8d, 0xa2, 0x4c, 0x13, 0x6c, 0x61,
+	0xb8, 0xb1, 0xa6, 0x75, 0x82, 0xf9, 0xec, 0x80, 0xcc, 0xc9, 0x6d, 0x35, 0x24, 0x75, 0x27, 0x35,
+	0x00, 0xdc, 0xe1, 0x61, 0x2f, 0x16, 0x10, 0x0d, 0x19, 0x96, 0x56, 0xe4, 0xf2, 0xcc, 0x91, 0x72,
+	0x6e, 0xd9, 0xdf, 0x80, 0x4c, 0x05, 0x40, 0x49, 0x45, 0x79, 0xa6, 0x8c, 0x94, 0x76, 0xac, 0x23,
+	0x78, 0x1f, 0x18, 0xe7, 0x44, 0x99, 0x30, 0x01, 0x69, 0x7b, 0x9e, 0x3f, 0x79, 0x7f, 0xdd, 0x93,
+	0x1d, 0xa9, 0xad, 0x92, 0x78, 0xa6, 0x16, 0xa9, 0x32, 0x9a, 0x67, 0x85, 0x80, 0x6a, 0x88, 0x79,
+	0xdb, 0x78, 0x58, 0x2d, 0xc5, 0x81, 0x94, 0x37, 0xb8, 0x02, 0x38, 0xd8, 0x8d, 0xa6, 0xb4, 0xb2,
+	0x3a, 0xa9, 0x63, 0x25, 0xae, 0xae, 0x1a, 0xa3, 0x45, 0xd3, 0x40, 0x97, 0x95, 0x49, 0x95, 0x2d,
+	0x8a, 0x05, 0x1d, 0xc9, 0x80, 0x49, 0xea, 0x68, 0xc1, 0x7a, 0x83, 0x6c, 0x41, 0x24, 0xf8, 0x17,
+	0x2b, 0xf6, 0x62, 0x22, 0xd0, 0x1e, 0x4c, 0x6d, 0x7c, 0x4b, 0x71, 0x14, 0xa8, 0x83, 0xac, 0xb4,
+	0x7a, 0xa8, 0xa9, 0x0e, 0x17, 0xc1, 0x94, 0xf6, 0x63, 0x38, 0x29, 0x75, 0xe3, 0xec, 0x2a, 0x58,
+	0xe4, 0x8c, 0xc2, 0xc6, 0x99, 0xe4, 0x9c, 0x35, 0x35, 0x8b, 0x15, 0xe6, 0x91, 0xd2, 0x12, 0x47,
+	0xa6, 0xa8, 0x5a, 0xd2, 0x95, 0x34, 0x67, 0x63, 0x5f, 0xdc, 0xee, 0xbf, 0xd6, 0x72, 0x11, 0x6e,
+	0x09, 0xc5, 0x06, 0x08, 0xa2, 0x93, 0x01, 0x58, 0xe7, 0xe6, 0x95, 0x0a, 0x7f, 0x3d, 0x83, 0x35,
+	0xb9, 0xac, 0xcc, 0xe8, 0x0e, 0xaa, 0x86, 0x2b, 0xe8, 0x5c, 0xc0, 0x50, 0xd5, 0x86, 0x1a, 0x9e,
+	0x13, 0x0c, 0x36, 0x94, 0x5b, 0x25, 0x51, 0x92, 0x11, 0xda, 0x4e, 0x19, 0x44, 0x1b, 0xf6, 0x95,
+	0x92, 0x84, 0xf3, 0x4d, 0x96, 0x28, 0x65, 0x48, 0x95, 0x75, 0x00, 0xc3, 0x75, 0xb7, 0x65, 0xd5,
+	0xb1, 0x44, 0xe9, 0xd0, 0xb2, 0x85, 0x9e, 0x02, 0x98, 0x6d, 0x0d, 0x15, 0xa3, 0xf8, 0xd2, 0x9a,
+	0x88, 0xf9, 0x7a, 0xeb, 0x72, 0x0c, 0x23, 0xe0, 0xa3, 0xb8, 0x74, 0xa0, 0x66, 0x93, 0x60, 0x34,
+	0x63, 0xdc, 0x34, 0x6e, 0xfe, 0xd9, 0xab, 0x5a, 0x25, 0x12, 0x97, 0xe6, 0xe2, 0x8a, 0x96, 0x80,
+	0x6c, 0x51, 0xd7, 0x82, 0x55, 0x6a, 0x1c, 0x06, 0xb3, 0xe9, 0xbf, 0x47, 0x2a, 0xe9, 0x92, 0x02,
+	0xa6, 0x72, 0x02, 0xea, 0xd1, 0x7f, 0x6d, 0x9b, 0x80, 0x49, 0xbd, 0x68, 0x41, 0x5e, 0xe3, 0x23,
+	0xaa, 0x04, 0x52, 0x34, 0x5d, 0x17, 0xa7, 0xf2, 0x22, 0x73, 0x04, 0xe3, 0x94, 0x35, 0x45, 0xce,
+	0x49, 0xbb, 0x04, 0x3a, 0x51, 0x0d, 0x96, 0x21, 0xb9, 0x0b, 0xc3, 0x70, 0x5a, 0xf2, 0x6b, 0x28,
+	0xde, 0xd8, 0x14, 0x81, 0x2d, 0x0b, 0x4b, 0xfc, 0x45, 0x63, 0xf9, 0xc9, 0xb6, 0x54, 0x38, 0xda,
+	0x1c, 0xe2, 0xba, 0x93, 0xa4, 0xaf, 0xf5, 0x6d, 0xe6, 0x46, 0x8e, 0x03, 0xf1, 0x77, 0x18, 0x2a,
+	0xeb, 0xa3, 0x7b, 0xf5, 0xcd, 0x25, 0x8a, 0x59, 0x2c, 0xa2, 0xb5, 0xf0, 0xd7, 0x77, 0xa3, 0xb5,
+	0xe7, 0x32, 0x1d, 0xad, 0xef, 0x28, 0xfe, 0xf7, 0x92, 0x19, 0x5f, 0xdd, 0xc8, 0xeb, 0xc1, 0xad,
+	0xbe, 0x5d, 0x28, 0x5a, 0x38, 0xdb, 0x77, 0x98, 0x84, 0xd2, 0x42, 0x28, 0xcd, 0xe7, 0x72, 0x3c,
+	0xda, 0xe5, 0x2f,
+};
+
+inline constexpr unsigned char FarMatch[] = {
+	0xed, 0xdd, 0x6f, 0x2b, 0xdc, 0x01, 0x00, 0xc0, 0xf1, 0x63, 0x0f, 0xc8, 0xd5, 0x1d, 0x96, 0xe6,
+	0x96, 0x27, 0x38, 0xb3, 0x5d, 0x9a, 0x63, 0x6d, 0x48, 0x6e, 0xcd, 0xc2, 0x3a, 0x51, 0xfe, 0x4c,
+	0x9b, 0x75, 0x0d, 0x31, 0x65, 0x4a, 0xd7, 0x49, 0x33, 0xca, 0x8d, 0x69, 0x9d, 0xc8, 0xdc, 0xb9,
+	0x1d, 0x6b, 0x34, 0xae, 0xb5, 0x75, 0x1b, 0xd1, 0x5a, 0xb3, 0x1b, 0x99, 0xcb, 0x75, 0xfa, 0x69,
+	0x74, 0x23, 0x96, 0xae, 0xd4, 0x34, 0xb6, 0x14, 0xbb, 0x1d, 0xa1, 0x99, 0xf6, 0x64, 0x2f, 0xc0,
+	0x0b, 0xf8, 0x7e, 0xde, 0xc8, 0x47, 0x76, 0xe7, 0x4f, 0x53, 0xfc, 0xe3, 0x66, 0x73, 0x7a, 0x76,
+	0x46, 0x7d, 0xdf, 0xa9, 0xca, 0xef, 0xef, 0x4c, 0xfa, 0x07, 0xe7, 0x04, 0x5f, 0xf0, 0xfd, 0xab,
+	0x52, 0x4d, 0x9b, 0xeb, 0xc7, 0xda, 0xd2, 0x2f, 0xdf, 0x65, 0x5d, 0x5d, 0x79, 0x91, 0x90, 0x72,
+	0x2d, 0xf3, 0xa4, 0xa4, 0x54, 0x62, 0x54, 0x3b, 0x0f, 0xbb, 0xa5, 0x17, 0x57, 0xce, 0xde, 0x54,
+	0x2d, 0xf7, 0xbb, 0x42, 0x93, 0xa6, 0x14, 0x72, 0xfb, 0xc2, 0x7c, 0xeb, 0xe7, 0x9c, 0x76, 0x3f,
+	0x5d, 0x41, 0xc7, 0xfe, 0xef, 0x03, 0xcf, 0x51, 0x5a, 0xf2, 0x68, 0x62, 0xcc, 0x70, 0xd3, 0x6d,
+	0x95, 0xec, 0xe3, 0xa2, 0xd1, 0x58, 0x75, 0x22, 0xd0, 0xa0, 0xf5, 0x18, 0x1f, 0x3e, 0xdb, 0x38,
+	0x6d, 0xa9, 0x96, 0x2b, 0x06, 0x07, 0xac, 0x9a, 0x9c, 0xb6, 0x6f, 0x86, 0x69, 0xe9, 0x4f, 0xdb,
+	0x85, 0x86, 0xd8, 0x0e, 0x51, 0x90, 0xf8, 0xca, 0xec, 0xa5, 0xb2, 0xb4, 0x58, 0x87, 0x2e, 0x2f,
+	0xac, 0xc5, 0x93, 0x9b, 0xe1, 0x55, 0xd4, 0x8a, 0xb5, 0xa9, 0xcf, 0xa3, 0x4a, 0x0a, 0x13, 0xe5,
+	0xab, 0xfe, 0x93, 0xce, 0xd2, 0xd1, 0xc6, 0x85, 0x5d, 0x49, 0xc5, 0x56, 0x61, 0x84, 0x32, 0xc0,
+	0x16, 0xbe, 0xdb, 0x1b, 0x23, 0x79, 0x6a, 0x53, 0x25, 0x89, 0xf4, 0x82, 0x6c, 0x5b, 0x3e, 0xa9,
+	0x71, 0xf4, 0xb8, 0x6a, 0xbe, 0x2c, 0x3f, 0xfa, 0x6a, 0xed, 0x7a, 0x73, 0xcb, 0x6d, 0xb5, 0xbb,
+	0xc7, 0x6e, 0x98, 0xa6, 0xd7, 0xcb, 0x84, 0xb9, 0xf4, 0x27, 0x2f, 0x46, 0x0e, 0xee, 0xee, 0x24,
+	0xc4, 0x29, 0xbb, 0x27, 0x8a, 0x83, 0x1d, 0x1f, 0x3a, 0x67, 0x22, 0x5f, 0xaa, 0xa3, 0x0c, 0x47,
+	0xf1, 0xc9, 0x66, 0x97, 0xb6, 0x6a, 0x73, 0xef, 0x6f, 0x84, 0xba, 0xb3, 0x52, 0x79, 0xbd, 0xce,
+	0x9c, 0x15, 0x19, 0x72, 0xfe, 0xbd, 0xfe, 0xd5, 0x27, 0xb5, 0xf8, 0xde, 0xdb, 0x71, 0x6f, 0x8f,
+	0xd7, 0xd7, 0xdc, 0x5e, 0x70, 0xd8, 0xf0, 0x5a, 0x10, 0xa4, 0x09, 0xf9, 0x43, 0xf6, 0x68, 0x8b,
+	0xc9, 0xb9, 0x5e, 0xee, 0x6f, 0xe9, 0x9f, 0x77, 0x3b, 0xb2, 0xce, 0x88, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x3f, 0x19, 0x57, 0xfc, 0xb1,
+	0xaf, 0xf8, 0x7f,
+};
+
+inline constexpr unsigned char Flushed[] = {
+	0x7c, 0x55, 0xd1, 0x52, 0xc4, 0x30, 0x08, 0xfc, 0x95, 0xfe, 0x5a, 0xf4, 0xa2, 0xe9, 0x4c, 0x6d,
+	0xc7, 0x9a, 0x7a, 0xe3, 0xdf, 0x9b, 0x04, 0x08, 0xbb, 0xd4, 0xf1, 0xe1, 0xda, 0x4b, 0x02, 0x61,
+	0x81, 0x65, 0x5b, 0xcb, 0x79, 0xd4, 0xba, 0xe5, 0x65, 0xdd, 0xdf, 0xb6, 0x54, 0xf3, 0xb2, 0xa5,
+	0x9f, 0x7c, 0x2e, 0x69, 0x7f, 0xcc, 0x9d, 0x67, 0x7e, 0xf9, 0x5e, 0xf3, 0xd3, 0xdf, 0xeb, 0xfe,
+	0x38, 0x7c, 0x59, 0x4b, 0x5e, 0xd2, 0x78, 0x9e, 0xf9, 0xeb, 0xb8, 0xce, 0xd7, 0xbe, 0xec, 0xfe,
+	0x73, 0xf9, 0xbe, 0x5d, 0xeb, 0x7e, 0x8c, 0xbd, 0xcf, 0x2b, 0x5f, 0x7e, 0xe3, 0xb4, 0xd0, 0x2b,
+	0x8f, 0xb7, 0xe6, 0xfa, 0x2c, 0x39, 0x6f, 0x4b, 0x5d, 0x3f, 0x1a, 0x0c, 0x33, 0x24, 0x38, 0x62,
+	0x4b, 0x01, 0x05, 0xb4, 0x78, 0x4a, 0x08, 0x79, 0xda, 0x6d, 0x88, 0x55, 0x6c, 0xe5, 0x5c, 0xb0,
+	0x63, 0x44, 0xf4, 0x56, 0x0c, 0x1a, 0x6f, 0x2c, 0x00, 0xa1, 0xa7, 0xd3, 0xff, 0xc9, 0xb1, 0x66,
+	0xea, 0xe9, 0x70, 0x1a, 0xba, 0x1a, 0xee, 0x11, 0x3b, 0x17, 0x55, 0x43, 0xf0, 0x61, 0xb5, 0x5e,
+	0xc9, 0xee, 0x5c, 0x6a, 0x54, 0xb9, 0x5d, 0xce, 0xe6, 0xed, 0x96, 0xa7, 0x9a, 0x62, 0xda, 0xea,
+	0x36, 0x4d, 0x1b, 0xdc, 0x5b, 0x63, 0x7a, 0x0a, 0xc5, 0x1b, 0x66, 0x3d, 0x98, 0xe7, 0x12, 0xd3,
+	0xb6, 0x9b, 0xb5, 0x39, 0x08, 0x62, 0x21, 0x02, 0xfe, 0x8c, 0x0b, 0xd8, 0x46, 0xab, 0x9a, 0xb4,
+	0x21, 0x64, 0xa5, 0x15, 0x30, 0x22, 0xf8, 0x39, 0x87, 0xf6, 0xed, 0xe2, 0x5c, 0x66, 0x13, 0xb9,
+	0x29, 0xd0, 0x48, 0x5f, 0x1a, 0xac, 0x97, 0xe0, 0x46, 0xa2, 0xb6, 0x19, 0x89, 0x1a, 0x47, 0xc3,
+	0xd6, 0xe8, 0xe6, 0x90, 0xad, 0x18, 0x38, 0x13, 0x7d, 0xc1, 0xb1, 0xe9, 0x68, 0x3a, 0xe1, 0x8d,
+	0xa1, 0xed, 0x5a, 0x6a, 0x98, 0x3a, 0xe6, 0x99, 0x3c, 0x53, 0xa4, 0x96, 0x5c, 0xdf, 0x9c, 0x91,
+	0xe4, 0x72, 0xf5, 0x60, 0x37, 0xf6, 0x3b, 0xc1, 0x3f, 0x85, 0x19, 0x53, 0x0f, 0x7c, 0x73, 0x66,
+	0x14, 0x68, 0x8a, 0xd7, 0x8f, 0xf9, 0xdd, 0x07, 0xa7, 0x98, 0x5e, 0x4c, 0x6b, 0x2a, 0xd4, 0xcc,
+	0x42, 0x3d, 0xff, 0x61, 0x2d, 0x8e, 0x97, 0x07, 0xb8, 0x43, 0x53, 0x89, 0xb3, 0x32, 0x21, 0x73,
+	0xa2, 0x0d, 0xfa, 0x4f, 0x4e, 0x1b, 0xa4, 0x16, 0x5a, 0xcc, 0x88, 0xaa, 0xc0, 0xe8, 0x61, 0x42,
+	0xec, 0x0e, 0xf3, 0x14, 0xdf, 0x13, 0x0b, 0x28, 0x48, 0xa1, 0xa2, 0xd2, 0x1c, 0xc7, 0x5e, 0x78,
+	0xb4, 0x90, 0x07, 0x29, 0x59, 0xd0, 0x86, 0x98, 0x05, 0x6b, 0xd8, 0xfd, 0x6a, 0xca, 0x27, 0xdd,
+	0x5b, 0x1b, 0x14, 0xa7, 0xe3, 0x9f, 0x42, 0x48, 0x85, 0x62, 0xd5, 0x40, 0xa0, 0x2c, 0xde, 0xae,
+	0x59, 0x62, 0x13, 0xc6, 0x80, 0x7b, 0xe4, 0x70, 0xe7, 0x1e, 0xab, 0x41, 0xd0, 0x8f, 0x28, 0xad,
+	0x83, 0x8e, 0x3e, 0x9b, 0x7f, 0xeb, 0x2f, 0xf5, 0x24, 0xcc, 0x45, 0x92, 0xa6, 0x19, 0x38, 0x80,
+	0x36, 0x92, 0x71, 0x8e, 0xe0, 0x37, 0x09, 0xa7, 0xdc, 0x15, 0x0d, 0x47, 0xba, 0x8f, 0xa6, 0xcb,
+	0xa7, 0x49, 0x65, 0x46, 0x6d, 0xa1, 0x0f, 0x55, 0xc2, 0xcf, 0x2d, 0x4c, 0x44, 0x20, 0x4e, 0xf9,
+	0x05, 0x00, 0x00, 0xff, 0xff, 0x7d, 0x55, 0x0b, 0x4e, 0xc3, 0x30, 0x0c, 0xbd, 0x4a, 0xae, 0x16,
+	0x98, 0x61, 0x95, 0x4a, 0x2b, 0x4a, 0xcb, 0xc4, 0xed, 0x49, 0xf2, 0xfc, 0x0f, 0x43, 0x9a, 0xda,
+	0xcc, 0x9f, 0x67, 0xfb, 0xc5, 0x76, 0x89, 0xd6, 0x72, 0xde, 0x8f, 0xfd, 0x3c, 0x57, 0x2a, 0x0f,
+	0x7a, 0xf9, 0x5e, 0xe8, 0x51, 0xaa, 0x9e, 0xf4, 0xbd, 0x6c, 0xb7, 0xfd, 0x51, 0xde, 0xd7, 0x6b,
+	0xd9, 0xf6, 0xa6, 0xdf, 0xdf, 0xfa, 0xaf, 0x96, 0x65, 0x7b, 0x5b, 0xeb, 0x49, 0xe5, 0x5c, 0x3e,
+	0xe8, 0x70, 0xfe, 0xd5, 0x40, 0xcf, 0x7b, 0x03, 0xbe, 0x53, 0x8b, 0xa3, 0xc6, 0xa2, 0x12, 0x01,
+	0xc3, 0xae, 0xf5, 0xa7, 0x81, 0x1c, 0xf4, 0xb5, 0x5f, 0xc7, 0x2b, 0xd9, 0x01, 0x72, 0xf5, 0xaa,
+	0xe5, 0xf3, 0xa2, 0xcb, 0xe9, 0x55, 0xd3, 0x52, 0x42, 0x22, 0x02, 0x9c, 0xcb, 0x80, 0xb6, 0x6e,
+	0xb7, 0x6e, 0x8a, 0xa4, 0x04, 0xad, 0x0b, 0x15, 0x91, 0x13, 0xe2, 0x17, 0x0c, 0x14, 0xbc, 0x5b,
+	0xc2, 0x57, 0xe8, 0x68, 0x02, 0x3e, 0xf6, 0x62, 0xf9, 0x28, 0x31, 0x73, 0xf6, 0xea, 0x1d, 0x30,
+	0x34, 0x74, 0x64, 0x5a, 0x72, 0x04, 0xc8, 0x5c, 0x86, 0xe5, 0x0e, 0x59, 0x8f, 0xaf, 0x50, 0x50,
+	0xc6, 0x8b, 0x10, 0x04, 0xbd, 0x94, 0x56, 0x96, 0x2b, 0x63, 0xc8, 0x91, 0x81, 0xc2, 0x08, 0x99,
+	0xa9, 0x90, 0x6e, 0xaa, 0x7f, 0xd2, 0x5d, 0x31, 0x84, 0x92, 0x8c, 0xa7, 0xb9, 0x8e, 0x5c, 0x61,
+	0x6a, 0x7c, 0x38, 0x64, 0xe9, 0x47, 0xc0, 0x84, 0x90, 0x9c, 0xec, 0xd4, 0x4b, 0xc6, 0xc1, 0x40,
+	0x8c, 0x7d, 0x8b, 0x50, 0xe2, 0x13, 0xee, 0x9f, 0x2d, 0xc0, 0x15, 0x9e, 0x2c, 0x92, 0x17, 0x43,
+	0xd9, 0x0d, 0xb1, 0xa0, 0x41, 0x44, 0x6a, 0x92, 0x03, 0x84, 0x56, 0xa5, 0x6b, 0x91, 0x54, 0x30,
+	0x3b, 0xd6, 0x2c, 0x77, 0x17, 0x83, 0x81, 0xf3, 0x59, 0xd6, 0xd4, 0xeb, 0xa1, 0x81, 0x73, 0xe3,
+	0xcb, 0xdd, 0x51, 0x9e, 0x1d, 0x4f, 0x3f, 0x8d, 0xc1, 0xd5, 0x21, 0x6e, 0x1a, 0x76, 0x1b, 0x71,
+	0xe0, 0xa8, 0xd1, 0xfe, 0xd0, 0xb9, 0xd6, 0x96, 0xf0, 0x0e, 0x39, 0x5d, 0xc9, 0xb3, 0x3b, 0x4f,
+	0x94, 0x4a, 0x8f, 0xfa, 0x68, 0x13, 0x3f, 0x21, 0x8b, 0x98, 0xa7, 0xe5, 0x3b, 0x6d, 0x39, 0x1d,
+	0x68, 0x6b, 0x1b, 0xb7, 0x52, 0xc8, 0xc6, 0xbe, 0x9a, 0x69, 0x2a, 0x0c, 0x8e, 0xcf, 0xf6, 0xc6,
+	0xd4, 0x39, 0x8a, 0x08, 0x77, 0xfb, 0xfb, 0xac, 0xc5, 0xdc, 0xce, 0x8b, 0x7b, 0x61, 0x0c, 0xdf,
+	0x88, 0x6e, 0xdc, 0xd8, 0xe8, 0x42, 0x33, 0x0d, 0x70, 0x18, 0x86, 0x39, 0x44, 0xab, 0xdf, 0x56,
+	0x4a, 0x5c, 0x35, 0xd2, 0x71, 0xf3, 0x1c, 0xd9, 0xa4, 0x7b, 0x2e, 0xbd, 0x05, 0x7c, 0x84, 0x12,
+	0x98, 0x4f, 0xd3, 0x1b, 0x79, 0xc5, 0x73, 0x62, 0xa3, 0xda, 0xa0, 0xa8, 0x23, 0xd0, 0x31, 0x1d,
+	0x4a, 0x45, 0xfc, 0xdc, 0x08, 0x65, 0x6e, 0xe9, 0x44, 0x32, 0xc3, 0xd4, 0xe7, 0x56, 0xd6, 0x48,
+	0x50, 0x04, 0xb0, 0xd4, 0xab, 0x6e, 0xb7, 0x8e, 0x96, 0x67, 0x42, 0x6b, 0xe8, 0x16, 0xb1, 0x4a,
+	0x7b, 0xac, 0xfe, 0xb3, 0xfe, 0x82, 0x5f, 0x9c, 0xdc, 0xb4, 0xaa, 0x8d, 0xa9, 0x94, 0xb6, 0x7c,
+	0x47, 0x74, 0xa3, 0x8a, 0xed, 0x2f,
+};
+
+}
+
+#endif // !GLUINO_INFLATE_FIXTURES_H
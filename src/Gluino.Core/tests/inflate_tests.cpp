@@ -0,0 +1,108 @@
+#include "test.h"
+#include "inflate_fixtures.h"
+#include "inflate.h"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+using namespace Gluino;
+
+namespace {
+
+class Lcg {
+public:
+	explicit Lcg(const uint32_t seed) : _state(seed) {}
+
+	uint32_t Next() {
+		_state = _state * 1103515245u + 12345u;
+		return _state >> 16;
+	}
+
+private:
+	uint32_t _state;
+};
+
+std::vector<char> MakeText(const uint32_t seed, const size_t size) {
+	static constexpr std::array<std::string_view, 14> words = {
+		"gluino", "window", "webview", "resource", "layer", "timer", "wheel",
+		"throttle", "queue", "inflate", "the", "a", "of", "and"
+	};
+
+	Lcg lcg(seed);
+	std::vector<char> text;
+	while (text.size() < size) {
+		const auto word = words[lcg.Next() % words.size()];
+		text.insert(text.end(), word.begin(), word.end());
+		text.push_back(' ');
+	}
+	text.resize(size);
+	return text;
+}
+
+std::vector<char> MakeRandom(const uint32_t seed, const size_t size) {
+	Lcg lcg(seed);
+	std::vector<char> data(size);
+	for (auto& byte : data)
+		byte = (char)(lcg.Next() & 0xff);
+	return data;
+}
+
+template <size_t N>
+bool InflatesTo(const unsigned char (&stream)[N], const std::vector<char>& expected) {
+	std::vector<char> output;
+	return Inflate((const char*)stream, N, expected.size(), &output) && output == expected;
+}
+
+}
+
+TEST(InflateStoredBlock) {
+	CHECK(InflatesTo(Fixtures::Stored, MakeText(1, 200)));
+}
+
+TEST(InflateFixedHuffmanBlock) {
+	CHECK(InflatesTo(Fixtures::Fixed, MakeText(2, 300)));
+}
+
+TEST(InflateDynamicHuffmanBlock) {
+	CHECK(InflatesTo(Fixtures::Dynamic, MakeText(3, 8192)));
+}
+
+TEST(InflateMatchAtWindowEdge) {
+	auto expected = MakeRandom(4, 300);
+	expected.resize(expected.size() + 32000);
+	const auto tail = MakeRandom(4, 300);
+	expected.insert(expected.end(), tail.begin(), tail.end());
+
+	CHECK(InflatesTo(Fixtures::FarMatch, expected));
+}
+
+TEST(InflateAcrossFlushedBlocks) {
+	CHECK(InflatesTo(Fixtures::Flushed, MakeText(5, 4096)));
+}
+
+TEST(InflateRejectsSizeMismatch) {
+	const auto expected = MakeText(3, 8192);
+	std::vector<char> output;
+	CHECK(!Inflate((const char*)Fixtures::Dynamic, sizeof Fixtures::Dynamic, expected.size() - 1, &output));
+	CHECK(!Inflate((const char*)Fixtures::Dynamic, sizeof Fixtures::Dynamic, expected.size() + 1, &output));
+}
+
+TEST(InflateRejectsTruncatedStream) {
+	const auto expected = MakeText(3, 8192);
+	for (const size_t size : { (size_t)0, (size_t)1, sizeof Fixtures::Dynamic / 2, sizeof Fixtures::Dynamic - 1 }) {
+		std::vector<char> output;
+		CHECK(!Inflate((const char*)Fixtures::Dynamic, size, expected.size(), &output));
+	}
+}
+
+TEST(InflateRejectsCorruptStream) {
+	// Block type 3 is reserved.
+	constexpr unsigned char reserved[] = { 0x07, 0x00 };
+	std::vector<char> output;
+	CHECK(!Inflate((const char*)reserved, sizeof reserved, 1, &output));
+
+	// A stored block whose length does not match its one's complement.
+	constexpr unsigned char stored[] = { 0x01, 0x01, 0x00, 0x00, 0x00, 'x' };
+	CHECK(!Inflate((const char*)stored, sizeof stored, 1, &output));
+}
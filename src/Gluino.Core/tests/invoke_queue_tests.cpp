@@ -0,0 +1,109 @@
+#include "test.h"
+#include "invoke_queue.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Gluino;
+
+TEST(InvokeQueueRunsInOrder) {
+	InvokeQueue queue;
+	CHECK(queue.IsEmpty());
+
+	std::vector<int> order;
+	CHECK(queue.Push([&] { order.push_back(1); }));
+	CHECK(!queue.Push([&] { order.push_back(2); }));
+	CHECK(!queue.Push([&] { order.push_back(3); }));
+	CHECK(!queue.IsEmpty());
+
+	CHECK(!queue.Drain());
+	CHECK(queue.IsEmpty());
+	CHECK((order == std::vector{ 1, 2, 3 }));
+
+	// The wakeup is requested again once the queue has been drained.
+	CHECK(queue.Push([] {}));
+	queue.Drain();
+}
+
+TEST(InvokeQueueDrainsInBatches) {
+	InvokeQueue queue;
+	auto ran = 0;
+	for (auto i = 0; i < 10; ++i)
+		queue.Push([&] { ++ran; });
+
+	CHECK(queue.Drain(4));
+	CHECK(ran == 4);
+	CHECK(!queue.Push([&] { ++ran; }));
+	CHECK(!queue.Drain());
+	CHECK(ran == 11);
+}
+
+TEST(InvokeQueueTakesTasksPushedWhileDraining) {
+	InvokeQueue queue;
+	auto ran = 0;
+	queue.Push([&] {
+		++ran;
+		queue.Push([&] { ++ran; });
+	});
+
+	queue.Drain();
+	CHECK(ran == 2);
+	CHECK(queue.IsEmpty());
+}
+
+TEST(InvokeQueueKeepsEachProducerInOrder) {
+	constexpr auto producers = 4;
+	constexpr auto tasksPerProducer = 20000;
+
+	InvokeQueue queue;
+	std::vector<int> last(producers, -1);
+	auto outOfOrder = 0;
+	auto ran = 0;
+
+	std::vector<std::thread> threads;
+	for (auto p = 0; p < producers; ++p) {
+		threads.emplace_back([&, p] {
+			for (auto i = 0; i < tasksPerProducer; ++i) {
+				queue.Push([&, p, i] {
+					if (i != last[p] + 1) ++outOfOrder;
+					last[p] = i;
+					++ran;
+				});
+			}
+		});
+	}
+
+	while (ran < producers * tasksPerProducer)
+		queue.Drain();
+	for (auto& thread : threads)
+		thread.join();
+
+	CHECK(outOfOrder == 0);
+	CHECK(queue.IsEmpty());
+}
+
+TEST(InvokeQueueReportsPendingWorkToOtherThreads) {
+	InvokeQueue queue;
+	std::atomic<bool> done = false;
+	std::atomic<int> seenPending = 0;
+
+	std::thread observer([&] {
+		while (!done) {
+			if (!queue.IsEmpty())
+				++seenPending;
+		}
+	});
+
+	auto ran = 0;
+	for (auto i = 0; i < 1000; ++i) {
+		queue.Push([&] { ++ran; });
+		CHECK(!queue.IsEmpty());
+		queue.Drain();
+		CHECK(queue.IsEmpty());
+	}
+
+	done = true;
+	observer.join();
+	CHECK(ran == 1000);
+}
@@ -0,0 +1,269 @@
+#include "test.h"
+#include "temp_directory.h"
+#include "loopback_server.h"
+#include "vfs.h"
+#include "websocket.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace Gluino;
+
+namespace {
+
+// A blocking HTTP/1.1 client for one connection to the server.
+class Client {
+public:
+	explicit Client(const int port) {
+		_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+		timeval timeout{ 5, 0 };
+		setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof timeout);
+
+		sockaddr_in address{};
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		address.sin_port = htons((uint16_t)port);
+		_connected = connect(_socket, (sockaddr*)&address, sizeof address) == 0;
+	}
+
+	~Client() { close(_socket); }
+
+	[[nodiscard]] bool IsConnected() const { return _connected; }
+
+	bool Send(const std::string& data) const {
+		return send(_socket, data.data(), data.size(), MSG_NOSIGNAL) == (ssize_t)data.size();
+	}
+
+	// Reads until the server closes the connection.
+	std::string ReceiveAll() const {
+		std::string received;
+		char chunk[64 * 1024];
+		for (ssize_t count; (count = recv(_socket, chunk, sizeof chunk, 0)) > 0;)
+			received.append(chunk, (size_t)count);
+		return received;
+	}
+
+	std::string Receive(const size_t size) const {
+		std::string received;
+		char chunk[4096];
+		while (received.size() < size) {
+			const auto count = recv(_socket, chunk, std::min(sizeof chunk, size - received.size()), 0);
+			if (count <= 0)
+				break;
+			received.append(chunk, (size_t)count);
+		}
+		return received;
+	}
+
+private:
+	int _socket;
+	bool _connected;
+};
+
+std::string Request(const LoopbackServer& server, const std::string& method, const std::string& path, const std::string& headers = {}, const std::string& body = {}) {
+	const Client client(server.GetPort());
+	client.Send(method + " /" + server.GetToken() + "/" + path + " HTTP/1.1\r\n"
+		"Host: 127.0.0.1:" + std::to_string(server.GetPort()) + "\r\n" +
+		headers + "Connection: close\r\n"
+		"Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body);
+	return client.ReceiveAll();
+}
+
+std::string GetStatusLine(const std::string& response) {
+	return response.substr(0, response.find("\r\n"));
+}
+
+std::string GetBody(const std::string& response) {
+	const auto end = response.find("\r\n\r\n");
+	return end == std::string::npos ? std::string() : response.substr(end + 4);
+}
+
+std::string MaskFrame(const WebSocketOpcode opcode, const std::string& payload) {
+	auto frame = EncodeWebSocketHeader(opcode, payload.size());
+	frame[1] = (char)(frame[1] | 0x80);
+
+	constexpr char mask[4] = { 0x12, 0x34, 0x56, 0x78 };
+	frame.append(mask, 4);
+	for (size_t i = 0; i < payload.size(); ++i)
+		frame.push_back((char)(payload[i] ^ mask[i % 4]));
+	return frame;
+}
+
+struct HostState {
+	std::mutex Mutex;
+	std::condition_variable Changed;
+	std::string Request;
+	int Socket = 0;
+	std::string SocketPath;
+	std::string Message;
+	bool Closed = false;
+
+	template <typename Predicate>
+	bool WaitFor(Predicate predicate) {
+		std::unique_lock lock(Mutex);
+		return Changed.wait_for(lock, std::chrono::seconds(5), predicate);
+	}
+} host;
+
+void OnRequest(const LoopbackRequest* request, LoopbackResponse* response) {
+	std::lock_guard lock(host.Mutex);
+	host.Request = std::string(request->Method) + " " + request->Path + " " +
+		std::string((const char*)request->Body, (size_t)request->BodyLength);
+
+	if (std::string_view(request->Path) == "echo") {
+		response->StatusCode = 200;
+		response->ContentType = "text/plain";
+		response->Body.assign((const char*)request->Body, (const char*)request->Body + request->BodyLength);
+	}
+}
+
+void OnSocketOpen(const int connectionId, const char* path) {
+	std::lock_guard lock(host.Mutex);
+	host.Socket = connectionId;
+	host.SocketPath = path;
+	host.Changed.notify_all();
+}
+
+void OnSocketMessage(int, const void* data, const int size, bool) {
+	std::lock_guard lock(host.Mutex);
+	host.Message.assign((const char*)data, (size_t)size);
+	host.Changed.notify_all();
+}
+
+void OnSocketClose(int) {
+	std::lock_guard lock(host.Mutex);
+	host.Closed = true;
+	host.Changed.notify_all();
+}
+
+const LoopbackServerEvents Events{
+	(LoopbackRequestDelegate*)OnRequest,
+	(LoopbackSocketDelegate*)OnSocketOpen,
+	(LoopbackMessageDelegate*)OnSocketMessage,
+	(LoopbackCloseDelegate*)OnSocketClose
+};
+
+}
+
+TEST(LoopbackServesRoutedResources) {
+	const Test::TempDirectory directory;
+	const std::string large(3 * 1024 * 1024 + 17, 'L');
+	directory.Write("root/app.js", "console.log(1)");
+	directory.Write("root/large.bin", large);
+
+	Vfs vfs;
+	vfs.AddLayer(std::make_unique<DirectoryLayer>(directory.GetRoot()), 0);
+
+	LoopbackServer server(&Events);
+	CHECK(server.Start());
+	CHECK(server.GetBaseUrl() == "http://127.0.0.1:" + std::to_string(server.GetPort()) + "/" + server.GetToken() + "/");
+	server.GetResourceRouter()->Mount("assets/", &vfs);
+
+	const auto script = Request(server, "GET", "assets/app.js");
+	CHECK(GetStatusLine(script) == "HTTP/1.1 200 OK");
+	CHECK(script.find("Content-Type: text/javascript") != std::string::npos);
+	CHECK(GetBody(script) == "console.log(1)");
+
+	const auto partial = Request(server, "GET", "assets/app.js", "Range: bytes=0-6\r\n");
+	CHECK(GetStatusLine(partial) == "HTTP/1.1 206 Partial Content");
+	CHECK(partial.find("Content-Range: bytes 0-6/14\r\n") != std::string::npos);
+	CHECK(GetBody(partial) == "console");
+
+	const auto head = Request(server, "HEAD", "assets/app.js");
+	CHECK(head.find("Content-Length: 14\r\n") != std::string::npos);
+	CHECK(GetBody(head).empty());
+
+	// Large files are read from disk in chunks as they are sent.
+	CHECK(GetBody(Request(server, "GET", "assets/large.bin")) == large);
+
+	server.Stop();
+}
+
+TEST(LoopbackRejectsUnauthorizedRequests) {
+	LoopbackServer server(&Events);
+	CHECK(server.Start());
+
+	const auto port = std::to_string(server.GetPort());
+	const auto send = [&](const std::string& request) {
+		const Client client(server.GetPort());
+		client.Send(request);
+		return GetStatusLine(client.ReceiveAll());
+	};
+
+	CHECK(send("GET /wrong-token/echo HTTP/1.1\r\nHost: 127.0.0.1:" + port + "\r\n\r\n") == "HTTP/1.1 403 Forbidden");
+	CHECK(send("GET /" + server.GetToken() + "x/echo HTTP/1.1\r\nHost: 127.0.0.1:" + port + "\r\n\r\n") == "HTTP/1.1 403 Forbidden");
+	CHECK(send("GET /" + server.GetToken() + "/echo HTTP/1.1\r\nHost: evil.example:" + port + "\r\n\r\n") == "HTTP/1.1 403 Forbidden");
+	CHECK(send("POST /" + server.GetToken() + "/echo HTTP/1.1\r\nHost: localhost:" + port + "\r\nTransfer-Encoding: chunked\r\n\r\n") == "HTTP/1.1 501 Not Implemented");
+	CHECK(send("GARBAGE\r\n\r\n") == "HTTP/1.1 400 Bad Request");
+
+	server.Stop();
+}
+
+TEST(LoopbackForwardsRequestsToHost) {
+	LoopbackServer server(&Events);
+	CHECK(server.Start());
+
+	const auto echo = Request(server, "POST", "echo", "Content-Type: text/plain\r\n", "ping");
+	CHECK(GetStatusLine(echo) == "HTTP/1.1 200 OK");
+	CHECK(GetBody(echo) == "ping");
+	{
+		std::lock_guard lock(host.Mutex);
+		CHECK(host.Request == "POST echo ping");
+	}
+
+	CHECK(GetStatusLine(Request(server, "GET", "unknown")) == "HTTP/1.1 404 Not Found");
+
+	const auto preflight = Request(server, "OPTIONS", "echo", "Origin: http://app\r\nAccess-Control-Request-Headers: content-type\r\n");
+	CHECK(GetStatusLine(preflight) == "HTTP/1.1 204 No Content");
+	CHECK(preflight.find("Access-Control-Allow-Origin: http://app\r\n") != std::string::npos);
+	CHECK(preflight.find("Access-Control-Allow-Headers: content-type\r\n") != std::string::npos);
+
+	server.Stop();
+}
+
+TEST(LoopbackBridgesWebSocketMessages) {
+	LoopbackServer server(&Events);
+	CHECK(server.Start());
+
+	const Client client(server.GetPort());
+	CHECK(client.IsConnected());
+	client.Send("GET /" + server.GetToken() + "/stream/ticks HTTP/1.1\r\n"
+		"Host: 127.0.0.1:" + std::to_string(server.GetPort()) + "\r\n"
+		"Upgrade: websocket\r\nConnection: Upgrade\r\n"
+		"Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n");
+
+	const std::string expected = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+		"Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n\r\n";
+	CHECK(client.Receive(expected.size()) == expected);
+	CHECK(host.WaitFor([] { return host.Socket != 0; }));
+	CHECK(host.SocketPath == "stream/ticks");
+
+	// Page to host, in two fragments.
+	auto first = MaskFrame(WebSocketOpcode::Text, "hel");
+	first[0] = (char)(first[0] & 0x7F);
+	client.Send(first + MaskFrame(WebSocketOpcode::Continuation, "lo"));
+	CHECK(host.WaitFor([] { return host.Message == "hello"; }));
+
+	// Host to page, unmasked.
+	CHECK(server.Send(host.Socket, "tick", 4, false));
+	CHECK(client.Receive(6) == EncodeWebSocketHeader(WebSocketOpcode::Text, 4) + "tick");
+
+	client.Send(MaskFrame(WebSocketOpcode::Ping, "p"));
+	CHECK(client.Receive(3) == EncodeWebSocketHeader(WebSocketOpcode::Pong, 1) + "p");
+
+	client.Send(MaskFrame(WebSocketOpcode::Close, ""));
+	CHECK(host.WaitFor([] { return host.Closed; }));
+	CHECK(!server.Send(host.Socket, "late", 4, false));
+
+	server.Stop();
+}
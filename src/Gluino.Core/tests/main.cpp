@@ -0,0 +1,18 @@
+#include "test.h"
+
+using namespace Gluino;
+
+int main() {
+	auto failed = 0;
+	for (const auto& [name, run] : Test::GetCases()) {
+		const auto before = Test::GetFailures();
+		run();
+
+		const auto passed = Test::GetFailures() == before;
+		if (!passed) ++failed;
+		std::printf("[%s] %s\n", passed ? "PASS" : "FAIL", name);
+	}
+
+	std::printf("%zu tests, %d failed\n", Test::GetCases().size(), failed);
+	return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+#include "test.h"
+#include "temp_directory.h"
+#include "prefetcher.h"
+#include "vfs.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <set>
+#include <thread>
+
+using namespace Gluino;
+using namespace std::chrono_literals;
+
+namespace {
+
+class RecordingHandler final : public ResourceHandler {
+public:
+	explicit RecordingHandler(const std::chrono::milliseconds delay = {}) : _delay(delay) {}
+	~RecordingHandler() override { Detach(); }
+
+	bool HandleRequest(const ResourceQuery&, std::string_view, ResourceResult*) override { return false; }
+
+	bool Prefetch(std::string_view) override {
+		++_running;
+		{
+			std::lock_guard lock(_mutex);
+			_threads.insert(std::this_thread::get_id());
+		}
+		std::this_thread::sleep_for(_delay);
+		--_running;
+		++_count;
+		return true;
+	}
+
+	[[nodiscard]] int GetCount() const { return _count; }
+	[[nodiscard]] int GetRunning() const { return _running; }
+
+	[[nodiscard]] size_t GetThreadCount() {
+		std::lock_guard lock(_mutex);
+		return _threads.size();
+	}
+
+private:
+	std::chrono::milliseconds _delay;
+	std::atomic<int> _count = 0;
+	std::atomic<int> _running = 0;
+	std::mutex _mutex;
+	std::set<std::thread::id> _threads;
+};
+
+bool WaitFor(const std::function<bool()>& condition) {
+	for (auto i = 0; i < 500 && !condition(); ++i)
+		std::this_thread::sleep_for(10ms);
+	return condition();
+}
+
+}
+
+TEST(PrefetchersShareOneWorkerPool) {
+	constexpr auto prefetcherCount = 64;
+	constexpr auto urlCount = 8;
+
+	RecordingHandler handler;
+	ResourceRouter router;
+	router.Mount("app://", &handler);
+
+	std::vector<std::string> urls;
+	for (auto i = 0; i < urlCount; ++i)
+		urls.push_back("app://asset" + std::to_string(i));
+
+	std::vector<std::unique_ptr<Prefetcher>> prefetchers;
+	for (auto i = 0; i < prefetcherCount; ++i) {
+		auto& prefetcher = prefetchers.emplace_back(std::make_unique<Prefetcher>(&router));
+		prefetcher->SetManifest("app://page", urls);
+		prefetcher->Prefetch("app://page?tab=1");
+	}
+
+	CHECK(WaitFor([&] { return handler.GetCount() == prefetcherCount * urlCount; }));
+	CHECK(handler.GetThreadCount() <= Prefetcher::MaxWorkers);
+}
+
+TEST(PrefetcherWaitsForRunningPrefetchesWhenDestroyed) {
+	RecordingHandler handler(20ms);
+	ResourceRouter router;
+	router.Mount("app://", &handler);
+
+	auto prefetcher = std::make_unique<Prefetcher>(&router);
+	prefetcher->SetManifest("app://*", { "app://a", "app://b", "app://c", "app://d" });
+	prefetcher->Prefetch("app://page");
+
+	CHECK(WaitFor([&] { return handler.GetRunning() > 0; }));
+	prefetcher.reset();
+	CHECK(handler.GetRunning() == 0);
+
+	// Queued prefetches of a destroyed prefetcher are dropped.
+	const auto count = handler.GetCount();
+	std::this_thread::sleep_for(100ms);
+	CHECK(handler.GetCount() == count);
+}
+
+TEST(PrefetchedDirectoryFilesStayCurrent) {
+	const Test::TempDirectory directory;
+	directory.Write("root/app.js", "one");
+
+	Vfs vfs;
+	vfs.AddLayer(std::make_unique<DirectoryLayer>(directory.GetRoot()), 0);
+	CHECK(vfs.Prefetch("app.js"));
+
+	directory.Write("root/app.js", "two");
+	const auto blob = vfs.Open("app.js");
+	CHECK(blob && std::string_view(blob->GetData(), blob->GetSize()) == "two");
+}
@@ -0,0 +1,169 @@
+#include "test.h"
+#include "temp_directory.h"
+#include "resource_router.h"
+#include "vfs.h"
+
+#include <string>
+#include <string_view>
+
+using namespace Gluino;
+
+namespace {
+
+// Answers with its name and records the decoded path it was asked for.
+class NamedHandler final : public ResourceHandler {
+public:
+	explicit NamedHandler(std::string name, const bool accept = true) : _name(std::move(name)), _accept(accept) {}
+	~NamedHandler() override { Detach(); }
+
+	bool HandleRequest(const ResourceQuery&, const std::string_view path, ResourceResult* result) override {
+		LastPath = path;
+		if (!_accept)
+			return false;
+
+		result->ContentType = _name;
+		return true;
+	}
+
+	std::string LastPath;
+
+private:
+	std::string _name;
+	bool _accept;
+};
+
+std::string ReadContent(const ResourceResult& result) {
+	std::string content(result.Length, '\0');
+	content.resize(result.Blob ? result.Blob->Read(result.Offset, content.data(), content.size()) : 0);
+	return content;
+}
+
+std::string RouteTo(ResourceRouter& router, const std::string& url) {
+	ResourceResult result;
+	return router.Route({ url, "GET", {}, {} }, &result) ? result.ContentType : std::string();
+}
+
+}
+
+TEST(ResourceRouterPrefersLongestPrefix) {
+	NamedHandler root("root");
+	NamedHandler assets("assets");
+	NamedHandler declining("declining", false);
+
+	ResourceRouter router;
+	router.Mount("app://", &root);
+	router.Mount("app://assets/", &assets);
+	router.Mount("app://assets/lazy/", &declining);
+
+	CHECK(RouteTo(router, "app://index.html") == "root");
+	CHECK(RouteTo(router, "app://assets/logo.png") == "assets");
+	CHECK(RouteTo(router, "other://assets/logo.png").empty());
+
+	// A handler that declines a request passes it on to the next shorter prefix.
+	CHECK(RouteTo(router, "app://assets/lazy/chunk.js") == "assets");
+	CHECK(declining.LastPath == "chunk.js");
+
+	// Mounting a prefix again replaces its handler.
+	router.Mount("app://assets/", &root);
+	CHECK(RouteTo(router, "app://assets/logo.png") == "root");
+
+	router.Unmount("app://assets/");
+	router.Unmount(&root);
+	CHECK(RouteTo(router, "app://index.html").empty());
+	CHECK(RouteTo(router, "app://assets/lazy/chunk.js").empty());
+}
+
+TEST(ResourceRouterDecodesPaths) {
+	NamedHandler handler("handler");
+	ResourceRouter router;
+	router.Mount("app://", &handler);
+
+	RouteTo(router, "app://docs/read%20me.txt");
+	CHECK(handler.LastPath == "docs/read me.txt");
+}
+
+TEST(ResourceRouterUnlinksDetachedHandlers) {
+	ResourceRouter first;
+	ResourceRouter second;
+	{
+		NamedHandler handler("handler");
+		first.Mount("app://", &handler);
+		second.Mount("app://", &handler);
+		second.Mount("data://", &handler);
+		CHECK(RouteTo(second, "data://x") == "handler");
+	}
+
+	// The handler unmounted itself from every router when it was destroyed.
+	CHECK(RouteTo(first, "app://x").empty());
+	CHECK(RouteTo(second, "data://x").empty());
+
+	// A router destroyed first leaves nothing for the handler to unmount.
+	NamedHandler handler("handler");
+	{
+		ResourceRouter router;
+		router.Mount("app://", &handler);
+	}
+	handler.Detach();
+}
+
+TEST(VfsServesLayersByPriority) {
+	const Test::TempDirectory directory;
+	directory.Write("root/index.html", "<html>disk</html>");
+	directory.Write("root/app.js", "disk");
+
+	Vfs vfs;
+	vfs.AddLayer(std::make_unique<DirectoryLayer>(directory.GetRoot()), 0);
+	const auto overlay = (OverlayLayer*)vfs.AddLayer(std::make_unique<OverlayLayer>(), 10);
+	overlay->Put("app.js", "memory", 6);
+
+	ResourceRouter router;
+	router.Mount("app://", &vfs);
+
+	ResourceResult index;
+	CHECK(router.Route({ "app://", "GET", {}, {} }, &index));
+	CHECK(index.ContentType == "text/html");
+	CHECK(ReadContent(index) == "<html>disk</html>");
+
+	ResourceResult script;
+	// Dot segments are dropped rather than resolved, so a path cannot climb out of the root.
+	CHECK(router.Route({ "app://./../app.js", "GET", {}, {} }, &script));
+	CHECK(ReadContent(script) == "memory");
+
+	// Removing a file from the higher layer falls back to the one below.
+	overlay->Remove("app.js");
+	CHECK(router.Route({ "app://app.js", "GET", {}, {} }, &script));
+	CHECK(ReadContent(script) == "disk");
+
+	ResourceResult result;
+	CHECK(router.Route({ "app://app.js", "HEAD", {}, {} }, &result));
+	CHECK(!router.Route({ "app://app.js", "POST", {}, {} }, &result));
+	CHECK(!router.Route({ "app://missing.js", "GET", {}, {} }, &result));
+
+	vfs.RemoveLayer(overlay);
+	CHECK(router.Route({ "app://app.js", "GET", {}, {} }, &script));
+	CHECK(ReadContent(script) == "disk");
+}
+
+TEST(VfsServesRanges) {
+	Vfs vfs;
+	const auto overlay = (OverlayLayer*)vfs.AddLayer(std::make_unique<OverlayLayer>(), 0);
+	overlay->Put("data.bin", "abcdefghij", 10);
+
+	ResourceRouter router;
+	router.Mount("app://", &vfs);
+
+	ResourceResult partial;
+	CHECK(router.Route({ "app://data.bin", "GET", "bytes=3-6", {} }, &partial));
+	CHECK(partial.StatusCode == 206);
+	CHECK(ReadContent(partial) == "defg");
+	CHECK(partial.GetHeaders().find("Content-Range: bytes 3-6/10\r\n") != std::string::npos);
+
+	// A range past the end is clamped to the content.
+	ResourceResult clamped;
+	CHECK(router.Route({ "app://data.bin", "GET", "bytes=8-100", {} }, &clamped));
+	CHECK(ReadContent(clamped) == "ij");
+
+	ResourceResult unsatisfiable;
+	CHECK(router.Route({ "app://data.bin", "GET", "bytes=10-", {} }, &unsatisfiable));
+	CHECK(unsatisfiable.StatusCode == 416);
+}
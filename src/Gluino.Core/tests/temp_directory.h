@@ -0,0 +1,44 @@
+#pragma once
+
+#ifndef GLUINO_TEMP_DIRECTORY_H
+#define GLUINO_TEMP_DIRECTORY_H
+
+#include "resource.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+
+namespace Gluino::Test {
+
+// A uniquely named directory under the system temp directory, removed with its contents.
+class TempDirectory {
+public:
+	TempDirectory() : _path(std::filesystem::temp_directory_path() / ("gluino-test-" + GenerateToken(8))) {
+		std::filesystem::create_directories(_path / "root");
+	}
+
+	~TempDirectory() {
+		std::error_code ec;
+		std::filesystem::remove_all(_path, ec);
+	}
+
+	TempDirectory(const TempDirectory&) = delete;
+	TempDirectory& operator=(const TempDirectory&) = delete;
+
+	[[nodiscard]] const std::filesystem::path& GetPath() const { return _path; }
+	[[nodiscard]] std::string GetRoot() const { return (_path / "root").string(); }
+
+	void Write(const std::string& relative, const std::string_view content) const {
+		const auto path = _path / relative;
+		std::filesystem::create_directories(path.parent_path());
+		std::ofstream(path, std::ios::binary | std::ios::trunc).write(content.data(), (std::streamsize)content.size());
+	}
+
+private:
+	std::filesystem::path _path;
+};
+
+}
+
+#endif // !GLUINO_TEMP_DIRECTORY_H
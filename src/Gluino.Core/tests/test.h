@@ -0,0 +1,45 @@
+#pragma once
+
+#ifndef GLUINO_TEST_H
+#define GLUINO_TEST_H
+
+#include <cstdio>
+#include <vector>
+
+namespace Gluino::Test {
+
+struct Case {
+	const char* Name;
+	void (*Run)();
+};
+
+inline std::vector<Case>& GetCases() {
+	static std::vector<Case> cases;
+	return cases;
+}
+
+inline int& GetFailures() {
+	static int failures = 0;
+	return failures;
+}
+
+struct Registrar {
+	Registrar(const char* name, void (*run)()) { GetCases().push_back({ name, run }); }
+};
+
+}
+
+#define TEST(name) \
+	static void name(); \
+	static const Gluino::Test::Registrar name##Registrar(#name, name); \
+	static void name()
+
+#define CHECK(expr) \
+	do { \
+		if (!(expr)) { \
+			std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+			++Gluino::Test::GetFailures(); \
+		} \
+	} while (false)
+
+#endif // !GLUINO_TEST_H
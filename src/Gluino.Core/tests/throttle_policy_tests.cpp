@@ -0,0 +1,70 @@
+#include "test.h"
+#include "throttle_policy.h"
+
+using namespace Gluino;
+using namespace std::chrono_literals;
+
+namespace {
+
+const ThrottlePolicy::Clock::time_point Start{};
+
+}
+
+TEST(ThrottleStartsActive) {
+	const ThrottlePolicy policy;
+	CHECK(policy.GetLevel() == ThrottleLevel::Active);
+	CHECK(!policy.GetDeadline());
+}
+
+TEST(ThrottleHiddenWindowWithoutDelayNeverSuspends) {
+	ThrottlePolicy policy;
+	CHECK(policy.SetVisible(false, Start) == ThrottleLevel::Throttled);
+	CHECK(!policy.GetDeadline());
+	CHECK(policy.Update(Start + 24h) == ThrottleLevel::Throttled);
+	CHECK(policy.SetVisible(true, Start + 24h) == ThrottleLevel::Active);
+}
+
+TEST(ThrottleSuspendsAfterDelay) {
+	ThrottlePolicy policy;
+	policy.SetSuspendDelay(10s, Start);
+	CHECK(policy.SetMinimized(true, Start) == ThrottleLevel::Throttled);
+	CHECK(policy.GetDeadline() == Start + 10s);
+	CHECK(policy.Update(Start + 9s) == ThrottleLevel::Throttled);
+	CHECK(policy.Update(Start + 10s) == ThrottleLevel::Suspended);
+	CHECK(!policy.GetDeadline());
+	CHECK(policy.SetMinimized(false, Start + 11s) == ThrottleLevel::Active);
+}
+
+TEST(ThrottleKeepsBackgroundTimeAcrossHideAndMinimize) {
+	ThrottlePolicy policy;
+	policy.SetSuspendDelay(10s, Start);
+	policy.SetVisible(false, Start);
+	CHECK(policy.SetMinimized(true, Start + 5s) == ThrottleLevel::Throttled);
+	CHECK(policy.SetVisible(true, Start + 6s) == ThrottleLevel::Throttled);
+	CHECK(policy.GetDeadline() == Start + 10s);
+	CHECK(policy.Update(Start + 10s) == ThrottleLevel::Suspended);
+}
+
+TEST(ThrottleDelayChangesApplyInBackground) {
+	ThrottlePolicy policy;
+	policy.SetVisible(false, Start);
+	policy.SetSuspendDelay(5s, Start + 6s);
+	CHECK(policy.GetLevel() == ThrottleLevel::Suspended);
+
+	policy.SetSuspendDelay(-1s, Start + 7s);
+	CHECK(policy.GetLevel() == ThrottleLevel::Throttled);
+	CHECK(!policy.GetDeadline());
+}
+
+TEST(ThrottleDisabledStaysActive) {
+	ThrottlePolicy policy;
+	policy.SetSuspendDelay(1s, Start);
+	policy.SetEnabled(false, Start);
+	CHECK(policy.SetVisible(false, Start) == ThrottleLevel::Active);
+	CHECK(policy.Update(Start + 1h) == ThrottleLevel::Active);
+
+	// Enabling it again restarts the background time.
+	policy.SetEnabled(true, Start + 2h);
+	CHECK(policy.GetLevel() == ThrottleLevel::Throttled);
+	CHECK(policy.GetDeadline() == Start + 2h + 1s);
+}
@@ -0,0 +1,156 @@
+#include "test.h"
+#include "timer_wheel.h"
+
+#include <vector>
+
+using namespace Gluino;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Clock = TimerWheel::Clock;
+
+struct Probe {
+	Clock::duration Due;
+	Clock::time_point Earliest;
+	Clock::time_point Latest;
+	std::optional<Clock::time_point> FiredAt;
+	int Runs = 0;
+};
+
+// Schedules one timer per due time; each records the time passed to the Advance that fired it.
+std::vector<Probe> ScheduleProbes(TimerWheel& wheel, const std::vector<Clock::duration>& dues, Clock::time_point* now) {
+	std::vector<Probe> probes(dues.size());
+	for (size_t i = 0; i < dues.size(); ++i) {
+		auto& probe = probes[i];
+		probe.Due = dues[i];
+		probe.Earliest = Clock::now() + probe.Due;
+		wheel.Schedule(probe.Due, [&probe, now] {
+			probe.FiredAt = *now;
+			++probe.Runs;
+		});
+		// Deadlines are rounded up to whole ticks, both for the schedule time and the delay.
+		probe.Latest = Clock::now() + probe.Due + 2 * TimerWheel::Resolution;
+	}
+	return probes;
+}
+
+}
+
+TEST(TimerWheelCascadesThroughEveryLevel) {
+	TimerWheel wheel;
+	Clock::time_point now;
+
+	// One tick is 250us: these land in levels 0 through 3 of the 64-slot wheel.
+	auto probes = ScheduleProbes(wheel, { 1ms, 15ms, 100ms, 900ms, 2s, 10s, 70s, 200s }, &now);
+	const auto start = Clock::now();
+
+	// Steps stay below the idle jump threshold so that every slot boundary is crossed.
+	constexpr auto step = 250ms;
+	for (now = start; now < start + 201s; now += step) {
+		wheel.Advance(now);
+		for (const auto& probe : probes) {
+			if (probe.FiredAt)
+				continue;
+			CHECK(now < probe.Latest);
+		}
+	}
+
+	for (const auto& probe : probes) {
+		CHECK(probe.Runs == 1);
+		CHECK(probe.FiredAt && *probe.FiredAt >= probe.Earliest);
+	}
+	CHECK(wheel.GetCount() == 0);
+	CHECK(!wheel.GetNextDeadline());
+}
+
+TEST(TimerWheelJumpsOverIdleGaps) {
+	TimerWheel wheel;
+	Clock::time_point now;
+
+	auto probes = ScheduleProbes(wheel, { 5s, 30s, 90s, 3000s }, &now);
+	const auto start = Clock::now();
+
+	// Each Advance crosses far more ticks than the wheel has slots.
+	for (const auto offset : { 2s, 6s, 31s, 89s, 91s, 2999s, 3001s }) {
+		now = start + offset;
+		wheel.Advance(now);
+		for (const auto& probe : probes) {
+			if (probe.FiredAt)
+				CHECK(*probe.FiredAt >= probe.Earliest);
+			else
+				CHECK(now < probe.Latest);
+		}
+	}
+
+	for (const auto& probe : probes)
+		CHECK(probe.Runs == 1);
+	CHECK(wheel.GetCount() == 0);
+}
+
+TEST(TimerWheelNextDeadlineFollowsEarliestTimer) {
+	TimerWheel wheel;
+	Clock::time_point now;
+
+	auto probes = ScheduleProbes(wheel, { 50s, 2s }, &now);
+	const auto deadline = wheel.GetNextDeadline();
+	CHECK(deadline && *deadline >= probes[1].Earliest && *deadline < probes[1].Latest);
+
+	now = *deadline;
+	CHECK(wheel.Advance(now) == 1);
+	CHECK(probes[1].Runs == 1);
+
+	const auto next = wheel.GetNextDeadline();
+	CHECK(next && *next >= probes[0].Earliest && *next < probes[0].Latest);
+}
+
+TEST(TimerWheelRepeatsPeriodicTimers) {
+	TimerWheel wheel;
+	auto runs = 0;
+	const auto id = wheel.Schedule(10ms, [&] { ++runs; }, 10ms);
+	const auto start = Clock::now();
+
+	for (auto now = start; now <= start + 1s; now += 1ms)
+		wheel.Advance(now);
+	CHECK(runs >= 99 && runs <= 101);
+
+	// Periods missed between two Advance calls are not replayed one by one.
+	const auto before = runs;
+	wheel.Advance(start + 60s);
+	CHECK(runs == before + 1);
+
+	CHECK(wheel.Cancel(id));
+	wheel.Advance(start + 120s);
+	CHECK(runs == before + 1);
+	CHECK(wheel.GetCount() == 0);
+}
+
+TEST(TimerWheelSkipsCancelledTimers) {
+	TimerWheel wheel;
+	auto fired = 0;
+	const auto cancelled = wheel.Schedule(3s, [&] { fired += 10; });
+	wheel.Schedule(3s, [&] { ++fired; });
+	CHECK(wheel.Cancel(cancelled));
+	CHECK(!wheel.Cancel(cancelled));
+
+	wheel.Advance(Clock::now() + 4s);
+	CHECK(fired == 1);
+}
+
+TEST(TimerWheelHoldsSuspendedOwners) {
+	TimerWheel wheel;
+	auto fired = 0;
+	const auto owner = &fired;
+	wheel.Schedule(1s, [&] { ++fired; }, {}, owner);
+	wheel.Suspend(owner);
+
+	const auto start = Clock::now();
+	wheel.Advance(start + 5s);
+	CHECK(fired == 0);
+	CHECK(!wheel.GetNextDeadline());
+
+	// Its deadline passed while suspended, so it fires on the next tick after resuming.
+	wheel.Resume(owner);
+	wheel.Advance(start + 5s + 1ms);
+	CHECK(fired == 1);
+}
@@ -0,0 +1,73 @@
+#include "test.h"
+#include "temp_directory.h"
+#include "vfs.h"
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+using namespace Gluino;
+
+namespace {
+
+bool Contains(const std::shared_ptr<const ResourceBlob>& blob, const std::string_view content) {
+	if (!blob)
+		return false;
+
+	std::string data(blob->GetSize(), '\0');
+	data.resize(blob->Read(0, data.data(), data.size()));
+	return data == content;
+}
+
+}
+
+TEST(DirectoryLayerServesFilesUnderRoot) {
+	const Test::TempDirectory directory;
+	directory.Write("root/index.html", "<html>");
+	directory.Write("root/js/app.js", "app");
+
+	DirectoryLayer layer(directory.GetRoot());
+	CHECK(Contains(layer.Open("index.html"), "<html>"));
+	CHECK(Contains(layer.Open("js/app.js"), "app"));
+	CHECK(!layer.Open("missing.js"));
+	CHECK(!layer.Open("js"));
+}
+
+TEST(DirectoryLayerStaysWithinRoot) {
+	const Test::TempDirectory directory;
+	directory.Write("secret.txt", "secret");
+	directory.Write("root-sibling/file.txt", "sibling");
+
+	DirectoryLayer layer(directory.GetRoot());
+	CHECK(!layer.Open("../secret.txt"));
+	CHECK(!layer.Open("js/../../secret.txt"));
+	CHECK(!layer.Open("../root-sibling/file.txt"));
+	CHECK(!layer.Open((directory.GetPath() / "secret.txt").string()));
+}
+
+TEST(DirectoryLayerStreamsLargeFiles) {
+	const Test::TempDirectory directory;
+	const std::string content(2 * 1024 * 1024, 'x');
+	directory.Write("root/video.mp4", content);
+
+	DirectoryLayer layer(directory.GetRoot());
+	const auto blob = layer.Open("video.mp4");
+	CHECK(Contains(blob, content));
+	CHECK(blob && blob->GetData() == nullptr);
+
+	// A file truncated while it is served only ends the read early.
+	std::filesystem::resize_file(directory.GetPath() / "root/video.mp4", 1000);
+	std::string buffer(4096, '\0');
+	CHECK(blob && blob->Read(0, buffer.data(), buffer.size()) == 1000);
+	CHECK(blob && blob->Read(1024 * 1024, buffer.data(), buffer.size()) == 0);
+}
+
+#ifndef _WIN32
+TEST(DirectoryLayerServesColonsInNames) {
+	const Test::TempDirectory directory;
+	directory.Write("root/chunk:1.js", "chunk");
+
+	DirectoryLayer layer(directory.GetRoot());
+	CHECK(Contains(layer.Open("chunk:1.js"), "chunk"));
+}
+#endif
@@ -0,0 +1,110 @@
+#include "test.h"
+#include "headless_options.h"
+#include "app.h"
+
+#include <string>
+
+using namespace Gluino;
+using namespace Gluino::Test;
+
+TEST(WindowPoolTracksWarmingAndReadyEntries) {
+	WindowPool pool;
+	CHECK(pool.GetDeficit() == 0);
+
+	pool.SetCapacity(3);
+	CHECK(pool.GetCapacity() == 3);
+	CHECK(pool.GetDeficit() == 3);
+
+	pool.AddWarming({ 1, 1 });
+	pool.AddWarming({ 2, 2 });
+	CHECK(pool.GetDeficit() == 1);
+
+	CHECK(pool.MarkReady(1, true));
+	CHECK(!pool.MarkReady(1, true));
+	CHECK(!pool.MarkReady(99, true));
+	CHECK(pool.GetReadyCount() == 1);
+	CHECK(pool.GetDeficit() == 1);
+
+	// A webview that fails to initialise stops refills until the capacity is set again.
+	CHECK(!pool.MarkReady(2, false));
+	CHECK(pool.GetReadyCount() == 1);
+	CHECK(pool.GetDeficit() == 0);
+	pool.SetCapacity(3);
+	CHECK(pool.GetDeficit() == 2);
+
+	// Handles that no longer resolve are dropped rather than handed out.
+	WindowPool::Entry entry;
+	CHECK(!pool.Acquire(&entry));
+	CHECK(pool.GetReadyCount() == 0);
+	CHECK(pool.GetDeficit() == 3);
+
+	pool.SetCapacity(-1);
+	CHECK(pool.GetCapacity() == 0);
+}
+
+TEST(WindowPoolTrimsNewestReadyEntriesWhenShrinking) {
+	WindowPool pool;
+	pool.SetCapacity(4);
+	for (WindowHandle handle = 1; handle <= 4; ++handle)
+		pool.AddWarming({ handle, handle });
+	for (WindowHandle handle = 1; handle <= 3; ++handle)
+		pool.MarkReady(handle, true);
+
+	pool.SetCapacity(2);
+	const auto removed = pool.Trim();
+	CHECK(removed.size() == 2);
+	CHECK(removed.size() == 2 && removed[0].Window == 3 && removed[1].Window == 2);
+	CHECK(pool.GetReadyCount() == 1);
+	CHECK(pool.GetDeficit() == 0);
+
+	// Warming entries are left alone; they are released once they become ready.
+	pool.SetCapacity(0);
+	CHECK(pool.Trim().size() == 1);
+	CHECK(pool.GetReadyCount() == 0);
+	CHECK(pool.Trim().empty());
+}
+
+TEST(WindowPoolRefillsOnIdleLoop) {
+	App app((char*)"window-pool-tests");
+	const auto pool = app.GetWindowPool();
+
+	app.SetWindowPoolSize(2);
+	CHECK(pool->GetReadyCount() == 0);
+
+	// Pairs are warmed one per idle period and become ready on a later turn of the loop.
+	for (auto i = 0; i < 100 && pool->GetReadyCount() < 2; ++i)
+		app.RunOnce(0);
+	CHECK(pool->GetReadyCount() == 2);
+	CHECK(pool->GetDeficit() == 0);
+	CHECK(WindowRegistry.GetCount() == 2);
+
+	// A spawn on the loop that warmed the pool takes a ready pair, and the pool refills behind it.
+	SpawnOptions options;
+	options.Window.TitleA = (char*)"Pooled";
+	WindowBase* window = nullptr;
+	WebViewBase* webView = nullptr;
+	app.SpawnWindow(&options.Window, &options.WindowEvents, &options.WebView, &options.WebViewEvents, nullptr, &window, &webView);
+	CHECK(window != nullptr && webView != nullptr);
+	CHECK(pool->GetReadyCount() == 1);
+	CHECK(WindowRegistry.GetCount() == 2);
+	const auto title = window->GetTitle();
+	CHECK(std::string(title) == "Pooled");
+	delete[] title;
+
+	for (auto i = 0; i < 100 && pool->GetReadyCount() < 2; ++i)
+		app.RunOnce(0);
+	CHECK(pool->GetReadyCount() == 2);
+	CHECK(WindowRegistry.GetCount() == 3);
+
+	// Shrinking closes the surplus ready pairs.
+	app.SetWindowPoolSize(0);
+	CHECK(pool->GetReadyCount() == 0);
+	for (auto i = 0; i < 10; ++i)
+		app.RunOnce(0);
+	CHECK(WindowRegistry.GetCount() == 1);
+	CHECK(WindowRegistry.Get(window->GetRegistryHandle()) == window);
+
+	window->Close();
+	app.RunOnce(0);
+	CHECK(WindowRegistry.GetCount() == 0);
+}
@@ -1,4 +1,5 @@
 ﻿using Gluino.Interop;
+using System.Collections.Concurrent;
 using System.Reflection;
 using System.Runtime.InteropServices;
 
@@ -12,11 +13,16 @@ public static class App
     internal static readonly nint AppHInstance;
     internal static readonly nint NativeInstance;
 
+    private static readonly NativeIdleDelegate IdleCallback = RunIdleTask;
+    private static readonly NativeArgumentsDelegate InstanceLaunchedCallback = OnInstanceLaunched;
+    private static readonly ConcurrentDictionary<int, IdleTask> IdleTasks = new();
+    private static int _nextIdleTaskId;
+
     static App()
     {
         AppHInstance = NativeLibrary.GetMainProgramHandle();
 
-        if (Platform.IsWindows) {
+        if (Platform.IsWindows || Platform.IsLinux) {
             NativeInstance = NativeApp.Create(AppHInstance, GetAppId());
         }
         else {
@@ -54,6 +60,21 @@ public static class App
     /// Blocks the thread until the exited.
     /// </remarks>
     public static void Run(Window mainWindow)
+    {
+        Start(mainWindow);
+
+        NativeApp.Run(NativeInstance);
+    }
+
+    /// <summary>
+    /// Starts the application with the specified <see cref="Window"/> as the main window, without running the event loop.
+    /// </summary>
+    /// <param name="mainWindow">The main <see cref="Window"/> to start with.</param>
+    /// <exception cref="InvalidOperationException">The application is already running.</exception>
+    /// <remarks>
+    /// Use together with <see cref="RunOnce"/> to drive the application from a host event loop on the calling thread.
+    /// </remarks>
+    public static void Start(Window mainWindow)
     {
         if (MainWindow != null)
             throw new InvalidOperationException("The application is already running");
@@ -61,8 +82,155 @@ public static class App
         MainWindow = mainWindow;
         MainWindow.IsMain = true;
         MainWindow.Show();
+    }
 
-        NativeApp.Run(NativeInstance);
+    /// <summary>
+    /// Processes the pending work of the application's event loop, waiting for work if there is none.
+    /// </summary>
+    /// <param name="millisecondsTimeout">
+    /// The maximum time to wait for work, in milliseconds. 0 returns immediately, <see cref="Timeout.Infinite"/> waits indefinitely.
+    /// </param>
+    /// <returns>false if the application has exited; otherwise, true.</returns>
+    /// <remarks>
+    /// Must be called on the thread that called <see cref="Start"/>.
+    /// </remarks>
+    public static bool RunOnce(int millisecondsTimeout = 0) => NativeApp.RunOnce(NativeInstance, millisecondsTimeout);
+
+    /// <summary>
+    /// Gets whether the application's event loop has work waiting to be processed by <see cref="RunOnce"/>.
+    /// </summary>
+    /// <remarks>
+    /// Can be read from any thread. Pending window input is only reported on the thread that runs the loop;
+    /// on other threads only posted invokes are.
+    /// </remarks>
+    public static bool HasPendingWork => NativeApp.HasPendingWork(NativeInstance);
+
+    /// <summary>
+    /// Gets a native handle that becomes signaled when work is posted to the application's event loop.
+    /// </summary>
+    /// <remarks>
+    /// An event HANDLE on Windows and an eventfd on Linux, for a host to wait on alongside its own I/O.
+    /// Window input is not reported through the handle. On Windows, wait with MsgWaitForMultipleObjects to include it;
+    /// on Linux, GTK and display server input only reaches the GLib main context, so also poll its file descriptors
+    /// or call <see cref="RunOnce"/> with a short timeout.
+    /// </remarks>
+    public static nint WakeHandle => NativeApp.GetWakeHandle(NativeInstance);
+
+    /// <summary>
+    /// Gets or sets the longest time idle tasks may run for before the UI loop checks for new input.
+    /// </summary>
+    /// <remarks>
+    /// Default: 4 milliseconds
+    /// </remarks>
+    public static TimeSpan IdleBudget {
+        get => TimeSpan.FromMicroseconds(NativeApp.GetIdleBudget(NativeInstance));
+        set => NativeApp.SetIdleBudget(NativeInstance, (int)value.TotalMicroseconds);
+    }
+
+    /// <summary>
+    /// Gets or sets the granularity that timer deadlines on the application's UI loop are rounded up to.
+    /// </summary>
+    /// <remarks>
+    /// A larger slack lets more timers expire together and wake the loop less often.
+    /// Default: 250 microseconds
+    /// </remarks>
+    public static TimeSpan TimerSlack {
+        get => TimeSpan.FromMicroseconds(NativeApp.GetTimerSlack(NativeInstance));
+        set => NativeApp.SetTimerSlack(NativeInstance, (int)value.TotalMicroseconds);
+    }
+
+    /// <summary>
+    /// Gets or sets the number of hidden, fully initialized windows kept ready for windows shown on the application's UI loop.
+    /// </summary>
+    /// <remarks>
+    /// Showing a window takes a ready one from the pool instead of creating a window and WebView, and the pool is refilled
+    /// while the loop is idle. Windows with a <see cref="Window.UiThread"/> are always created from scratch.<br />
+    /// Default: 0
+    /// </remarks>
+    public static int WindowPoolSize {
+        get => NativeApp.GetWindowPoolSize(NativeInstance);
+        set => NativeApp.SetWindowPoolSize(NativeInstance, value);
+    }
+
+    /// <summary>
+    /// Queues low-priority work to run on the application's UI loop while no input, paint or invoke messages are pending.
+    /// </summary>
+    /// <param name="task">
+    /// The work to run. Receives the <see cref="IdleDeadline"/> of the current idle period and returns true if it has
+    /// more work, in which case it is resumed in a later idle period.
+    /// </param>
+    /// <returns>An identifier that can be passed to <see cref="CancelIdle"/>.</returns>
+    public static int PostIdle(Func<IdleDeadline, bool> task)
+    {
+        ArgumentNullException.ThrowIfNull(task);
+
+        var id = Interlocked.Increment(ref _nextIdleTaskId);
+        var idleTask = new IdleTask(task);
+        IdleTasks[id] = idleTask;
+        idleTask.NativeId = NativeApp.PostIdle(NativeInstance, IdleCallback, id);
+        return id;
+    }
+
+    /// <summary>
+    /// Cancels idle work queued with <see cref="PostIdle"/>.
+    /// </summary>
+    /// <param name="id">The identifier returned by <see cref="PostIdle"/>.</param>
+    /// <returns>true if the work was still queued; otherwise, false.</returns>
+    public static bool CancelIdle(int id)
+    {
+        if (!IdleTasks.TryRemove(id, out var idleTask))
+            return false;
+
+        NativeApp.CancelIdle(NativeInstance, idleTask.NativeId);
+        return true;
+    }
+
+    private static bool RunIdleTask(nint context, int remainingMicroseconds)
+    {
+        var id = (int)context;
+        if (!IdleTasks.TryGetValue(id, out var idleTask))
+            return false;
+
+        if (idleTask.Task(new(remainingMicroseconds)))
+            return true;
+
+        IdleTasks.TryRemove(id, out _);
+        return false;
+    }
+
+    /// <summary>
+    /// Occurs on the application's UI loop when another launch of the application has forwarded its arguments.
+    /// </summary>
+    /// <seealso cref="RequestSingleInstance"/>
+    public static event EventHandler<InstanceLaunchedEventArgs> InstanceLaunched;
+
+    /// <summary>
+    /// Makes this process the single instance of the application, or hands the arguments to the instance already running.
+    /// </summary>
+    /// <param name="args">The command line arguments to forward if another instance is running.</param>
+    /// <returns>
+    /// true if this process is the primary instance and should continue; false if the arguments were forwarded
+    /// and this process should exit.
+    /// </returns>
+    /// <remarks>
+    /// Instances are identified by the application id, derived from the entry assembly's company, product and title,
+    /// and are separate per user. Launches forwarded later are reported through <see cref="InstanceLaunched"/>.<br />
+    /// Call before <see cref="Run"/>, ideally first thing in Main.
+    /// </remarks>
+    public static bool RequestSingleInstance(string[] args)
+    {
+        ArgumentNullException.ThrowIfNull(args);
+
+        return NativeApp.RequestSingleInstance(NativeInstance, args, args.Length, InstanceLaunchedCallback);
+    }
+
+    private static void OnInstanceLaunched(nint args, int count)
+    {
+        var values = new string[count];
+        for (var i = 0; i < count; i++)
+            values[i] = Marshal.PtrToStringAuto(Marshal.ReadIntPtr(args, i * nint.Size)) ?? string.Empty;
+
+        InstanceLaunched?.Invoke(null, new(values));
     }
 
     /// <summary>
@@ -92,4 +260,10 @@ public static class App
 
         return string.IsNullOrEmpty(id) || string.IsNullOrWhiteSpace(id) ? Name : id;
     }
+
+    private sealed class IdleTask(Func<IdleDeadline, bool> task)
+    {
+        public readonly Func<IdleDeadline, bool> Task = task;
+        public int NativeId;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,13 @@
+﻿namespace Gluino;
+
+/// <summary>
+/// Represents the event data for the <see cref="App.InstanceLaunched"/> event.
+/// </summary>
+/// <param name="args">The command line arguments of the launch.</param>
+public class InstanceLaunchedEventArgs(IReadOnlyList<string> args) : EventArgs
+{
+    /// <summary>
+    /// Gets the command line arguments of the launch.
+    /// </summary>
+    public IReadOnlyList<string> Args { get; } = args;
+}
\ No newline at end of file
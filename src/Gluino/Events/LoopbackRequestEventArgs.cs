@@ -0,0 +1,19 @@
+﻿namespace Gluino;
+
+/// <summary>
+/// Represents the event data for the <see cref="LoopbackServer.RequestReceived"/> event.
+/// </summary>
+/// <param name="request">The request.</param>
+/// <param name="response">The response to fill.</param>
+public class LoopbackRequestEventArgs(LoopbackRequest request, LoopbackResponse response) : EventArgs
+{
+    /// <summary>
+    /// Gets the request.
+    /// </summary>
+    public LoopbackRequest Request { get; } = request;
+
+    /// <summary>
+    /// Gets the response.
+    /// </summary>
+    public LoopbackResponse Response { get; } = response;
+}
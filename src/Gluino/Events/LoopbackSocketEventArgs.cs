@@ -0,0 +1,45 @@
+﻿namespace Gluino;
+
+/// <summary>
+/// Represents the event data for the WebSocket events of a <see cref="LoopbackServer"/>.
+/// </summary>
+/// <param name="connectionId">The identifier of the connection.</param>
+/// <param name="path">The path the connection was opened on, relative to <see cref="LoopbackServer.BaseUrl"/>.</param>
+public class LoopbackSocketEventArgs(int connectionId, string path) : EventArgs
+{
+    /// <summary>
+    /// Gets the identifier of the connection.
+    /// </summary>
+    public int ConnectionId { get; } = connectionId;
+
+    /// <summary>
+    /// Gets the path the connection was opened on.
+    /// </summary>
+    public string Path { get; } = path;
+}
+
+/// <summary>
+/// Represents the event data for the <see cref="LoopbackServer.SocketMessageReceived"/> event.
+/// </summary>
+/// <param name="connectionId">The identifier of the connection.</param>
+/// <param name="path">The path the connection was opened on.</param>
+/// <param name="data">The payload of the message.</param>
+/// <param name="isBinary">Whether the message is binary.</param>
+public class LoopbackMessageEventArgs(int connectionId, string path, byte[] data, bool isBinary)
+    : LoopbackSocketEventArgs(connectionId, path)
+{
+    /// <summary>
+    /// Gets the payload of the message.
+    /// </summary>
+    public byte[] Data { get; } = data;
+
+    /// <summary>
+    /// Gets whether the message is binary.
+    /// </summary>
+    public bool IsBinary { get; } = isBinary;
+
+    /// <summary>
+    /// Gets the payload of a text message.
+    /// </summary>
+    public string Text => System.Text.Encoding.UTF8.GetString(Data);
+}
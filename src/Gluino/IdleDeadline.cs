@@ -0,0 +1,31 @@
+﻿using System.Diagnostics;
+
+namespace Gluino;
+
+/// <summary>
+/// Represents the time an idle task may use in the current idle period.
+/// </summary>
+public readonly struct IdleDeadline
+{
+    private readonly long _deadline;
+
+    internal IdleDeadline(int remainingMicroseconds)
+    {
+        _deadline = Stopwatch.GetTimestamp() + remainingMicroseconds * Stopwatch.Frequency / 1_000_000;
+    }
+
+    /// <summary>
+    /// Gets the time left before the task should return and yield to the UI loop.
+    /// </summary>
+    public TimeSpan TimeRemaining {
+        get {
+            var remaining = Stopwatch.GetElapsedTime(Stopwatch.GetTimestamp(), _deadline);
+            return remaining > TimeSpan.Zero ? remaining : TimeSpan.Zero;
+        }
+    }
+
+    /// <summary>
+    /// Gets whether the idle period has ended.
+    /// </summary>
+    public bool IsExpired => TimeRemaining == TimeSpan.Zero;
+}
@@ -0,0 +1,13 @@
+﻿using System.Runtime.InteropServices;
+
+namespace Gluino.Interop;
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeLoopbackRequest
+{
+    public nint Method;
+    public nint Path;
+    public nint Headers;
+    public nint Body;
+    [MarshalAs(UnmanagedType.I4)] public int BodyLength;
+}
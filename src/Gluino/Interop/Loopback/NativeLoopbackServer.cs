@@ -0,0 +1,19 @@
+﻿using System.Text;
+
+namespace Gluino.Interop;
+
+[LibDetails("Gluino.Core")]
+internal partial class NativeLoopbackServer
+{
+    [LibImport("Gluino_Loopback_Create")] public static partial nint Create(ref NativeLoopbackServerEvents events);
+    [LibImport("Gluino_Loopback_Destroy")] public static partial void Destroy(nint server);
+    [LibImport("Gluino_Loopback_Start")] public static partial bool Start(nint server);
+    [LibImport("Gluino_Loopback_Stop")] public static partial void Stop(nint server);
+    [LibImport("Gluino_Loopback_GetPort")] public static partial int GetPort(nint server);
+    [LibImport("Gluino_Loopback_GetBaseUrl")] public static partial bool GetBaseUrl(nint server, StringBuilder url, int urlSize);
+    [LibImport("Gluino_Loopback_MountVfs")] public static partial void MountVfs(nint server, string prefix, nint vfs);
+    [LibImport("Gluino_Loopback_Unmount")] public static partial void Unmount(nint server, string prefix);
+    [LibImport("Gluino_Loopback_Send")] public static partial bool Send(nint server, int connectionId, byte[] data, int size, bool binary);
+    [LibImport("Gluino_Loopback_Close")] public static partial void Close(nint server, int connectionId);
+    [LibImport("Gluino_Loopback_Respond")] public static partial void Respond(nint response, int statusCode, string contentType, byte[] data, int size);
+}
@@ -0,0 +1,12 @@
+﻿using System.Runtime.InteropServices;
+
+namespace Gluino.Interop;
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeLoopbackServerEvents
+{
+    [MarshalAs(UnmanagedType.FunctionPtr)] public NativeLoopbackRequestDelegate OnRequest;
+    [MarshalAs(UnmanagedType.FunctionPtr)] public NativeLoopbackSocketDelegate OnSocketOpen;
+    [MarshalAs(UnmanagedType.FunctionPtr)] public NativeLoopbackMessageDelegate OnSocketMessage;
+    [MarshalAs(UnmanagedType.FunctionPtr)] public NativeIntDelegate OnSocketClose;
+}
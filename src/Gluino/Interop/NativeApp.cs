@@ -11,8 +11,29 @@ internal partial class NativeApp
     public static partial void SpawnWindow(nint app,
         ref NativeWindowOptions windowOptions, ref NativeWindowEvents windowEvents,
         ref NativeWebViewOptions webViewOptions, ref NativeWebViewEvents webViewEvents,
-        out nint window, out nint webView);
+        nint thread, out nint window, out nint webView);
+    [LibImport("Gluino_App_SpawnWindowAsync")]
+    public static partial void SpawnWindowAsync(nint app,
+        ref NativeWindowOptions windowOptions, ref NativeWindowEvents windowEvents,
+        ref NativeWebViewOptions webViewOptions, ref NativeWebViewEvents webViewEvents,
+        nint thread, NativeSpawnDelegate callback, nint context);
     [LibImport("Gluino_App_DespawnWindow")] public static partial void DespawnWindow(nint app, nint window);
     [LibImport("Gluino_App_Run")] public static partial void Run(nint app);
+    [LibImport("Gluino_App_RunOnce")] public static partial bool RunOnce(nint app, int timeout);
+    [LibImport("Gluino_App_HasPendingWork")] public static partial bool HasPendingWork(nint app);
+    [LibImport("Gluino_App_GetWakeHandle")] public static partial nint GetWakeHandle(nint app);
+    [LibImport("Gluino_App_PostIdle")] public static partial int PostIdle(nint app, NativeIdleDelegate task, nint context);
+    [LibImport("Gluino_App_CancelIdle")] public static partial bool CancelIdle(nint app, int id);
+    [LibImport("Gluino_App_GetIdleBudget")] public static partial int GetIdleBudget(nint app);
+    [LibImport("Gluino_App_SetIdleBudget")] public static partial void SetIdleBudget(nint app, int budget);
+    [LibImport("Gluino_App_GetTimerSlack")] public static partial int GetTimerSlack(nint app);
+    [LibImport("Gluino_App_SetTimerSlack")] public static partial void SetTimerSlack(nint app, int slack);
+    [LibImport("Gluino_App_RequestSingleInstance")] public static partial bool RequestSingleInstance(nint app, string[] args, int count, NativeArgumentsDelegate callback);
+    [LibImport("Gluino_App_GetWindowPoolSize")] public static partial int GetWindowPoolSize(nint app);
+    [LibImport("Gluino_App_SetWindowPoolSize")] public static partial void SetWindowPoolSize(nint app, int size);
     [LibImport("Gluino_App_Exit")] public static partial void Exit(nint app);
+    [LibImport("Gluino_App_CreateUiThread")] public static partial nint CreateUiThread(nint app);
+    [LibImport("Gluino_App_DestroyUiThread")] public static partial void DestroyUiThread(nint app, nint thread);
+    [LibImport("Gluino_UiThread_GetTimerSlack")] public static partial int GetUiThreadTimerSlack(nint thread);
+    [LibImport("Gluino_UiThread_SetTimerSlack")] public static partial void SetUiThreadTimerSlack(nint thread, int slack);
 }
\ No newline at end of file
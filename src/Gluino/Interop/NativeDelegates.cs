@@ -8,4 +8,12 @@ namespace Gluino.Interop;
 [UnmanagedFunctionPointer(CallingConvention.Cdecl)] internal delegate void NativePointDelegate(NativePoint point);
 [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Auto)] internal delegate void NativeStringDelegate(string value);
 [UnmanagedFunctionPointer(CallingConvention.Cdecl)] internal delegate void NativeIntDelegate(int value);
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)] internal delegate void NativePtrDelegate(nint context);
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)] internal delegate bool NativeIdleDelegate(nint context, int remainingMicroseconds);
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)] internal delegate void NativeSpawnDelegate(nint context, nint window, nint webView);
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)] internal delegate void NativeEventBatchDelegate(nint records, int count);
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)] internal delegate void NativeArgumentsDelegate(nint args, int count);
 [UnmanagedFunctionPointer(CallingConvention.Cdecl)] internal delegate void NativeWebResourceDelegate(NativeWebResourceRequest request, out NativeWebResourceResponse response);
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)] internal delegate void NativeLoopbackRequestDelegate(in NativeLoopbackRequest request, nint response);
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)] internal delegate void NativeLoopbackSocketDelegate(int connectionId, [MarshalAs(UnmanagedType.LPUTF8Str)] string path);
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)] internal delegate void NativeLoopbackMessageDelegate(int connectionId, nint data, int size, [MarshalAs(UnmanagedType.U1)] bool binary);
@@ -0,0 +1,12 @@
+﻿namespace Gluino.Interop;
+
+[LibDetails("Gluino.Core")]
+internal partial class NativeHotReload
+{
+    [LibImport("Gluino_HotReload_Create")] public static partial nint Create(nint vfs, nint directory);
+    [LibImport("Gluino_HotReload_Destroy")] public static partial void Destroy(nint hotReload);
+    [LibImport("Gluino_HotReload_Start")] public static partial bool Start(nint hotReload);
+    [LibImport("Gluino_HotReload_Stop")] public static partial void Stop(nint hotReload);
+    [LibImport("Gluino_HotReload_Subscribe")] public static partial void Subscribe(nint hotReload, nint window, nint webView);
+    [LibImport("Gluino_HotReload_Unsubscribe")] public static partial void Unsubscribe(nint hotReload, nint webView);
+}
@@ -0,0 +1,18 @@
+﻿namespace Gluino.Interop;
+
+[LibDetails("Gluino.Core")]
+internal partial class NativeVfs
+{
+    [LibImport("Gluino_Vfs_Create")] public static partial nint Create();
+    [LibImport("Gluino_Vfs_Destroy")] public static partial void Destroy(nint vfs);
+    [LibImport("Gluino_Vfs_AddDirectory")] public static partial nint AddDirectory(nint vfs, string path, int priority);
+    [LibImport("Gluino_Vfs_AddZip")] public static partial nint AddZip(nint vfs, string path, int priority);
+    [LibImport("Gluino_Vfs_AddPack")] public static partial nint AddPack(nint vfs, string path, int priority);
+    [LibImport("Gluino_Vfs_AddOverlay")] public static partial nint AddOverlay(nint vfs, int priority);
+    [LibImport("Gluino_Vfs_RemoveLayer")] public static partial void RemoveLayer(nint vfs, nint layer);
+    [LibImport("Gluino_Vfs_Invalidate")] public static partial void Invalidate(nint vfs, string path);
+    [LibImport("Gluino_Vfs_BuildPack")] public static partial bool BuildPack(string directory, string output);
+
+    [LibImport("Gluino_VfsOverlay_Put")] public static partial bool OverlayPut(nint overlay, string path, byte[] data, int size);
+    [LibImport("Gluino_VfsOverlay_Remove")] public static partial bool OverlayRemove(nint overlay, string path);
+}
@@ -0,0 +1,8 @@
+﻿namespace Gluino.Interop;
+
+[LibDetails("Gluino.Core")]
+internal partial class NativeResourcePlugin
+{
+    [LibImport("Gluino_Plugin_Load")] public static partial nint Load(string path, string options);
+    [LibImport("Gluino_Plugin_Destroy")] public static partial void Destroy(nint plugin);
+}
@@ -1,4 +1,6 @@
-﻿namespace Gluino.Interop;
+﻿using System.Text;
+
+namespace Gluino.Interop;
 
 [LibDetails("Gluino.Core", ManagedType = typeof(WebView))]
 internal partial class NativeWebView
@@ -10,6 +12,19 @@ internal partial class NativeWebView
     [LibImport("Gluino_WebView_NativateToString")] public static partial void NativateToString(nint webView, string content);
     [LibImport("Gluino_WebView_PostWebMessage")] public static partial void PostWebMessage(nint webView, string message);
     [LibImport("Gluino_WebView_InjectScript")] public static partial void InjectScript(nint webView, string script, bool onDocumentCreated);
+    [LibImport("Gluino_WebView_MountVfs")] public static partial void MountVfs(nint webView, string prefix, nint vfs);
+    [LibImport("Gluino_WebView_MountPlugin")] public static partial void MountPlugin(nint webView, string prefix, nint plugin);
+    [LibImport("Gluino_WebView_Unmount")] public static partial void Unmount(nint webView, string prefix);
+    [LibImport("Gluino_WebView_RegisterFile")] public static partial bool RegisterFile(nint webView, string path, string contentType, StringBuilder url, int urlSize);
+    [LibImport("Gluino_WebView_RevokeFile")] public static partial bool RevokeFile(nint webView, string url);
+    [LibImport("Gluino_WebView_SetPrefetchManifest")] public static partial void SetPrefetchManifest(nint webView, string route, string[] urls, int count);
+    [LibImport("Gluino_WebView_RemovePrefetchManifest")] public static partial void RemovePrefetchManifest(nint webView, string route);
+    [LibImport("Gluino_WebView_Prefetch")] public static partial void Prefetch(nint webView, string url);
+    [LibImport("Gluino_WebView_SetBounds")] public static partial void SetBounds(nint webView, ref NativeRect bounds);
+    [LibImport("Gluino_WebView_SetBounds")] public static partial void ClearBounds(nint webView, nint bounds);
+    [LibImport("Gluino_WebView_GetVisible")] public static partial bool GetVisible(nint webView);
+    [LibImport("Gluino_WebView_SetVisible")] public static partial void SetVisible(nint webView, bool visible);
+    [LibImport("Gluino_WebView_GetThrottleLevel")] public static partial ThrottleLevel GetThrottleLevel(nint webView);
 
     [LibImport("Gluino_WebView_GetGrantPermissions", Managed = true, Property = PG, Option = nameof(NativeWebViewOptions.GrantPermissions))]
     public static partial bool GetGrantPermissions(nint webView);
@@ -31,4 +46,10 @@ internal partial class NativeWebView
 
     [LibImport("Gluino_WebView_SetUserAgent", Managed = true, Property = PS, Option = "UserAgent")] 
     public static partial void SetUserAgent(nint webView, string userAgent);
+
+    [LibImport("Gluino_WebView_GetSuspendDelay", Managed = true, Property = PG, Option = nameof(NativeWebViewOptions.SuspendDelay))]
+    public static partial int GetSuspendDelay(nint webView);
+
+    [LibImport("Gluino_WebView_SetSuspendDelay", Managed = true, Property = PS, Option = nameof(NativeWebViewOptions.SuspendDelay))]
+    public static partial void SetSuspendDelay(nint webView, int delay);
 }
\ No newline at end of file
@@ -6,8 +6,5 @@ namespace Gluino.Interop;
 internal struct NativeWebViewEvents
 {
     [MarshalAs(UnmanagedType.FunctionPtr)] public NativeDelegate OnCreated;
-    [MarshalAs(UnmanagedType.FunctionPtr)] public NativeStringDelegate OnNavigationStart;
-    [MarshalAs(UnmanagedType.FunctionPtr)] public NativeDelegate OnNavigationEnd;
-    [MarshalAs(UnmanagedType.FunctionPtr)] public NativeStringDelegate OnMessageReceived;
     [MarshalAs(UnmanagedType.FunctionPtr)] public NativeWebResourceDelegate OnResourceRequested;
 }
\ No newline at end of file
@@ -14,4 +14,5 @@ internal struct NativeWebViewOptions
     [MarshalAs(UnmanagedType.LPWStr)] public string UserAgentW;
     [MarshalAs(UnmanagedType.LPStr)] public string UserAgentA;
     [MarshalAs(UnmanagedType.I1)] public bool GrantPermissions;
+    [MarshalAs(UnmanagedType.I4)] public int SuspendDelay;
 }
\ No newline at end of file
@@ -0,0 +1,29 @@
+﻿using System.Runtime.InteropServices;
+
+namespace Gluino.Interop;
+
+internal enum NativeEventType
+{
+    Shown,
+    Hidden,
+    Resize,
+    ResizeStart,
+    ResizeEnd,
+    LocationChanged,
+    WindowStateChanged,
+    FocusIn,
+    FocusOut,
+    NavigationStart,
+    NavigationEnd,
+    MessageReceived,
+    Closing
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeEventRecord
+{
+    public NativeEventType Type;
+    public int X;
+    public int Y;
+    public nint Text;
+}
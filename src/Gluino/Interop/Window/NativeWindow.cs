@@ -24,12 +24,33 @@ internal partial class NativeWindow
     [LibImport("Gluino_Window_Invoke")]
     public static partial void Invoke(nint window, NativeDelegate action);
 
+    [LibImport("Gluino_Window_BeginInvoke")]
+    public static partial void BeginInvoke(nint window, NativePtrDelegate action, nint context);
+
+    [LibImport("Gluino_Window_InvokeAsync")]
+    public static partial void InvokeAsync(nint window, NativePtrDelegate action, nint context, NativePtrDelegate callback);
+
+    [LibImport("Gluino_Window_StartTimer")]
+    public static partial int StartTimer(nint window, long due, long period, NativePtrDelegate callback, nint context);
+
+    [LibImport("Gluino_Window_StopTimer")]
+    public static partial bool StopTimer(nint window, int id);
+
+    [LibImport("Gluino_Window_FlushEvents")]
+    public static partial void FlushEvents(nint window);
+
+    [LibImport("Gluino_Window_SetEventMask")]
+    public static partial void SetEventMask(nint window, uint mask);
+
     [LibImport("Gluino_Window_GetHandle")]
     public static partial nint GetHandle(nint window);
 
     [LibImport("Gluino_Window_GetBounds")]
     public static partial void GetBounds(nint window, out NativeRect bounds);
 
+    [LibImport("Gluino_Window_GetSnapshot")]
+    public static partial void GetSnapshot(nint window, out NativeWindowSnapshot snapshot);
+
     [LibImport("Gluino_Window_GetIsDarkMode")]
     public static partial bool GetIsDarkMode(nint window);
 
@@ -51,7 +72,7 @@ internal partial class NativeWindow
     [LibImport("Gluino_Window_SetBorderStyle", Managed = true, Property = PS, Option = nameof(NativeWindowOptions.BorderStyle))]
     public static partial void SetBorderStyle(nint window, WindowBorderStyle style);
 
-    [LibImport("Gluino_Window_GetWindowState", Managed = true, Property = PG, Option = nameof(NativeWindowOptions.WindowState))]
+    [LibImport("Gluino_Window_GetWindowState")]
     public static partial WindowState GetWindowState(nint window);
 
     [LibImport("Gluino_Window_SetWindowState", Managed = true, Property = PS, Option = nameof(NativeWindowOptions.WindowState))]
@@ -75,13 +96,13 @@ internal partial class NativeWindow
     [LibImport("Gluino_Window_SetMaximumSize", Managed = true, Property = PS, Option = nameof(NativeWindowOptions.MaximumSize))]
     public static partial NativeSize SetMaximumSize(nint window, NativeSize size);
 
-    [LibImport("Gluino_Window_GetSize", Managed = true, Property = PG, Option = nameof(NativeWindowOptions.Size))]
+    [LibImport("Gluino_Window_GetSize")]
     public static partial NativeSize GetSize(nint window);
 
     [LibImport("Gluino_Window_SetSize", Managed = true, Property = PS, Option = nameof(NativeWindowOptions.Size))]
     public static partial NativeSize SetSize(nint window, NativeSize size);
 
-    [LibImport("Gluino_Window_GetLocation", Managed = true, Property = PG, Option = nameof(NativeWindowOptions.Location))]
+    [LibImport("Gluino_Window_GetLocation")]
     public static partial NativePoint GetLocation(nint window);
 
     [LibImport("Gluino_Window_SetLocation", Managed = true, Property = PS, Option = nameof(NativeWindowOptions.Location))]
@@ -104,4 +125,43 @@ internal partial class NativeWindow
 
     [LibImport("Gluino_Window_SetTopMost", Managed = true, Property = PS, Option = nameof(NativeWindowOptions.TopMost))]
     public static partial void SetTopMost(nint window, bool topMost);
+
+    [LibImport("Gluino_Window_ApplyChanges")]
+    public static partial void ApplyChanges(nint window, ref NativeWindowChangeSet changes);
+
+    [LibImport("Gluino_Window_GetGeometryEventInterval", Managed = true, Property = PG, Option = nameof(NativeWindowOptions.GeometryEventInterval))]
+    public static partial int GetGeometryEventInterval(nint window);
+
+    [LibImport("Gluino_Window_SetGeometryEventInterval", Managed = true, Property = PS, Option = nameof(NativeWindowOptions.GeometryEventInterval))]
+    public static partial void SetGeometryEventInterval(nint window, int interval);
+
+    [LibImport("Gluino_Window_GetBackgroundThrottling", Managed = true, Property = PG, Option = nameof(NativeWindowOptions.BackgroundThrottling))]
+    public static partial bool GetBackgroundThrottling(nint window);
+
+    [LibImport("Gluino_Window_SetBackgroundThrottling", Managed = true, Property = PS, Option = nameof(NativeWindowOptions.BackgroundThrottling))]
+    public static partial void SetBackgroundThrottling(nint window, bool enabled);
+
+    [LibImport("Gluino_Window_GetBrowserSuspendDelay", Managed = true, Property = PG, Option = nameof(NativeWindowOptions.BrowserSuspendDelay))]
+    public static partial int GetBrowserSuspendDelay(nint window);
+
+    [LibImport("Gluino_Window_SetBrowserSuspendDelay", Managed = true, Property = PS, Option = nameof(NativeWindowOptions.BrowserSuspendDelay))]
+    public static partial void SetBrowserSuspendDelay(nint window, int delay);
+
+    [LibImport("Gluino_Window_GetThrottleLevel")]
+    public static partial ThrottleLevel GetThrottleLevel(nint window);
+
+    [LibImport("Gluino_Window_AddWebView")]
+    public static partial nint AddWebView(nint window, ref NativeWebViewOptions options, ref NativeWebViewEvents events, out int viewId);
+
+    [LibImport("Gluino_Window_RemoveWebView")]
+    public static partial bool RemoveWebView(nint window, nint webView);
+
+    [LibImport("Gluino_Window_GetWebViewZIndex")]
+    public static partial int GetWebViewZIndex(nint window, nint webView);
+
+    [LibImport("Gluino_Window_SetWebViewZIndex")]
+    public static partial void SetWebViewZIndex(nint window, nint webView, int index);
+
+    [LibImport("Gluino_Window_SwapWebViews")]
+    public static partial bool SwapWebViews(nint window, nint current, nint replacement);
 }
\ No newline at end of file
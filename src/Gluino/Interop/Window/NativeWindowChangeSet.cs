@@ -0,0 +1,35 @@
+﻿using System.Runtime.InteropServices;
+
+namespace Gluino.Interop;
+
+[Flags]
+internal enum NativeWindowChange : uint
+{
+    None = 0,
+    Size = 1 << 0,
+    Location = 1 << 1,
+    WindowState = 1 << 2,
+    BorderStyle = 1 << 3,
+    TopMost = 1 << 4,
+    MinimizeEnabled = 1 << 5,
+    MaximizeEnabled = 1 << 6,
+    MinimumSize = 1 << 7,
+    MaximumSize = 1 << 8,
+    Theme = 1 << 9
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeWindowChangeSet
+{
+    public NativeWindowChange Changes;
+    public NativeSize Size;
+    public NativePoint Location;
+    public WindowState WindowState;
+    public WindowBorderStyle BorderStyle;
+    public WindowTheme Theme;
+    public NativeSize MinimumSize;
+    public NativeSize MaximumSize;
+    [MarshalAs(UnmanagedType.I1)] public bool TopMost;
+    [MarshalAs(UnmanagedType.I1)] public bool MinimizeEnabled;
+    [MarshalAs(UnmanagedType.I1)] public bool MaximizeEnabled;
+}
@@ -21,4 +21,7 @@ internal struct NativeWindowOptions
     [MarshalAs(UnmanagedType.I1)] public bool MinimizeEnabled;
     [MarshalAs(UnmanagedType.I1)] public bool MaximizeEnabled;
     [MarshalAs(UnmanagedType.I1)] public bool TopMost;
+    [MarshalAs(UnmanagedType.I4)] public int GeometryEventInterval;
+    [MarshalAs(UnmanagedType.I1)] public bool BackgroundThrottling;
+    [MarshalAs(UnmanagedType.I4)] public int BrowserSuspendDelay;
 }
\ No newline at end of file
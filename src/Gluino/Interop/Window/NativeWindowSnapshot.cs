@@ -0,0 +1,12 @@
+﻿using System.Runtime.InteropServices;
+
+namespace Gluino.Interop;
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NativeWindowSnapshot
+{
+    [MarshalAs(UnmanagedType.U4)] public uint Version;
+    public NativeRect Bounds;
+    public WindowState WindowState;
+    [MarshalAs(UnmanagedType.I1)] public bool IsDarkMode;
+}
@@ -0,0 +1,56 @@
+﻿namespace Gluino;
+
+/// <summary>
+/// Represents an HTTP request received by a <see cref="LoopbackServer"/>.
+/// </summary>
+public class LoopbackRequest
+{
+    internal LoopbackRequest(string method, string path, string headers, byte[] body)
+    {
+        Method = method;
+        Path = path;
+        Headers = headers;
+        Body = body;
+    }
+
+    /// <summary>
+    /// Gets the HTTP method of the request.
+    /// </summary>
+    public string Method { get; }
+
+    /// <summary>
+    /// Gets the path of the request relative to <see cref="LoopbackServer.BaseUrl"/>, including the query string.
+    /// </summary>
+    public string Path { get; }
+
+    /// <summary>
+    /// Gets the raw header lines of the request.
+    /// </summary>
+    public string Headers { get; }
+
+    /// <summary>
+    /// Gets the body of the request.
+    /// </summary>
+    public byte[] Body { get; }
+}
+
+/// <summary>
+/// Represents the response to a <see cref="LoopbackRequest"/>.
+/// </summary>
+public class LoopbackResponse
+{
+    /// <summary>
+    /// Gets or sets the HTTP status code. Defaults to 404.
+    /// </summary>
+    public int StatusCode { get; set; } = 404;
+
+    /// <summary>
+    /// Gets or sets the content type.
+    /// </summary>
+    public string ContentType { get; set; }
+
+    /// <summary>
+    /// Gets or sets the content.
+    /// </summary>
+    public byte[] Content { get; set; }
+}
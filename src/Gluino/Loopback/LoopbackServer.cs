@@ -0,0 +1,180 @@
+﻿using System.Collections.Concurrent;
+using System.Runtime.InteropServices;
+using System.Text;
+using Gluino.Interop;
+
+namespace Gluino;
+
+/// <summary>
+/// Represents an embedded HTTP/1.1 and WebSocket server bound to 127.0.0.1 on an ephemeral port.
+/// </summary>
+/// <remarks>
+/// Every request must start with the random per-session token contained in <see cref="BaseUrl"/>.
+/// Events are raised on the connection threads of the server, not on the UI thread.
+/// </remarks>
+public sealed class LoopbackServer : IDisposable
+{
+    private readonly ConcurrentDictionary<int, string> _socketPaths = new();
+    private NativeLoopbackServerEvents _nativeEvents;
+    private nint _instancePtr;
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="LoopbackServer"/> class.
+    /// </summary>
+    public LoopbackServer()
+    {
+        _nativeEvents = new() {
+            OnRequest = InvokeRequestReceived,
+            OnSocketOpen = InvokeSocketOpened,
+            OnSocketMessage = InvokeSocketMessageReceived,
+            OnSocketClose = InvokeSocketClosed
+        };
+        _instancePtr = NativeLoopbackServer.Create(ref _nativeEvents);
+    }
+
+    /// <summary>
+    /// Occurs when an HTTP request is not served by a mounted <see cref="VirtualFileSystem"/>.
+    /// </summary>
+    public event EventHandler<LoopbackRequestEventArgs> RequestReceived;
+
+    /// <summary>
+    /// Occurs when a WebSocket connection is opened.
+    /// </summary>
+    public event EventHandler<LoopbackSocketEventArgs> SocketOpened;
+
+    /// <summary>
+    /// Occurs when a complete WebSocket message is received.
+    /// </summary>
+    public event EventHandler<LoopbackMessageEventArgs> SocketMessageReceived;
+
+    /// <summary>
+    /// Occurs when a WebSocket connection is closed.
+    /// </summary>
+    public event EventHandler<LoopbackSocketEventArgs> SocketClosed;
+
+    /// <summary>
+    /// Gets the port the server is listening on, or 0 if it has not been started.
+    /// </summary>
+    public int Port => NativeLoopbackServer.GetPort(_instancePtr);
+
+    /// <summary>
+    /// Gets the base URL of the server, including the session token.
+    /// </summary>
+    public string BaseUrl {
+        get {
+            var url = new StringBuilder(128);
+            return NativeLoopbackServer.GetBaseUrl(_instancePtr, url, url.Capacity) ? url.ToString() : null;
+        }
+    }
+
+    /// <summary>
+    /// Starts listening.
+    /// </summary>
+    /// <exception cref="IOException">The server could not be started.</exception>
+    public void Start()
+    {
+        if (!NativeLoopbackServer.Start(_instancePtr))
+            throw new IOException("Failed to start the loopback server.");
+    }
+
+    /// <summary>
+    /// Stops listening and closes every connection.
+    /// </summary>
+    public void Stop() => NativeLoopbackServer.Stop(_instancePtr);
+
+    /// <summary>
+    /// Serve GET and HEAD requests whose path starts with the specified prefix from a <see cref="VirtualFileSystem"/>.
+    /// </summary>
+    /// <param name="prefix">The path prefix relative to <see cref="BaseUrl"/> (e.g. "assets/").</param>
+    /// <param name="vfs">The <see cref="VirtualFileSystem"/> to serve from.</param>
+    public void Mount(string prefix, VirtualFileSystem vfs) => NativeLoopbackServer.MountVfs(_instancePtr, prefix, vfs.InstancePtr);
+
+    /// <summary>
+    /// Remove the <see cref="VirtualFileSystem"/> mounted at the specified prefix.
+    /// </summary>
+    /// <param name="prefix">The path prefix to unmount.</param>
+    public void Unmount(string prefix) => NativeLoopbackServer.Unmount(_instancePtr, prefix);
+
+    /// <summary>
+    /// Sends a binary message to a WebSocket connection.
+    /// </summary>
+    /// <param name="connectionId">The identifier of the connection.</param>
+    /// <param name="data">The payload.</param>
+    /// <returns><see langword="true"/> if the message was sent; otherwise, <see langword="false"/>.</returns>
+    public bool Send(int connectionId, byte[] data) => NativeLoopbackServer.Send(_instancePtr, connectionId, data, data.Length, true);
+
+    /// <summary>
+    /// Sends a text message to a WebSocket connection.
+    /// </summary>
+    /// <param name="connectionId">The identifier of the connection.</param>
+    /// <param name="text">The payload.</param>
+    /// <returns><see langword="true"/> if the message was sent; otherwise, <see langword="false"/>.</returns>
+    public bool Send(int connectionId, string text)
+    {
+        var data = Encoding.UTF8.GetBytes(text);
+        return NativeLoopbackServer.Send(_instancePtr, connectionId, data, data.Length, false);
+    }
+
+    /// <summary>
+    /// Closes a connection.
+    /// </summary>
+    /// <param name="connectionId">The identifier of the connection.</param>
+    public void Close(int connectionId) => NativeLoopbackServer.Close(_instancePtr, connectionId);
+
+    /// <summary>
+    /// Stops the server and destroys the native instance.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_instancePtr == nint.Zero)
+            return;
+        NativeLoopbackServer.Destroy(_instancePtr);
+        _instancePtr = nint.Zero;
+    }
+
+    private void InvokeRequestReceived(in NativeLoopbackRequest native, nint responsePtr)
+    {
+        var body = new byte[native.BodyLength];
+        if (body.Length > 0)
+            Marshal.Copy(native.Body, body, 0, body.Length);
+
+        var request = new LoopbackRequest(
+            Marshal.PtrToStringUTF8(native.Method),
+            Marshal.PtrToStringUTF8(native.Path),
+            Marshal.PtrToStringUTF8(native.Headers),
+            body);
+        var response = new LoopbackResponse();
+
+        try {
+            RequestReceived?.Invoke(this, new(request, response));
+        }
+        catch {
+            response.StatusCode = 500;
+            response.Content = null;
+        }
+
+        var content = response.Content ?? [];
+        NativeLoopbackServer.Respond(responsePtr, response.StatusCode, response.ContentType, content, content.Length);
+    }
+
+    private void InvokeSocketOpened(int connectionId, string path)
+    {
+        _socketPaths[connectionId] = path;
+        SocketOpened?.Invoke(this, new(connectionId, path));
+    }
+
+    private void InvokeSocketMessageReceived(int connectionId, nint data, int size, bool binary)
+    {
+        var payload = new byte[size];
+        if (size > 0)
+            Marshal.Copy(data, payload, 0, size);
+        _socketPaths.TryGetValue(connectionId, out var path);
+        SocketMessageReceived?.Invoke(this, new(connectionId, path, payload, binary));
+    }
+
+    private void InvokeSocketClosed(int connectionId)
+    {
+        _socketPaths.TryRemove(connectionId, out var path);
+        SocketClosed?.Invoke(this, new(connectionId, path));
+    }
+}
@@ -0,0 +1,46 @@
+﻿using Gluino.Interop;
+
+namespace Gluino;
+
+/// <summary>
+/// Represents a dedicated UI thread with its own message loop.
+/// </summary>
+/// <remarks>
+/// Windows assigned to a <see cref="UiThread"/> through <see cref="Window.UiThread"/> are created on,
+/// and only ever touched by, that thread, so a busy window does not delay windows on other threads.
+/// </remarks>
+public sealed class UiThread : IDisposable
+{
+    internal nint InstancePtr;
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="UiThread"/> class and starts its message loop.
+    /// </summary>
+    public UiThread()
+    {
+        InstancePtr = NativeApp.CreateUiThread(App.NativeInstance);
+    }
+
+    /// <summary>
+    /// Gets or sets the granularity that timer deadlines on this thread are rounded up to.
+    /// </summary>
+    /// <remarks>
+    /// Default: 250 microseconds
+    /// </remarks>
+    public TimeSpan TimerSlack {
+        get => TimeSpan.FromMicroseconds(NativeApp.GetUiThreadTimerSlack(InstancePtr));
+        set => NativeApp.SetUiThreadTimerSlack(InstancePtr, (int)value.TotalMicroseconds);
+    }
+
+    /// <summary>
+    /// Stops the message loop, destroying any windows still running on the thread.
+    /// </summary>
+    public void Dispose()
+    {
+        if (InstancePtr == nint.Zero)
+            return;
+
+        NativeApp.DestroyUiThread(App.NativeInstance, InstancePtr);
+        InstancePtr = nint.Zero;
+    }
+}
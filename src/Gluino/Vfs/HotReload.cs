@@ -0,0 +1,74 @@
+﻿using Gluino.Interop;
+
+namespace Gluino;
+
+/// <summary>
+/// Watches a directory layer of a <see cref="VirtualFileSystem"/> and reloads subscribed windows when its files change.
+/// </summary>
+/// <remarks>
+/// Intended for development. Changed paths are invalidated in the file system cache,
+/// stylesheets are swapped in place and any other change reloads the page.
+/// </remarks>
+public sealed class HotReload : IDisposable
+{
+    private readonly VfsDirectory _directory;
+    private nint _instancePtr;
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="HotReload"/> class.
+    /// </summary>
+    /// <param name="directory">The directory layer to watch.</param>
+    /// <exception cref="ArgumentException">The layer is not a directory layer.</exception>
+    public HotReload(VfsDirectory directory)
+    {
+        _directory = directory;
+        _instancePtr = NativeHotReload.Create(directory.Vfs.InstancePtr, directory.InstancePtr);
+        if (_instancePtr == nint.Zero)
+            throw new ArgumentException("The layer is not a directory layer.", nameof(directory));
+    }
+
+    /// <summary>
+    /// Starts watching the directory.
+    /// </summary>
+    /// <exception cref="IOException">The directory could not be watched, or its layer or file system has been removed.</exception>
+    /// <exception cref="ObjectDisposedException">The file system has been disposed.</exception>
+    public void Start()
+    {
+        ObjectDisposedException.ThrowIf(_directory.Vfs.InstancePtr == nint.Zero, _directory.Vfs);
+        if (!NativeHotReload.Start(_instancePtr))
+            throw new IOException("Failed to start watching the directory.");
+    }
+
+    /// <summary>
+    /// Stops watching the directory.
+    /// </summary>
+    public void Stop() => NativeHotReload.Stop(_instancePtr);
+
+    /// <summary>
+    /// Subscribes the <see cref="WebView"/> of the specified window to change notifications.
+    /// </summary>
+    /// <param name="window">The window to subscribe. Must be shown.</param>
+    public void Subscribe(Window window)
+    {
+        if (window.InstancePtr == nint.Zero)
+            throw new InvalidOperationException("The window must be shown before subscribing.");
+        NativeHotReload.Subscribe(_instancePtr, window.InstancePtr, window.WebView.InstancePtr);
+    }
+
+    /// <summary>
+    /// Unsubscribes the <see cref="WebView"/> of the specified window from change notifications.
+    /// </summary>
+    /// <param name="window">The window to unsubscribe.</param>
+    public void Unsubscribe(Window window) => NativeHotReload.Unsubscribe(_instancePtr, window.WebView.InstancePtr);
+
+    /// <summary>
+    /// Stops watching and destroys the native watcher.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_instancePtr == nint.Zero)
+            return;
+        NativeHotReload.Destroy(_instancePtr);
+        _instancePtr = nint.Zero;
+    }
+}
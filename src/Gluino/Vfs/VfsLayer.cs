@@ -0,0 +1,47 @@
+﻿using Gluino.Interop;
+
+namespace Gluino;
+
+/// <summary>
+/// Represents a layer of a <see cref="VirtualFileSystem"/>.
+/// </summary>
+public class VfsLayer
+{
+    internal readonly VirtualFileSystem Vfs;
+    internal readonly nint InstancePtr;
+
+    internal VfsLayer(VirtualFileSystem vfs, nint instancePtr)
+    {
+        Vfs = vfs;
+        InstancePtr = instancePtr;
+    }
+}
+
+/// <summary>
+/// Represents a directory layer of a <see cref="VirtualFileSystem"/>.
+/// </summary>
+public sealed class VfsDirectory : VfsLayer
+{
+    internal VfsDirectory(VirtualFileSystem vfs, nint instancePtr) : base(vfs, instancePtr) { }
+}
+
+/// <summary>
+/// Represents an in-memory layer of a <see cref="VirtualFileSystem"/>.
+/// </summary>
+public sealed class VfsOverlay : VfsLayer
+{
+    internal VfsOverlay(VirtualFileSystem vfs, nint instancePtr) : base(vfs, instancePtr) { }
+
+    /// <summary>
+    /// Adds or replaces a file.
+    /// </summary>
+    /// <param name="path">The path of the file.</param>
+    /// <param name="data">The content of the file.</param>
+    public void Put(string path, byte[] data) => NativeVfs.OverlayPut(InstancePtr, path, data, data.Length);
+
+    /// <summary>
+    /// Removes a file.
+    /// </summary>
+    /// <param name="path">The path of the file.</param>
+    public void Remove(string path) => NativeVfs.OverlayRemove(InstancePtr, path);
+}
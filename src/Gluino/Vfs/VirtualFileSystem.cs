@@ -0,0 +1,112 @@
+﻿using Gluino.Interop;
+
+namespace Gluino;
+
+/// <summary>
+/// Represents a layered virtual file system that serves resources natively to a <see cref="WebView"/>.
+/// </summary>
+/// <remarks>
+/// Layers are searched from the highest to the lowest priority and resolved paths are cached natively.
+/// </remarks>
+public sealed class VirtualFileSystem : IDisposable
+{
+    internal nint InstancePtr;
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="VirtualFileSystem"/> class.
+    /// </summary>
+    public VirtualFileSystem() => InstancePtr = NativeVfs.Create();
+
+    /// <summary>
+    /// Adds a directory layer.
+    /// </summary>
+    /// <param name="path">The root directory of the layer.</param>
+    /// <param name="priority">The priority of the layer. Higher priorities are searched first.</param>
+    /// <returns>The added <see cref="VfsDirectory"/>.</returns>
+    public VfsDirectory AddDirectory(string path, int priority = 0)
+    {
+        var fullPath = Path.GetFullPath(path);
+        if (!Directory.Exists(fullPath))
+            throw new DirectoryNotFoundException($"Directory '{fullPath}' not found.");
+        return new(this, NativeVfs.AddDirectory(InstancePtr, fullPath, priority));
+    }
+
+    /// <summary>
+    /// Adds a zip archive layer.
+    /// </summary>
+    /// <param name="path">The path to the zip archive.</param>
+    /// <param name="priority">The priority of the layer. Higher priorities are searched first.</param>
+    /// <returns>The added <see cref="VfsLayer"/>.</returns>
+    /// <remarks>
+    /// Only stored and deflated entries are supported.
+    /// </remarks>
+    public VfsLayer AddZip(string path, int priority = 0)
+    {
+        var layer = NativeVfs.AddZip(InstancePtr, Path.GetFullPath(path), priority);
+        if (layer == nint.Zero)
+            throw new InvalidDataException($"'{path}' is not a valid zip archive.");
+        return new(this, layer);
+    }
+
+    /// <summary>
+    /// Adds a memory-mapped pack layer.
+    /// </summary>
+    /// <param name="path">The path to a pack built with <see cref="BuildPack"/>.</param>
+    /// <param name="priority">The priority of the layer. Higher priorities are searched first.</param>
+    /// <returns>The added <see cref="VfsLayer"/>.</returns>
+    public VfsLayer AddPack(string path, int priority = 0)
+    {
+        var layer = NativeVfs.AddPack(InstancePtr, Path.GetFullPath(path), priority);
+        if (layer == nint.Zero)
+            throw new InvalidDataException($"'{path}' is not a valid pack.");
+        return new(this, layer);
+    }
+
+    /// <summary>
+    /// Adds an in-memory overlay layer.
+    /// </summary>
+    /// <param name="priority">The priority of the layer. Higher priorities are searched first.</param>
+    /// <returns>The added <see cref="VfsOverlay"/>.</returns>
+    public VfsOverlay AddOverlay(int priority = 0) => new(this, NativeVfs.AddOverlay(InstancePtr, priority));
+
+    /// <summary>
+    /// Removes the specified layer.
+    /// </summary>
+    /// <param name="layer">The layer to remove.</param>
+    /// <remarks>
+    /// Any <see cref="HotReload"/> watching the layer stops watching.
+    /// </remarks>
+    public void RemoveLayer(VfsLayer layer) => NativeVfs.RemoveLayer(InstancePtr, layer.InstancePtr);
+
+    /// <summary>
+    /// Invalidates the cached lookup of the specified path.
+    /// </summary>
+    /// <param name="path">The path to invalidate.</param>
+    public void Invalidate(string path) => NativeVfs.Invalidate(InstancePtr, path);
+
+    /// <summary>
+    /// Builds a pack from the contents of a directory.
+    /// </summary>
+    /// <param name="directory">The directory to pack.</param>
+    /// <param name="output">The path of the pack to create.</param>
+    /// <exception cref="IOException">The pack could not be built.</exception>
+    public static void BuildPack(string directory, string output)
+    {
+        if (!NativeVfs.BuildPack(Path.GetFullPath(directory), Path.GetFullPath(output)))
+            throw new IOException($"Failed to build pack '{output}' from '{directory}'.");
+    }
+
+    /// <summary>
+    /// Destroys the native file system.
+    /// </summary>
+    /// <remarks>
+    /// Must be unmounted from every <see cref="WebView"/> first. Any <see cref="HotReload"/> watching its layers stops watching.
+    /// </remarks>
+    public void Dispose()
+    {
+        if (InstancePtr == nint.Zero)
+            return;
+        NativeVfs.Destroy(InstancePtr);
+        InstancePtr = nint.Zero;
+    }
+}
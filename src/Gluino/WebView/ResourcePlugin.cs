@@ -0,0 +1,42 @@
+﻿using Gluino.Interop;
+
+namespace Gluino;
+
+/// <summary>
+/// Represents a native library that serves resources through the Gluino plugin ABI.
+/// </summary>
+/// <remarks>
+/// The library must export <c>GluinoPlugin_Create</c> as declared in <c>gluino_plugin.h</c>.
+/// Requests are handled natively on the UI thread without crossing into managed code.
+/// </remarks>
+public sealed class ResourcePlugin : IDisposable
+{
+    internal nint InstancePtr;
+
+    /// <summary>
+    /// Loads a resource plugin.
+    /// </summary>
+    /// <param name="path">The path to the native library.</param>
+    /// <param name="options">An optional string passed to the plugin when it is created.</param>
+    /// <exception cref="DllNotFoundException">The library could not be loaded or did not create a handler.</exception>
+    public ResourcePlugin(string path, string options = null)
+    {
+        InstancePtr = NativeResourcePlugin.Load(Path.GetFullPath(path), options);
+        if (InstancePtr == nint.Zero)
+            throw new DllNotFoundException($"Failed to load resource plugin '{path}'.");
+    }
+
+    /// <summary>
+    /// Destroys the plugin handler and unloads the library.
+    /// </summary>
+    /// <remarks>
+    /// Must be unmounted from every <see cref="WebView"/> first.
+    /// </remarks>
+    public void Dispose()
+    {
+        if (InstancePtr == nint.Zero)
+            return;
+        NativeResourcePlugin.Destroy(InstancePtr);
+        InstancePtr = nint.Zero;
+    }
+}
@@ -1,4 +1,6 @@
-﻿using System.Text.RegularExpressions;
+﻿using System.Drawing;
+using System.Text;
+using System.Text.RegularExpressions;
 using Gluino.Interop;
 
 namespace Gluino;
@@ -14,8 +16,22 @@ public partial class WebView
 
     private readonly Window _window;
     private readonly WebViewBinder _binder;
+    private readonly Dictionary<string, Action<nint>> _mounts = [];
+    private readonly Dictionary<string, string[]> _prefetchManifests = [];
+    private readonly List<string> _documentScripts = [];
+
+    private EventHandler<NavigationStartEventArgs> _navigationStart;
+    private EventHandler _navigationEnd;
+    private EventHandler<string> _messageReceived;
+
+    private Rectangle? _bounds;
+    private bool _visible = true;
+
+    private WebView _prerender;
+    private string _prerenderUrl;
 
     internal nint InstancePtr;
+    internal int ViewId;
     internal NativeWebViewOptions NativeOptions;
     internal NativeWebViewEvents NativeEvents;
 
@@ -26,36 +42,43 @@ public partial class WebView
     /// <summary>
     /// Occurs when the WebView begins navigating to a new URL.
     /// </summary>
-    public event EventHandler<NavigationStartEventArgs> NavigationStart;
+    public event EventHandler<NavigationStartEventArgs> NavigationStart {
+        add => _window.AddWebViewHandler(ref _navigationStart, value, NativeEventType.NavigationStart);
+        remove => _window.RemoveWebViewHandler(ref _navigationStart, value, NativeEventType.NavigationStart);
+    }
     /// <summary>
     /// Occurs when the WebView finishes navigating.
     /// </summary>
-    public event EventHandler NavigationEnd;
+    public event EventHandler NavigationEnd {
+        add => _window.AddWebViewHandler(ref _navigationEnd, value, NativeEventType.NavigationEnd);
+        remove => _window.RemoveWebViewHandler(ref _navigationEnd, value, NativeEventType.NavigationEnd);
+    }
     /// <summary>
     /// Occurs when the WebView receives a message from the page.
     /// </summary>
-    public event EventHandler<string> MessageReceived;
+    public event EventHandler<string> MessageReceived {
+        add => _window.AddWebViewHandler(ref _messageReceived, value, NativeEventType.MessageReceived);
+        remove => _window.RemoveWebViewHandler(ref _messageReceived, value, NativeEventType.MessageReceived);
+    }
     /// <summary>
     /// Occurs when the WebView requests a resource.
     /// </summary>
     public event EventHandler<WebResourceRequestedEventArgs> ResourceRequested;
 
-    internal WebView(Window window)
+    internal WebView(Window window, WebView owner = null)
     {
         NativeOptions = new() {
-            ContextMenuEnabled = true
+            ContextMenuEnabled = true,
+            SuspendDelay = 5000
         };
 
         NativeEvents = new() {
             OnCreated = InvokeCreated,
-            OnNavigationStart = InvokeNavigationStart,
-            OnNavigationEnd = InvokeNavigationEnd,
-            OnMessageReceived = InvokeMessageReceived,
             OnResourceRequested = InvokeResourceRequested
         };
 
         _window = window;
-        _binder = new WebViewBinder(this);
+        _binder = new WebViewBinder(this, owner?._binder);
     }
 
     /// <summary>
@@ -126,23 +149,74 @@ public partial class WebView
     }
 
     /// <summary>
-    /// Navigates to the specified URL or file.
+    /// Gets or sets the bounds of the WebView in the client area of its window.
     /// </summary>
-    /// <param name="url">The URL or file to navigate to.</param>
-    public void Navigate(string url)
-    {
-        if (HttpRegex.IsMatch(url)) {
-            Navigate(new Uri(url));
-            return;
+    /// <remarks>
+    /// Default: null, the WebView fills the window.
+    /// </remarks>
+    public Rectangle? Bounds {
+        get => _bounds;
+        set {
+            _bounds = value;
+            if (InstancePtr != nint.Zero)
+                SafeInvoke(ApplyBounds);
         }
+    }
 
-        var fullPath = Path.GetFullPath(url);
-        if (!File.Exists(fullPath)) 
-            throw new FileNotFoundException("The specified URL or file could not be found.", url);
+    /// <summary>
+    /// Gets or sets whether the WebView is shown in its window.
+    /// </summary>
+    /// <remarks>
+    /// A hidden WebView keeps its page, which is suspended once it has stayed hidden for <see cref="SuspendDelay"/>.
+    /// Showing it again resumes the page without reloading it.
+    /// Default: true
+    /// </remarks>
+    public bool IsVisible {
+        get => _visible;
+        set {
+            _visible = value;
+            if (InstancePtr != nint.Zero)
+                SafeInvoke(() => NativeWebView.SetVisible(InstancePtr, value));
+        }
+    }
 
-        Navigate(new Uri(fullPath, UriKind.Absolute));
+    /// <summary>
+    /// Gets or sets the position of the WebView in the stack of its window's WebViews, 0 being the back.
+    /// </summary>
+    /// <remarks>
+    /// WebViews added with <see cref="Gluino.Window.AddWebView"/> are placed in front of the existing ones.
+    /// </remarks>
+    public int ZIndex {
+        get => InstancePtr == nint.Zero ? -1 : SafeInvoke(() => NativeWindow.GetWebViewZIndex(_window.InstancePtr, InstancePtr));
+        set {
+            if (InstancePtr != nint.Zero)
+                SafeInvoke(() => NativeWindow.SetWebViewZIndex(_window.InstancePtr, InstancePtr, value));
+        }
     }
 
+    /// <summary>
+    /// Gets or sets how long, in milliseconds, a hidden WebView waits before its page is suspended and its memory trimmed.
+    /// </summary>
+    /// <remarks>
+    /// A negative value never suspends the page.
+    /// Default: 5000
+    /// </remarks>
+    public int SuspendDelay {
+        get => GetSuspendDelay();
+        set => SetSuspendDelay(value);
+    }
+
+    /// <summary>
+    /// Gets how much the WebView is currently throttled, by its window being in the background or by being hidden.
+    /// </summary>
+    public ThrottleLevel ThrottleLevel => InstancePtr == nint.Zero ? ThrottleLevel.Active : SafeInvoke(() => NativeWebView.GetThrottleLevel(InstancePtr));
+
+    /// <summary>
+    /// Navigates to the specified URL or file.
+    /// </summary>
+    /// <param name="url">The URL or file to navigate to.</param>
+    public void Navigate(string url) => Navigate(ResolveUrl(url));
+
     /// <summary>
     /// Navigates to the specified URL.
     /// </summary>
@@ -155,9 +229,74 @@ public partial class WebView
             return;
         }
 
+        if (_prerender != null && uri.ToString() == _prerenderUrl && ShowPrerender())
+            return;
+
         Invoke(() => NativeWebView.Navigate(InstancePtr, uri.ToString()));
     }
 
+    /// <summary>
+    /// Loads the specified URL or file in a hidden WebView, so that navigating to it later shows the page instantly.
+    /// </summary>
+    /// <param name="url">The URL or file to prerender.</param>
+    /// <remarks>
+    /// The hidden WebView is added to the window on the first call and reused by the next ones. It gets this WebView's
+    /// options, bindings, mounts, prefetch manifests and scripts injected on document creation, and raises
+    /// <see cref="ResourceRequested"/> on this WebView.<br />
+    /// Navigating to the prerendered URL swaps the pages in place: this WebView keeps its settings and events and shows
+    /// the prerendered page, and its previous page is hidden in the prerender slot, where it is suspended after
+    /// <see cref="SuspendDelay"/>.
+    /// </remarks>
+    public void Prerender(string url)
+    {
+        _prerenderUrl = ResolveUrl(url).ToString();
+
+        if (_prerender != null) {
+            _prerender.SuspendDelay = -1;
+            _prerender.Navigate(_prerenderUrl);
+            return;
+        }
+
+        _prerender = new WebView(_window, this) {
+            NativeOptions = NativeOptions,
+            _bounds = _bounds,
+            _visible = false
+        };
+        _prerender.NativeOptions.StartContentW = null;
+        _prerender.NativeOptions.StartContentA = null;
+        _prerender.NativeOptions.SuspendDelay = -1;
+        _prerender.StartUrl = _prerenderUrl;
+        _prerender.ContextMenuEnabled = ContextMenuEnabled;
+        _prerender.DevToolsEnabled = DevToolsEnabled;
+        _prerender.UserAgent = UserAgent;
+
+        foreach (var (prefix, mount) in _mounts)
+            _prerender._mounts[prefix] = mount;
+        foreach (var (route, manifest) in _prefetchManifests)
+            _prerender._prefetchManifests[route] = manifest;
+
+        _prerender.Created += (_, _) => {
+            foreach (var script in _documentScripts)
+                _prerender.InjectScriptOnDocumentCreated(script);
+        };
+        _prerender.ResourceRequested += (_, e) => ResourceRequested?.Invoke(this, e);
+
+        _window.AddWebView(_prerender);
+    }
+
+    /// <summary>
+    /// Removes the hidden WebView created by <see cref="Prerender"/> and closes its page.
+    /// </summary>
+    public void CancelPrerender()
+    {
+        if (_prerender == null)
+            return;
+
+        _window.RemoveWebView(_prerender);
+        _prerender = null;
+        _prerenderUrl = null;
+    }
+
     /// <summary>
     /// Navigates to the specified HTML content.
     /// </summary>
@@ -189,7 +328,18 @@ public partial class WebView
     /// Injects the specified JavaScript code when the document is created.
     /// </summary>
     /// <param name="script">The JavaScript code to inject.</param>
-    public void InjectScriptOnDocumentCreated(string script) => SafeInvoke(() => NativeWebView.InjectScript(InstancePtr, script, true));
+    /// <remarks>
+    /// Each script is registered once; injecting the same script again has no effect.
+    /// </remarks>
+    public void InjectScriptOnDocumentCreated(string script)
+    {
+        if (_documentScripts.Contains(script))
+            return;
+
+        _documentScripts.Add(script);
+        SafeInvoke(() => NativeWebView.InjectScript(InstancePtr, script, true));
+        _prerender?.InjectScriptOnDocumentCreated(script);
+    }
     
     /// <summary>
     /// Bind a C# method to JavaScript.
@@ -213,14 +363,205 @@ public partial class WebView
     /// </remarks>
     public void Bind(string name, Delegate fn) => _binder.Bind(name, fn);
 
+    /// <summary>
+    /// Route bound function calls and streams over a <see cref="LoopbackServer"/> instead of web messages.
+    /// </summary>
+    /// <param name="server">The started <see cref="LoopbackServer"/> to use.</param>
+    /// <remarks>
+    /// Bound functions are called with <c>fetch</c> and run on a connection thread of the server.
+    /// <c>window.gluino.openStream(name)</c> opens a binary WebSocket whose path is "stream/{name}",
+    /// which is handled through the <see cref="LoopbackServer"/> socket events.
+    /// </remarks>
+    public void UseLoopbackBridge(LoopbackServer server) => _binder.UseLoopback(server);
+
+    /// <summary>
+    /// Serve requests whose URL starts with the specified prefix from a <see cref="VirtualFileSystem"/>.
+    /// </summary>
+    /// <param name="prefix">The URL prefix to mount at (e.g. "app://").</param>
+    /// <param name="vfs">The <see cref="VirtualFileSystem"/> to serve from.</param>
+    /// <remarks>
+    /// Requests served natively do not raise <see cref="ResourceRequested"/>.
+    /// </remarks>
+    public void Mount(string prefix, VirtualFileSystem vfs) =>
+        AddMount(prefix, instance => NativeWebView.MountVfs(instance, prefix, vfs.InstancePtr));
+
+    /// <summary>
+    /// Serve requests whose URL starts with the specified prefix from a native <see cref="ResourcePlugin"/>.
+    /// </summary>
+    /// <param name="prefix">The URL prefix to mount at (e.g. "app://tiles/").</param>
+    /// <param name="plugin">The <see cref="ResourcePlugin"/> to serve from.</param>
+    /// <remarks>
+    /// Requests served natively do not raise <see cref="ResourceRequested"/>.
+    /// </remarks>
+    public void Mount(string prefix, ResourcePlugin plugin) =>
+        AddMount(prefix, instance => NativeWebView.MountPlugin(instance, prefix, plugin.InstancePtr));
+
+    /// <summary>
+    /// Remove the resource handler mounted at the specified prefix.
+    /// </summary>
+    /// <param name="prefix">The URL prefix to unmount.</param>
+    public void Unmount(string prefix)
+    {
+        if (!_mounts.Remove(prefix))
+            return;
+        if (InstancePtr != nint.Zero)
+            NativeWebView.Unmount(InstancePtr, prefix);
+        _prerender?.Unmount(prefix);
+    }
+
+    /// <summary>
+    /// Register a local file to be served natively, read from disk as the page requests it.
+    /// </summary>
+    /// <param name="path">The path of the file.</param>
+    /// <param name="contentType">The content type of the file, or <see langword="null"/> to infer it from the extension.</param>
+    /// <returns>An opaque "app://files/" URL that serves the file with range support.</returns>
+    /// <exception cref="InvalidOperationException">The WebView has not been created yet.</exception>
+    /// <exception cref="IOException">The file could not be opened.</exception>
+    /// <remarks>
+    /// The URL stays valid until it is revoked or the window is closed. A file that grows or shrinks is served at its
+    /// current length; one truncated while a response is streamed cuts that response short.
+    /// </remarks>
+    public string RegisterFile(string path, string contentType = null)
+    {
+        if (InstancePtr == nint.Zero)
+            throw new InvalidOperationException("The WebView has not been created yet.");
+
+        var url = new StringBuilder(1024);
+        if (!NativeWebView.RegisterFile(InstancePtr, Path.GetFullPath(path), contentType, url, url.Capacity))
+            throw new IOException($"Failed to open file '{path}'.");
+        return url.ToString();
+    }
+
+    /// <summary>
+    /// Revoke a URL returned by <see cref="RegisterFile"/>.
+    /// </summary>
+    /// <param name="url">The URL to revoke.</param>
+    /// <returns><see langword="true"/> if the URL was registered; otherwise, <see langword="false"/>.</returns>
+    public bool RevokeFile(string url) => InstancePtr != nint.Zero && NativeWebView.RevokeFile(InstancePtr, url);
+
+    /// <summary>
+    /// Register the assets to prefetch into the native resource cache when navigation to a route begins.
+    /// </summary>
+    /// <param name="route">The URL of the route, or a URL prefix followed by "*".</param>
+    /// <param name="urls">The absolute URLs of the assets to prefetch.</param>
+    /// <remarks>
+    /// Assets are loaded in parallel on worker threads through the mounted <see cref="VirtualFileSystem"/>s
+    /// and stay cached until they are invalidated.
+    /// </remarks>
+    public void SetPrefetchManifest(string route, IEnumerable<string> urls)
+    {
+        var manifest = urls.ToArray();
+        _prefetchManifests[route] = manifest;
+        if (InstancePtr != nint.Zero)
+            NativeWebView.SetPrefetchManifest(InstancePtr, route, manifest, manifest.Length);
+        _prerender?.SetPrefetchManifest(route, manifest);
+    }
+
+    /// <summary>
+    /// Remove the prefetch manifest of the specified route.
+    /// </summary>
+    /// <param name="route">The route passed to <see cref="SetPrefetchManifest"/>.</param>
+    public void RemovePrefetchManifest(string route)
+    {
+        if (!_prefetchManifests.Remove(route))
+            return;
+        if (InstancePtr != nint.Zero)
+            NativeWebView.RemovePrefetchManifest(InstancePtr, route);
+        _prerender?.RemovePrefetchManifest(route);
+    }
+
+    /// <summary>
+    /// Prefetch the manifest of the specified route without navigating.
+    /// </summary>
+    /// <param name="url">The URL of the route.</param>
+    /// <remarks>
+    /// Useful for client-side route transitions, which do not raise <see cref="NavigationStart"/>.
+    /// </remarks>
+    public void Prefetch(string url)
+    {
+        if (InstancePtr != nint.Zero)
+            NativeWebView.Prefetch(InstancePtr, url);
+    }
+
+    private void AddMount(string prefix, Action<nint> mount)
+    {
+        _mounts[prefix] = mount;
+        if (InstancePtr != nint.Zero)
+            mount(InstancePtr);
+        _prerender?.AddMount(prefix, mount);
+    }
+
+    private bool ShowPrerender()
+    {
+        // The swap exchanges the suspend delays along with the pages; this WebView keeps its own.
+        var suspendDelay = SuspendDelay;
+        if (!Invoke(() => NativeWindow.SwapWebViews(_window.InstancePtr, InstancePtr, _prerender.InstancePtr)))
+            return false;
+
+        _prerenderUrl = null;
+        SuspendDelay = suspendDelay;
+        _prerender.SuspendDelay = suspendDelay;
+        return true;
+    }
+
+    private static Uri ResolveUrl(string url)
+    {
+        if (HttpRegex.IsMatch(url))
+            return new Uri(url);
+
+        var fullPath = Path.GetFullPath(url);
+        if (!File.Exists(fullPath)) 
+            throw new FileNotFoundException("The specified URL or file could not be found.", url);
+
+        return new Uri(fullPath, UriKind.Absolute);
+    }
+
+    internal void CreateNative()
+    {
+        InstancePtr = NativeWindow.AddWebView(_window.InstancePtr, ref NativeOptions, ref NativeEvents, out ViewId);
+        if (InstancePtr != nint.Zero)
+            InitializeNative();
+    }
+
+    internal void InitializeNative()
+    {
+        foreach (var mount in _mounts.Values)
+            mount(InstancePtr);
+        foreach (var (route, manifest) in _prefetchManifests)
+            NativeWebView.SetPrefetchManifest(InstancePtr, route, manifest, manifest.Length);
+        if (_bounds != null)
+            ApplyBounds();
+        if (!_visible)
+            NativeWebView.SetVisible(InstancePtr, false);
+    }
+
+    internal bool HasSubscribers(NativeEventType type) => type switch {
+        NativeEventType.NavigationStart => _navigationStart != null,
+        NativeEventType.NavigationEnd => _navigationEnd != null,
+        NativeEventType.MessageReceived => _messageReceived != null,
+        _ => false
+    };
+
+    private void ApplyBounds()
+    {
+        if (_bounds is { } bounds) {
+            var rect = new NativeRect { X = bounds.X, Y = bounds.Y, Width = bounds.Width, Height = bounds.Height };
+            NativeWebView.SetBounds(InstancePtr, ref rect);
+        }
+        else {
+            NativeWebView.ClearBounds(InstancePtr, nint.Zero);
+        }
+    }
+
     private void Invoke(Action action) => _window.Invoke(action);
+    private T Invoke<T>(Func<T> func) => _window.Invoke(func);
     private void SafeInvoke(Action action) => _window.SafeInvoke(action);
     private T SafeInvoke<T>(Func<T> func) => _window.SafeInvoke(func);
     
     private void InvokeCreated() => Created?.Invoke(this, EventArgs.Empty);
-    private void InvokeNavigationStart(string url) => NavigationStart?.Invoke(this, new (url));
-    private void InvokeNavigationEnd() => NavigationEnd?.Invoke(this, EventArgs.Empty);
-    private void InvokeMessageReceived(string message) => MessageReceived?.Invoke(this, message);
+    internal void InvokeNavigationStart(string url) => _navigationStart?.Invoke(this, new (url));
+    internal void InvokeNavigationEnd() => _navigationEnd?.Invoke(this, EventArgs.Empty);
+    internal void InvokeMessageReceived(string message) => _messageReceived?.Invoke(this, message);
 
     private void InvokeResourceRequested(NativeWebResourceRequest request, out NativeWebResourceResponse response)
     {
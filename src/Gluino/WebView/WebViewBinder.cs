@@ -13,13 +13,23 @@ internal class WebViewBinder
     };
 
     private readonly WebView _webView;
-    private readonly ConcurrentDictionary<string, Delegate> _bindings = new();
+    private readonly ConcurrentDictionary<string, Delegate> _bindings;
     private readonly List<string> _initBindings = [];
+    private readonly string _bridgeId = Guid.NewGuid().ToString("N");
+    private LoopbackServer _bridge;
 
-    public WebViewBinder(WebView webView)
+    public WebViewBinder(WebView webView, WebViewBinder owner = null)
     {
         _webView = webView;
         _webView.MessageReceived += OnWebViewMessageReceived;
+
+        // A prerender WebView answers calls with its owner's bindings; its scripts are replayed from the owner.
+        if (owner != null) {
+            _bindings = owner._bindings;
+            return;
+        }
+
+        _bindings = new();
         _webView.Created += OnWebViewCreated;
     }
 
@@ -71,32 +81,102 @@ internal class WebViewBinder
 
     public void Bind(string name, Delegate fn)
     {
-        var methodInfo = fn.Method;
-        var parameters = methodInfo.GetParameters();
+        // The stub depends only on the name, so re-binding a name replaces its delegate and keeps
+        // the one script already registered for it instead of adding another.
+        if (!_bindings.TryAdd(name, fn)) {
+            _bindings[name] = fn;
+            return;
+        }
 
-        var jsArgs = string.Join(", ", parameters.Select(p => p.Name));
         var jsFunc =
             $$"""
-            window.gluino.{{name}} = function({{jsArgs}}) {
+            window.gluino.{{name}} = function(...args) {
               return new Promise((resolve) => {
-                window.gluino.invoke('{{name}}', [{{jsArgs}}], resolve);
+                window.gluino.invoke('{{name}}', args, resolve);
               });
             }
             """;
 
-        if (!_bindings.ContainsKey(name))
-            _bindings.TryAdd(name, fn);
-        else
-            _bindings[name] = fn;
-
         if (_webView.InstancePtr == nint.Zero) {
             _initBindings.Add(jsFunc);
             return;
         }
 
+        _webView.InjectScriptOnDocumentCreated(jsFunc);
         _webView.InjectScript(jsFunc);
     }
 
+    public void UseLoopback(LoopbackServer server)
+    {
+        if (_bridge != null)
+            _bridge.RequestReceived -= OnBridgeRequestReceived;
+
+        _bridge = server;
+        _bridge.RequestReceived += OnBridgeRequestReceived;
+
+        var jsBridge =
+            $$"""
+            (function () {
+              const baseUrl = '{{server.BaseUrl}}';
+              window.gluino.bridgeUrl = baseUrl;
+
+              window.gluino.invoke = function (name, args, cb) {
+                fetch(baseUrl + 'bind/{{_bridgeId}}', {
+                  method: 'POST',
+                  headers: { 'Content-Type': 'text/plain' },
+                  body: JSON.stringify({ name, args }),
+                })
+                  .then((res) => res.json())
+                  .then((data) => cb(data.ret));
+              };
+
+              window.gluino.openStream = function (name) {
+                const socket = new WebSocket(baseUrl.replace(/^http/, 'ws') + 'stream/' + encodeURIComponent(name));
+                socket.binaryType = 'arraybuffer';
+                return socket;
+              };
+            })();
+            """;
+
+        if (_webView.InstancePtr == nint.Zero) {
+            _initBindings.Insert(0, jsBridge);
+            return;
+        }
+
+        _webView.InjectScriptOnDocumentCreated(jsBridge);
+        _webView.InjectScript(jsBridge);
+    }
+
+    private void OnBridgeRequestReceived(object sender, LoopbackRequestEventArgs e)
+    {
+        if (e.Request.Method != "POST" || e.Request.Path != $"bind/{_bridgeId}")
+            return;
+
+        var data = JsonSerializer.Deserialize<BindData>(e.Request.Body, JsonOptions);
+
+        e.Response.StatusCode = 200;
+        e.Response.ContentType = "application/json";
+        e.Response.Content = JsonSerializer.SerializeToUtf8Bytes(
+            TryInvoke(data, out var result) ? (object)new { Ret = result } : new { }, JsonOptions);
+    }
+
+    private bool TryInvoke(BindData data, out object result)
+    {
+        result = null;
+        if (!_bindings.TryGetValue(data.Name, out var fn))
+            return false;
+
+        // Calls pass whatever the page passed: extra arguments are dropped and missing ones take
+        // the parameter's default.
+        var parameters = fn.Method.GetParameters();
+        var args = parameters.Select((parameter, i) => data.Args != null && i < data.Args.Count
+            ? data.Args[i].Deserialize(parameter.ParameterType, JsonOptions)
+            : parameter.HasDefaultValue ? parameter.DefaultValue : null).ToArray();
+
+        result = fn.DynamicInvoke(args);
+        return true;
+    }
+
     private void SendData(object data)
     {
         var json = JsonSerializer.Serialize(data, JsonOptions);
@@ -109,22 +189,13 @@ internal class WebViewBinder
 
         var json = e[BindPrefix.Length..];
         var data = JsonSerializer.Deserialize<BindData>(json, JsonOptions);
-        
-        if (!_bindings.ContainsKey(data.Name)) {
+
+        if (!TryInvoke(data, out var result)) {
             if (data.Id != null) {
                 SendData(new { data.Id });
             }
             return;
         }
-        if (!_bindings.TryGetValue(data.Name, out var fn)) return;
-
-        var parameters = fn.Method.GetParameters();
-        var args = data.Args.Select((arg, i) => {
-            var type = parameters[i].ParameterType;
-            return arg.Deserialize(type, JsonOptions);
-        }).ToArray();
-
-        var result = fn.DynamicInvoke(args);
 
         SendData(new {
             data.Id,
@@ -0,0 +1,20 @@
+﻿namespace Gluino;
+
+/// <summary>
+/// Represents how much work a hidden or minimized <see cref="Window"/> is allowed to do.
+/// </summary>
+public enum ThrottleLevel
+{
+    /// <summary>
+    /// The window is visible and runs normally.
+    /// </summary>
+    Active,
+    /// <summary>
+    /// The window is in the background; its events, messages and timers are held.
+    /// </summary>
+    Throttled,
+    /// <summary>
+    /// The window has been in the background long enough for its web page to be suspended.
+    /// </summary>
+    Suspended
+}
\ No newline at end of file
@@ -1,4 +1,7 @@
-﻿using System.Drawing;
+﻿using System.Collections.Concurrent;
+using System.Drawing;
+using System.Reflection;
+using System.Runtime.InteropServices;
 using Gluino.Interop;
 
 namespace Gluino;
@@ -8,7 +11,32 @@ namespace Gluino;
 /// </summary>
 public partial class Window
 {
-    private readonly int _managedWindowThreadId;
+    private static readonly NativePtrDelegate BeginInvokeAction = RunBeginInvoke;
+    private static readonly NativePtrDelegate InvokeAsyncAction = RunInvokeAsync;
+    private static readonly NativePtrDelegate InvokeAsyncCallback = CompleteInvokeAsync;
+    private static readonly NativePtrDelegate TimerCallback = RunTimer;
+    private static readonly NativeSpawnDelegate SpawnCallback = CompleteSpawn;
+    private static readonly ConcurrentDictionary<int, WindowTimer> Timers = new();
+    private static int _nextTimerId;
+
+    private readonly object _eventMaskLock = new();
+    private readonly List<WebView> _webViews = [];
+    private uint _eventMask;
+    private uint _overriddenEvents;
+    private EventHandler _shown;
+    private EventHandler _hidden;
+    private EventHandler<Size> _resize;
+    private EventHandler<Size> _resizeStart;
+    private EventHandler<Size> _resizeEnd;
+    private EventHandler<Point> _locationChanged;
+    private EventHandler<WindowStateChangedEventArgs> _windowStateChanged;
+    private EventHandler _focusIn;
+    private EventHandler _focusOut;
+    private EventHandler<WindowClosingEventArgs> _closing;
+
+    private int _managedWindowThreadId;
+    private TaskCompletionSource _spawnCompletion;
+    private UiThread _uiThread;
 
     internal nint InstancePtr;
     internal NativeWindowOptions NativeOptions;
@@ -25,43 +53,73 @@ public partial class Window
     /// <summary>
     /// Occurs when the window is shown.
     /// </summary>
-    public event EventHandler Shown;
+    public event EventHandler Shown {
+        add => AddHandler(ref _shown, value, NativeEventType.Shown);
+        remove => RemoveHandler(ref _shown, value, NativeEventType.Shown);
+    }
     /// <summary>
     /// Occurs when the window is hidden.
     /// </summary>
-    public event EventHandler Hidden;
+    public event EventHandler Hidden {
+        add => AddHandler(ref _hidden, value, NativeEventType.Hidden);
+        remove => RemoveHandler(ref _hidden, value, NativeEventType.Hidden);
+    }
     /// <summary>
     /// Occurs when the window is resized.
     /// </summary>
-    public event EventHandler<Size> Resize;
+    public event EventHandler<Size> Resize {
+        add => AddHandler(ref _resize, value, NativeEventType.Resize);
+        remove => RemoveHandler(ref _resize, value, NativeEventType.Resize);
+    }
     /// <summary>
     /// Occurs when the window resize operation starts.
     /// </summary>
-    public event EventHandler<Size> ResizeStart;
+    public event EventHandler<Size> ResizeStart {
+        add => AddHandler(ref _resizeStart, value, NativeEventType.ResizeStart);
+        remove => RemoveHandler(ref _resizeStart, value, NativeEventType.ResizeStart);
+    }
     /// <summary>
     /// Occurs when the window resize operation ends.
     /// </summary>
-    public event EventHandler<Size> ResizeEnd;
+    public event EventHandler<Size> ResizeEnd {
+        add => AddHandler(ref _resizeEnd, value, NativeEventType.ResizeEnd);
+        remove => RemoveHandler(ref _resizeEnd, value, NativeEventType.ResizeEnd);
+    }
     /// <summary>
     /// Occurs when the window location is changed.
     /// </summary>
-    public event EventHandler<Point> LocationChanged;
+    public event EventHandler<Point> LocationChanged {
+        add => AddHandler(ref _locationChanged, value, NativeEventType.LocationChanged);
+        remove => RemoveHandler(ref _locationChanged, value, NativeEventType.LocationChanged);
+    }
     /// <summary>
     /// Occurs when the window state is changed.
     /// </summary>
-    public event EventHandler<WindowStateChangedEventArgs> WindowStateChanged; 
+    public event EventHandler<WindowStateChangedEventArgs> WindowStateChanged {
+        add => AddHandler(ref _windowStateChanged, value, NativeEventType.WindowStateChanged);
+        remove => RemoveHandler(ref _windowStateChanged, value, NativeEventType.WindowStateChanged);
+    }
     /// <summary>
     /// Occurs when the window gains focus.
     /// </summary>
-    public event EventHandler FocusIn;
+    public event EventHandler FocusIn {
+        add => AddHandler(ref _focusIn, value, NativeEventType.FocusIn);
+        remove => RemoveHandler(ref _focusIn, value, NativeEventType.FocusIn);
+    }
     /// <summary>
     /// Occurs when the window loses focus.
     /// </summary>
-    public event EventHandler FocusOut;
+    public event EventHandler FocusOut {
+        add => AddHandler(ref _focusOut, value, NativeEventType.FocusOut);
+        remove => RemoveHandler(ref _focusOut, value, NativeEventType.FocusOut);
+    }
     /// <summary>
     /// Occurs when the window is closing.
     /// </summary>
-    public event EventHandler<WindowClosingEventArgs> Closing;
+    public event EventHandler<WindowClosingEventArgs> Closing {
+        add => AddHandler(ref _closing, value, NativeEventType.Closing);
+        remove => RemoveHandler(ref _closing, value, NativeEventType.Closing);
+    }
     /// <summary>
     /// Occurs when the window is closed.
     /// </summary>
@@ -85,26 +143,30 @@ public partial class Window
                 Height = 600
             },
             MinimizeEnabled = true,
-            MaximizeEnabled = true
+            MaximizeEnabled = true,
+            BackgroundThrottling = true,
+            BrowserSuspendDelay = -1
         };
 
         Title = "Window";
 
+        // Overridden On* methods are always delivered, whether or not handlers are attached.
+        foreach (var type in Enum.GetValues<NativeEventType>()) {
+            var method = GetType().GetMethod($"On{type}", BindingFlags.Instance | BindingFlags.NonPublic);
+            if (method != null && method.DeclaringType != typeof(Window))
+                _overriddenEvents |= 1u << (int)type;
+        }
+        _eventMask = _overriddenEvents;
+
         NativeEvents = new() {
-            OnShown = InvokeShown,
-            OnHidden = InvokeHidden,
-            OnResize = InvokeResize,
-            OnResizeStart = InvokeResizeStart,
-            OnResizeEnd = InvokeResizeEnd,
-            OnLocationChanged = InvokeLocationChanged,
-            OnWindowStateChanged = InvokeWindowStateChanged,
-            OnFocusIn = InvokeFocusIn,
-            OnFocusOut = InvokeFocusOut,
             OnClosing = InvokeClosing,
-            OnClosed = InvokeClosed
+            OnClosed = InvokeClosed,
+            OnEvents = DispatchEvents,
+            Subscriptions = _eventMask
         };
 
         WebView = new(this);
+        _webViews.Add(WebView);
     }
 
     /// <summary>
@@ -112,6 +174,11 @@ public partial class Window
     /// </summary>
     public WebView WebView { get; }
 
+    /// <summary>
+    /// Get the WebViews hosted by this window, starting with <see cref="WebView"/>.
+    /// </summary>
+    public IReadOnlyList<WebView> WebViews => _webViews;
+
     /// <summary>
     /// Get or set the title of the window.
     /// </summary>
@@ -195,7 +262,7 @@ public partial class Window
     /// <remarks>
     /// Only supported on systems that support light and dark themes.
     /// </remarks>
-    public bool IsDarkMode => SafeInvoke(() => NativeWindow.GetIsDarkMode(InstancePtr));
+    public bool IsDarkMode => InstancePtr != nint.Zero && NativeWindow.GetIsDarkMode(InstancePtr);
 
     /// <summary>
     /// Get or set the startup location of the window.
@@ -306,17 +373,82 @@ public partial class Window
         set => SetTopMost(value);
     }
 
+    /// <summary>
+    /// Get or set the minimum interval, in milliseconds, between <see cref="Resize"/> and
+    /// <see cref="LocationChanged"/> notifications while the window is being resized or moved.
+    /// </summary>
+    /// <remarks>
+    /// Bursts are coalesced and the final geometry is always reported when the operation ends.
+    /// A value of 0 paces notifications to the refresh rate of the window's display.
+    /// Default: 0
+    /// </remarks>
+    public int GeometryEventInterval {
+        get => GetGeometryEventInterval();
+        set => SetGeometryEventInterval(value);
+    }
+
+    /// <summary>
+    /// Get or set whether the window does less work while it is hidden or minimized.
+    /// </summary>
+    /// <remarks>
+    /// A throttled window holds its events and the messages sent to its web page, and its timers
+    /// do not run; all of them resume when the window is shown or restored.
+    /// Default: true
+    /// </remarks>
+    public bool BackgroundThrottling {
+        get => GetBackgroundThrottling();
+        set => SetBackgroundThrottling(value);
+    }
+
+    /// <summary>
+    /// Get or set how long, in milliseconds, a throttled window waits before suspending its web page.
+    /// </summary>
+    /// <remarks>
+    /// A suspended page runs no script until the window is shown or restored.
+    /// A negative value never suspends the page.
+    /// Default: -1
+    /// </remarks>
+    public int BrowserSuspendDelay {
+        get => GetBrowserSuspendDelay();
+        set => SetBrowserSuspendDelay(value);
+    }
+
+    /// <summary>
+    /// Get how much the window is currently throttled.
+    /// </summary>
+    public ThrottleLevel ThrottleLevel => InstancePtr == nint.Zero ? ThrottleLevel.Active : NativeWindow.GetThrottleLevel(InstancePtr);
+
     /// <summary>
     /// Get the bounding rectangle of the window.
     /// </summary>
     public Rectangle Bounds {
         get {
             var bounds = NativeRect.Empty;
-            SafeInvoke(() => NativeWindow.GetBounds(InstancePtr, out bounds));
+            if (InstancePtr != nint.Zero)
+                NativeWindow.GetBounds(InstancePtr, out bounds);
             return new(bounds.X, bounds.Y, bounds.Width, bounds.Height);
         }
     }
 
+    /// <summary>
+    /// Get a consistent view of the window's geometry and state.
+    /// </summary>
+    /// <remarks>
+    /// The snapshot is published by the window thread whenever it observes a change and
+    /// can be read from any thread without waiting on the window thread.
+    /// </remarks>
+    public WindowSnapshot Snapshot {
+        get {
+            if (InstancePtr == nint.Zero) {
+                return new(0, new(NativeOptions.Location, NativeOptions.Size), NativeOptions.WindowState, false);
+            }
+
+            NativeWindow.GetSnapshot(InstancePtr, out var snapshot);
+            var bounds = snapshot.Bounds;
+            return new(snapshot.Version, new(bounds.X, bounds.Y, bounds.Width, bounds.Height), snapshot.WindowState, snapshot.IsDarkMode);
+        }
+    }
+
     /// <summary>
     /// Get the native window handle.
     /// </summary>
@@ -331,6 +463,23 @@ public partial class Window
         }
     }
 
+    /// <summary>
+    /// Get or set the <see cref="Gluino.UiThread"/> the window is created on.
+    /// </summary>
+    /// <remarks>
+    /// Default: null, the window runs on the thread that runs the application.<br />
+    /// Can only be set before the window is shown for the first time.
+    /// </remarks>
+    /// <exception cref="InvalidOperationException">The window has already been created.</exception>
+    public UiThread UiThread {
+        get => _uiThread;
+        set {
+            if (InstancePtr != nint.Zero)
+                throw new InvalidOperationException("The window has already been created");
+            _uiThread = value;
+        }
+    }
+
     internal bool IsMain {
         set {
             if (InstancePtr == nint.Zero)
@@ -345,13 +494,20 @@ public partial class Window
     /// </summary>
     public void Show()
     {
+        if (_spawnCompletion != null && InstancePtr == nint.Zero)
+            return;
+
         if (InstancePtr == nint.Zero) {
             InvokeCreating();
 
             NativeApp.SpawnWindow(App.NativeInstance, 
                 ref NativeOptions, ref NativeEvents, 
                 ref WebView.NativeOptions, ref WebView.NativeEvents, 
-                out InstancePtr, out WebView.InstancePtr);
+                _uiThread?.InstancePtr ?? nint.Zero, out InstancePtr, out WebView.InstancePtr);
+            if (_uiThread != null)
+                NativeWindow.Invoke(InstancePtr, () => _managedWindowThreadId = Environment.CurrentManagedThreadId);
+            WebView.InitializeNative();
+            Invoke(CreateWebViews);
             App.ActiveWindows.Add(this);
             InvokeCreated();
         }
@@ -359,6 +515,88 @@ public partial class Window
         Invoke(() => NativeWindow.Show(InstancePtr));
     }
 
+    /// <summary>
+    /// Create the window without waiting for its WebView, and show it once the WebView's first navigation has committed.
+    /// </summary>
+    /// <remarks>
+    /// WebView creation runs in the background, so windows opened together with <see cref="ShowAsync"/> initialize
+    /// in parallel rather than one after another. Calls made on a window still being created are ignored.
+    /// </remarks>
+    /// <returns>A task that completes once the WebView has been created.</returns>
+    public Task ShowAsync()
+    {
+        if (_spawnCompletion != null)
+            return _spawnCompletion.Task;
+
+        if (InstancePtr != nint.Zero) {
+            Show();
+            return Task.CompletedTask;
+        }
+
+        InvokeCreating();
+
+        _spawnCompletion = new(TaskCreationOptions.RunContinuationsAsynchronously);
+        var task = _spawnCompletion.Task;
+        var handle = GCHandle.Alloc(this);
+        NativeApp.SpawnWindowAsync(App.NativeInstance,
+            ref NativeOptions, ref NativeEvents,
+            ref WebView.NativeOptions, ref WebView.NativeEvents,
+            _uiThread?.InstancePtr ?? nint.Zero, SpawnCallback, GCHandle.ToIntPtr(handle));
+        return task;
+    }
+
+    /// <summary>
+    /// Add a WebView to the window, in front of the existing ones.
+    /// </summary>
+    /// <param name="configure">Sets the start page and options of the WebView before it is created.</param>
+    /// <returns>The new <see cref="Gluino.WebView"/>.</returns>
+    /// <remarks>
+    /// All WebViews of a window share one browser environment. Use <see cref="Gluino.WebView.Bounds"/> and
+    /// <see cref="Gluino.WebView.IsVisible"/> to lay them out, for example one per tab. If the window has not been
+    /// created yet, the WebView is created together with it.
+    /// </remarks>
+    public WebView AddWebView(Action<WebView> configure = null)
+    {
+        var webView = new WebView(this);
+        configure?.Invoke(webView);
+        return AddWebView(webView);
+    }
+
+    internal WebView AddWebView(WebView webView)
+    {
+        // Handlers attached while it was being configured count once it is added.
+        lock (_eventMaskLock) {
+            _webViews.Add(webView);
+            UpdateWebViewEventMasks();
+        }
+
+        if (InstancePtr != nint.Zero)
+            Invoke(webView.CreateNative);
+        return webView;
+    }
+
+    /// <summary>
+    /// Remove a WebView added with <see cref="AddWebView"/> and close its page.
+    /// </summary>
+    /// <param name="webView">The WebView to remove.</param>
+    /// <exception cref="InvalidOperationException">The WebView is the window's primary <see cref="WebView"/>.</exception>
+    public void RemoveWebView(WebView webView)
+    {
+        if (webView == WebView)
+            throw new InvalidOperationException("The primary WebView cannot be removed.");
+        lock (_eventMaskLock) {
+            if (!_webViews.Remove(webView))
+                return;
+        }
+
+        if (webView.InstancePtr != nint.Zero)
+            SafeInvoke(() => NativeWindow.RemoveWebView(InstancePtr, webView.InstancePtr));
+        webView.InstancePtr = nint.Zero;
+
+        lock (_eventMaskLock)
+            UpdateWebViewEventMasks();
+    }
+
     /// <summary>
     /// Hide the window.
     /// </summary>
@@ -388,6 +626,107 @@ public partial class Window
     /// </summary>
     public void DragMove() => SafeInvoke(() => NativeWindow.DragMove(InstancePtr));
 
+    /// <summary>
+    /// Queue an action to run on the window thread without waiting for it to complete.
+    /// </summary>
+    /// <param name="action">The action to run.</param>
+    public void BeginInvoke(Action action)
+    {
+        ArgumentNullException.ThrowIfNull(action);
+
+        if (InstancePtr == nint.Zero)
+            return;
+
+        var handle = GCHandle.Alloc(action);
+        NativeWindow.BeginInvoke(InstancePtr, BeginInvokeAction, GCHandle.ToIntPtr(handle));
+    }
+
+    /// <summary>
+    /// Queue an action to run on the window thread.
+    /// </summary>
+    /// <param name="action">The action to run.</param>
+    /// <returns>A task that completes once the action has run on the window thread.</returns>
+    public Task InvokeAsync(Action action)
+    {
+        ArgumentNullException.ThrowIfNull(action);
+
+        if (InstancePtr == nint.Zero)
+            return Task.CompletedTask;
+
+        var invocation = new AsyncInvocation(action);
+        var handle = GCHandle.Alloc(invocation);
+        NativeWindow.InvokeAsync(InstancePtr, InvokeAsyncAction, GCHandle.ToIntPtr(handle), InvokeAsyncCallback);
+        return invocation.Completion.Task;
+    }
+
+    /// <summary>
+    /// Start a timer that runs on the window thread.
+    /// </summary>
+    /// <remarks>
+    /// Deadlines are rounded up to the timer slack of the window's UI loop (see <see cref="App.TimerSlack"/> and
+    /// <see cref="Gluino.UiThread.TimerSlack"/>) so that nearby timers share a wakeup. Timers stop when the window closes.
+    /// </remarks>
+    /// <param name="dueTime">The delay before the callback first runs.</param>
+    /// <param name="period">The interval between subsequent runs, or <see cref="TimeSpan.Zero"/> to run once.</param>
+    /// <param name="callback">The callback to run.</param>
+    /// <returns>An identifier that can be passed to <see cref="StopTimer"/>, or 0 if the window has not been created.</returns>
+    public int StartTimer(TimeSpan dueTime, TimeSpan period, Action callback)
+    {
+        ArgumentNullException.ThrowIfNull(callback);
+
+        if (InstancePtr == nint.Zero)
+            return 0;
+
+        var id = Interlocked.Increment(ref _nextTimerId);
+        var timer = new WindowTimer(this, callback, period > TimeSpan.Zero);
+        Timers[id] = timer;
+        timer.NativeId = NativeWindow.StartTimer(InstancePtr, (long)dueTime.TotalMicroseconds, (long)period.TotalMicroseconds, TimerCallback, id);
+        return id;
+    }
+
+    /// <summary>
+    /// Stop a timer started with <see cref="StartTimer"/>.
+    /// </summary>
+    /// <param name="id">The identifier returned by <see cref="StartTimer"/>.</param>
+    /// <returns>true if the timer was still pending; otherwise, false.</returns>
+    public bool StopTimer(int id)
+    {
+        if (!Timers.TryRemove(id, out var timer))
+            return false;
+
+        return InstancePtr != nint.Zero && NativeWindow.StopTimer(InstancePtr, timer.NativeId);
+    }
+
+    /// <summary>
+    /// Deliver any queued window and WebView events now instead of at the next iteration of the window's loop.
+    /// </summary>
+    public void FlushEvents() => SafeInvoke(() => NativeWindow.FlushEvents(InstancePtr));
+
+    /// <summary>
+    /// Begin a set of property changes that are applied together when committed.
+    /// </summary>
+    /// <returns>A <see cref="WindowChangeSet"/> to collect the changes in.</returns>
+    public WindowChangeSet BeginChanges() => new(this);
+
+    internal void ApplyChanges(NativeWindowChangeSet changes)
+    {
+        if (InstancePtr != nint.Zero) {
+            Invoke(() => NativeWindow.ApplyChanges(InstancePtr, ref changes));
+            return;
+        }
+
+        if (changes.Changes.HasFlag(NativeWindowChange.Size)) NativeOptions.Size = changes.Size;
+        if (changes.Changes.HasFlag(NativeWindowChange.Location)) NativeOptions.Location = changes.Location;
+        if (changes.Changes.HasFlag(NativeWindowChange.WindowState)) NativeOptions.WindowState = changes.WindowState;
+        if (changes.Changes.HasFlag(NativeWindowChange.BorderStyle)) NativeOptions.BorderStyle = changes.BorderStyle;
+        if (changes.Changes.HasFlag(NativeWindowChange.Theme)) NativeOptions.Theme = changes.Theme;
+        if (changes.Changes.HasFlag(NativeWindowChange.MinimumSize)) NativeOptions.MinimumSize = changes.MinimumSize;
+        if (changes.Changes.HasFlag(NativeWindowChange.MaximumSize)) NativeOptions.MaximumSize = changes.MaximumSize;
+        if (changes.Changes.HasFlag(NativeWindowChange.TopMost)) NativeOptions.TopMost = changes.TopMost;
+        if (changes.Changes.HasFlag(NativeWindowChange.MinimizeEnabled)) NativeOptions.MinimizeEnabled = changes.MinimizeEnabled;
+        if (changes.Changes.HasFlag(NativeWindowChange.MaximizeEnabled)) NativeOptions.MaximizeEnabled = changes.MaximizeEnabled;
+    }
+
     internal void Invoke(Action action)
     {
         if (Environment.CurrentManagedThreadId == _managedWindowThreadId)
@@ -412,6 +751,89 @@ public partial class Window
 
     internal T SafeInvoke<T>(Func<T> func) => InstancePtr == nint.Zero ? default : Invoke(func);
 
+    private WindowState GetWindowState() => InstancePtr == nint.Zero ? NativeOptions.WindowState : NativeWindow.GetWindowState(InstancePtr);
+
+    private NativeSize GetSize() => InstancePtr == nint.Zero ? NativeOptions.Size : NativeWindow.GetSize(InstancePtr);
+
+    private NativePoint GetLocation() => InstancePtr == nint.Zero ? NativeOptions.Location : NativeWindow.GetLocation(InstancePtr);
+
+    private static void CompleteSpawn(nint context, nint window, nint webView)
+    {
+        var handle = GCHandle.FromIntPtr(context);
+        var target = (Window)handle.Target;
+        handle.Free();
+
+        target._managedWindowThreadId = Environment.CurrentManagedThreadId;
+        target.InstancePtr = window;
+        target.WebView.InstancePtr = webView;
+        target.WebView.InitializeNative();
+        target.CreateWebViews();
+        App.ActiveWindows.Add(target);
+        target.InvokeCreated();
+
+        var completion = target._spawnCompletion;
+        target._spawnCompletion = null;
+        completion.SetResult();
+    }
+
+    private static void RunTimer(nint context)
+    {
+        var id = (int)context;
+        if (!Timers.TryGetValue(id, out var timer))
+            return;
+
+        if (!timer.Periodic)
+            Timers.TryRemove(id, out _);
+
+        timer.Callback();
+    }
+
+    private static void RunBeginInvoke(nint context)
+    {
+        var handle = GCHandle.FromIntPtr(context);
+        var action = (Action)handle.Target;
+        handle.Free();
+        action();
+    }
+
+    private static void RunInvokeAsync(nint context)
+    {
+        var invocation = (AsyncInvocation)GCHandle.FromIntPtr(context).Target;
+        try {
+            invocation.Action();
+        }
+        catch (Exception ex) {
+            invocation.Error = ex;
+        }
+    }
+
+    private static void CompleteInvokeAsync(nint context)
+    {
+        var handle = GCHandle.FromIntPtr(context);
+        var invocation = (AsyncInvocation)handle.Target;
+        handle.Free();
+
+        if (invocation.Error != null)
+            invocation.Completion.SetException(invocation.Error);
+        else
+            invocation.Completion.SetResult();
+    }
+
+    private sealed class WindowTimer(Window owner, Action callback, bool periodic)
+    {
+        public readonly Window Owner = owner;
+        public readonly Action Callback = callback;
+        public readonly bool Periodic = periodic;
+        public int NativeId;
+    }
+
+    private sealed class AsyncInvocation(Action action)
+    {
+        public readonly Action Action = action;
+        public readonly TaskCompletionSource Completion = new(TaskCreationOptions.RunContinuationsAsynchronously);
+        public Exception Error;
+    }
+
     /// <summary>
     /// Occurs when the window is being created.
     /// </summary>
@@ -490,6 +912,94 @@ public partial class Window
     /// <param name="e">An <see cref="EventArgs"/> that contains the event data.</param>
     protected virtual void OnClosed(EventArgs e) { }
 
+    // Handlers are combined under the mask lock, so concurrent subscriptions neither lose a
+    // handler nor leave the mask computed from a stale delegate.
+    private void AddHandler<T>(ref T handlers, T value, NativeEventType type) where T : Delegate
+    {
+        lock (_eventMaskLock) {
+            handlers = (T)Delegate.Combine(handlers, value);
+            UpdateEventMask(type, handlers != null);
+        }
+    }
+
+    private void RemoveHandler<T>(ref T handlers, T value, NativeEventType type) where T : Delegate
+    {
+        lock (_eventMaskLock) {
+            handlers = (T)Delegate.Remove(handlers, value);
+            UpdateEventMask(type, handlers != null);
+        }
+    }
+
+    internal void AddWebViewHandler<T>(ref T handlers, T value, NativeEventType type) where T : Delegate
+    {
+        lock (_eventMaskLock) {
+            handlers = (T)Delegate.Combine(handlers, value);
+            UpdateWebViewEventMask(type);
+        }
+    }
+
+    internal void RemoveWebViewHandler<T>(ref T handlers, T value, NativeEventType type) where T : Delegate
+    {
+        lock (_eventMaskLock) {
+            handlers = (T)Delegate.Remove(handlers, value);
+            UpdateWebViewEventMask(type);
+        }
+    }
+
+    // Callers hold the mask lock.
+    private void UpdateWebViewEventMasks()
+    {
+        UpdateWebViewEventMask(NativeEventType.NavigationStart);
+        UpdateWebViewEventMask(NativeEventType.NavigationEnd);
+        UpdateWebViewEventMask(NativeEventType.MessageReceived);
+    }
+
+    private void UpdateWebViewEventMask(NativeEventType type) => UpdateEventMask(type, _webViews.Any(webView => webView.HasSubscribers(type)));
+
+    private void UpdateEventMask(NativeEventType type, bool subscribed)
+    {
+        var bit = 1u << (int)type;
+        var mask = subscribed || (_overriddenEvents & bit) != 0 ? _eventMask | bit : _eventMask & ~bit;
+        if (mask == _eventMask)
+            return;
+
+        _eventMask = mask;
+        if (InstancePtr == nint.Zero)
+            NativeEvents.Subscriptions = mask;
+        else
+            NativeWindow.SetEventMask(InstancePtr, mask);
+    }
+
+    private unsafe void DispatchEvents(nint records, int count)
+    {
+        foreach (var record in new ReadOnlySpan<NativeEventRecord>((void*)records, count)) {
+            switch (record.Type) {
+                case NativeEventType.Shown: InvokeShown(); break;
+                case NativeEventType.Hidden: InvokeHidden(); break;
+                case NativeEventType.Resize: InvokeResize(new() { Width = record.X, Height = record.Y }); break;
+                case NativeEventType.ResizeStart: InvokeResizeStart(new() { Width = record.X, Height = record.Y }); break;
+                case NativeEventType.ResizeEnd: InvokeResizeEnd(new() { Width = record.X, Height = record.Y }); break;
+                case NativeEventType.LocationChanged: InvokeLocationChanged(new() { X = record.X, Y = record.Y }); break;
+                case NativeEventType.WindowStateChanged: InvokeWindowStateChanged(record.X); break;
+                case NativeEventType.FocusIn: InvokeFocusIn(); break;
+                case NativeEventType.FocusOut: InvokeFocusOut(); break;
+                case NativeEventType.NavigationStart: FindWebView(record.X)?.InvokeNavigationStart(Marshal.PtrToStringAuto(record.Text)); break;
+                case NativeEventType.NavigationEnd: FindWebView(record.X)?.InvokeNavigationEnd(); break;
+                case NativeEventType.MessageReceived: FindWebView(record.X)?.InvokeMessageReceived(Marshal.PtrToStringAuto(record.Text)); break;
+            }
+        }
+    }
+
+    private WebView FindWebView(int viewId) => _webViews.Find(webView => webView.ViewId == viewId && webView.InstancePtr != nint.Zero);
+
+    private void CreateWebViews()
+    {
+        foreach (var webView in _webViews) {
+            if (webView.InstancePtr == nint.Zero)
+                webView.CreateNative();
+        }
+    }
+
     private void InvokeCreating()
     {
         OnCreating(EventArgs.Empty);
@@ -505,67 +1015,72 @@ public partial class Window
     private void InvokeShown()
     {
         OnShown(EventArgs.Empty);
-        Shown?.Invoke(this, EventArgs.Empty);
+        _shown?.Invoke(this, EventArgs.Empty);
     }
 
     private void InvokeHidden()
     {
         OnHidden(EventArgs.Empty);
-        Hidden?.Invoke(this, EventArgs.Empty);
+        _hidden?.Invoke(this, EventArgs.Empty);
     }
 
     private void InvokeResize(NativeSize e)
     {
         OnResize(new(e.Width, e.Height));
-        Resize?.Invoke(this, new(e.Width, e.Height));
+        _resize?.Invoke(this, new(e.Width, e.Height));
     }
 
     private void InvokeResizeStart(NativeSize e)
     {
         OnResizeStart(new(e.Width, e.Height));
-        ResizeStart?.Invoke(this, new(e.Width, e.Height));
+        _resizeStart?.Invoke(this, new(e.Width, e.Height));
     }
 
     private void InvokeResizeEnd(NativeSize e)
     {
         OnResizeEnd(new(e.Width, e.Height));
-        ResizeEnd?.Invoke(this, new(e.Width, e.Height));
+        _resizeEnd?.Invoke(this, new(e.Width, e.Height));
     }
 
     private void InvokeLocationChanged(NativePoint e)
     {
         OnLocationChanged(new(e.X, e.Y));
-        LocationChanged?.Invoke(this, new(e.X, e.Y));
+        _locationChanged?.Invoke(this, new(e.X, e.Y));
     }
 
     private void InvokeWindowStateChanged(int e)
     {
         OnWindowStateChanged(new((WindowState)e));
-        WindowStateChanged?.Invoke(this, new((WindowState)e));
+        _windowStateChanged?.Invoke(this, new((WindowState)e));
     }
 
     private void InvokeFocusIn()
     {
         OnFocusIn(EventArgs.Empty);
-        FocusIn?.Invoke(this, EventArgs.Empty);
+        _focusIn?.Invoke(this, EventArgs.Empty);
     }
 
     private void InvokeFocusOut()
     {
         OnFocusOut(EventArgs.Empty);
-        FocusOut?.Invoke(this, EventArgs.Empty);
+        _focusOut?.Invoke(this, EventArgs.Empty);
     }
 
     private bool InvokeClosing()
     {
         var e = new WindowClosingEventArgs(false);
         OnClosing(e);
-        Closing?.Invoke(this, e);
+        _closing?.Invoke(this, e);
         return e.Cancel;
     }
 
     private void InvokeClosed()
     {
+        foreach (var (id, timer) in Timers) {
+            if (timer.Owner == this)
+                Timers.TryRemove(id, out _);
+        }
+
         OnClosed(EventArgs.Empty);
         Closed?.Invoke(this, EventArgs.Empty);
     }
@@ -0,0 +1,140 @@
+﻿using System.Drawing;
+using Gluino.Interop;
+
+namespace Gluino;
+
+/// <summary>
+/// Collects property changes for a <see cref="Window"/> and applies them in a single pass.
+/// </summary>
+/// <remarks>
+/// Obtain an instance with <see cref="Window.BeginChanges"/>. Only the properties that are set are changed.
+/// Applying the set performs one frame recalculation on the window thread and raises a single
+/// <see cref="Window.Resize"/>, <see cref="Window.LocationChanged"/> and
+/// <see cref="Window.WindowStateChanged"/> notification for the final result.
+/// </remarks>
+public sealed class WindowChangeSet
+{
+    private readonly Window _window;
+    private NativeWindowChangeSet _changes;
+
+    internal WindowChangeSet(Window window)
+    {
+        _window = window;
+    }
+
+    /// <summary>
+    /// Set the size of the window.
+    /// </summary>
+    public Size Size {
+        set {
+            _changes.Size = value;
+            _changes.Changes |= NativeWindowChange.Size;
+        }
+    }
+
+    /// <summary>
+    /// Set the location of the window.
+    /// </summary>
+    public Point Location {
+        set {
+            _changes.Location = value;
+            _changes.Changes |= NativeWindowChange.Location;
+        }
+    }
+
+    /// <summary>
+    /// Set the state of the window.
+    /// </summary>
+    /// <remarks>
+    /// When combined with <see cref="Size"/> or <see cref="Location"/> on a maximized or minimized window,
+    /// those values become the bounds the window restores to.
+    /// </remarks>
+    public WindowState WindowState {
+        set {
+            _changes.WindowState = value;
+            _changes.Changes |= NativeWindowChange.WindowState;
+        }
+    }
+
+    /// <summary>
+    /// Set the border style of the window.
+    /// </summary>
+    public WindowBorderStyle BorderStyle {
+        set {
+            _changes.BorderStyle = value;
+            _changes.Changes |= NativeWindowChange.BorderStyle;
+        }
+    }
+
+    /// <summary>
+    /// Set the theme of the window.
+    /// </summary>
+    public WindowTheme Theme {
+        set {
+            _changes.Theme = value;
+            _changes.Changes |= NativeWindowChange.Theme;
+        }
+    }
+
+    /// <summary>
+    /// Set the minimum size of the window.
+    /// </summary>
+    public Size MinimumSize {
+        set {
+            _changes.MinimumSize = value;
+            _changes.Changes |= NativeWindowChange.MinimumSize;
+        }
+    }
+
+    /// <summary>
+    /// Set the maximum size of the window.
+    /// </summary>
+    public Size MaximumSize {
+        set {
+            _changes.MaximumSize = value;
+            _changes.Changes |= NativeWindowChange.MaximumSize;
+        }
+    }
+
+    /// <summary>
+    /// Set whether the window is always on top of other windows.
+    /// </summary>
+    public bool TopMost {
+        set {
+            _changes.TopMost = value;
+            _changes.Changes |= NativeWindowChange.TopMost;
+        }
+    }
+
+    /// <summary>
+    /// Set whether the window can be minimized.
+    /// </summary>
+    public bool MinimizeEnabled {
+        set {
+            _changes.MinimizeEnabled = value;
+            _changes.Changes |= NativeWindowChange.MinimizeEnabled;
+        }
+    }
+
+    /// <summary>
+    /// Set whether the window can be maximized.
+    /// </summary>
+    public bool MaximizeEnabled {
+        set {
+            _changes.MaximizeEnabled = value;
+            _changes.Changes |= NativeWindowChange.MaximizeEnabled;
+        }
+    }
+
+    /// <summary>
+    /// Apply all collected changes to the window and clear the set.
+    /// </summary>
+    public void Commit()
+    {
+        if (_changes.Changes == NativeWindowChange.None)
+            return;
+
+        _window.ApplyChanges(_changes);
+        _changes = default;
+    }
+}
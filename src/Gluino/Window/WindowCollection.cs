@@ -7,19 +7,28 @@ namespace Gluino;
 /// </summary>
 public sealed class WindowCollection : IReadOnlyList<Window>
 {
+    private readonly object _lock = new();
     private readonly List<Window> _windows = [];
 
     /// <summary>
     /// Gets the number of windows in the collection.
     /// </summary>
-    public int Count => _windows.Count;
+    public int Count {
+        get {
+            lock (_lock) return _windows.Count;
+        }
+    }
 
     /// <summary>
     /// Gets the window at the specified index.
     /// </summary>
     /// <param name="index">The zero-based index of the <see cref="Window"/> to get.</param>
     /// <returns>The <see cref="Window"/> at the specified index.</returns>
-    public Window this[int index] => _windows[index];
+    public Window this[int index] {
+        get {
+            lock (_lock) return _windows[index];
+        }
+    }
 
     /// <summary>
     /// Gets the index of the specified window.
@@ -28,17 +37,34 @@ public sealed class WindowCollection : IReadOnlyList<Window>
     /// <returns>
     /// The zero-based index of the first occurrence of the specified <see cref="Window"/> in the collection if found; otherwise, -1.
     /// </returns>
-    public int IndexOf(Window window) => _windows.IndexOf(window);
+    public int IndexOf(Window window)
+    {
+        lock (_lock) return _windows.IndexOf(window);
+    }
 
     /// <summary>
     /// Returns an enumerator that iterates through the collection.
     /// </summary>
     /// <returns>An enumerator that can be used to iterate through the collection.</returns>
-    public IEnumerator<Window> GetEnumerator() => _windows.GetEnumerator();
+    /// <remarks>
+    /// Windows may live on different UI threads, so the enumerator iterates over a copy of the collection.
+    /// </remarks>
+    public IEnumerator<Window> GetEnumerator()
+    {
+        Window[] windows;
+        lock (_lock) windows = [.. _windows];
+        return ((IEnumerable<Window>)windows).GetEnumerator();
+    }
 
     IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
 
-    internal void Add(Window window) => _windows.Add(window);
+    internal void Add(Window window)
+    {
+        lock (_lock) _windows.Add(window);
+    }
 
-    internal void Remove(Window window) => _windows.Remove(window);
+    internal void Remove(Window window)
+    {
+        lock (_lock) _windows.Remove(window);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+﻿using System.Drawing;
+
+namespace Gluino;
+
+/// <summary>
+/// Represents a consistent view of a <see cref="Window"/>'s geometry and state.
+/// </summary>
+/// <param name="Version">Incremented every time the native window publishes a change.</param>
+/// <param name="Bounds">The bounding rectangle of the window.</param>
+/// <param name="WindowState">The state of the window.</param>
+/// <param name="IsDarkMode">Whether the window's theme is in dark mode.</param>
+public readonly record struct WindowSnapshot(uint Version, Rectangle Bounds, WindowState WindowState, bool IsDarkMode);